@@ -1462,6 +1462,13 @@
 #define GxB_CONJ_FC64 GxM_CONJ_FC64
 #define GxB_COPYSIGN_FP32 GxM_COPYSIGN_FP32
 #define GxB_COPYSIGN_FP64 GxM_COPYSIGN_FP64
+#define GxB_Context_disengage GxM_Context_disengage
+#define GxB_Context_engage GxM_Context_engage
+#define GxB_Context_fprint GxM_Context_fprint
+#define GxB_Context_free GxM_Context_free
+#define GxB_Context_get GxM_Context_get
+#define GxB_Context_new GxM_Context_new
+#define GxB_Context_set GxM_Context_set
 #define GxB_COS_FC32 GxM_COS_FC32
 #define GxB_COS_FC64 GxM_COS_FC64
 #define GxB_COS_FP32 GxM_COS_FP32
@@ -2553,6 +2560,8 @@
 #define GxB_Monoid_terminal_new_UINT32 GxM_Monoid_terminal_new_UINT32
 #define GxB_Monoid_terminal_new_UINT64 GxM_Monoid_terminal_new_UINT64
 #define GxB_Monoid_terminal_new_UINT8 GxM_Monoid_terminal_new_UINT8
+#define GxB_mxm_batch GxM_mxm_batch
+#define GxB_mxm_reduce GxM_mxm_reduce
 #define GxB_NE_FC32 GxM_NE_FC32
 #define GxB_NE_FC64 GxM_NE_FC64
 #define GxB_NE_THUNK GxM_NE_THUNK
@@ -3333,10 +3342,12 @@
 #define GB_AxB_dot2_control GM_AxB_dot2_control
 #define GB_AxB_dot3 GM_AxB_dot3
 #define GB_AxB_dot3_one_slice GM_AxB_dot3_one_slice
+#define GB_AxB_dot3_reduce GM_AxB_dot3_reduce
 #define GB_AxB_dot3_slice GM_AxB_dot3_slice
 #define GB_AxB_dot4 GM_AxB_dot4
 #define GB_AxB_meta GM_AxB_meta
 #define GB_AxB_meta_adotb_control GM_AxB_meta_adotb_control
+#define GB_AxB_meta_pushpull GM_AxB_meta_pushpull
 #define GB_AxB_rowscale GM_AxB_rowscale
 #define GB_AxB_saxpy GM_AxB_saxpy
 #define GB_AxB_saxpy3 GM_AxB_saxpy3
@@ -3352,6 +3363,9 @@
 #define GB_AxB_saxpy3_generic_secondj32 GM_AxB_saxpy3_generic_secondj32
 #define GB_AxB_saxpy3_generic_secondj64 GM_AxB_saxpy3_generic_secondj64
 #define GB_AxB_saxpy3_generic_unflipped GM_AxB_saxpy3_generic_unflipped
+#define GB_AxB_saxpy3_plan_free GM_AxB_saxpy3_plan_free
+#define GB_AxB_saxpy3_plan_match GM_AxB_saxpy3_plan_match
+#define GB_AxB_saxpy3_plan_save GM_AxB_saxpy3_plan_save
 #define GB_AxB_saxpy3_slice_balanced GM_AxB_saxpy3_slice_balanced
 #define GB_AxB_saxpy3_slice_quick GM_AxB_saxpy3_slice_quick
 #define GB_AxB_saxpy3_sym_bh GM_AxB_saxpy3_sym_bh
@@ -3398,6 +3412,7 @@
 #define GB_AxB_saxpy4 GM_AxB_saxpy4
 #define GB_AxB_saxpy4_tasks GM_AxB_saxpy4_tasks
 #define GB_AxB_saxpy5 GM_AxB_saxpy5
+#define GB_AxB_saxpy_bitwise GM_AxB_saxpy_bitwise
 #define GB_AxB_saxpy_generic GM_AxB_saxpy_generic
 #define GB_AxB_saxpy_sparsity GM_AxB_saxpy_sparsity
 #define GB_AxB_semiring_builtin GM_AxB_semiring_builtin
@@ -3442,8 +3457,11 @@
 #define GB_bitmap_expand_to_hyper GM_bitmap_expand_to_hyper
 #define GB_bitmap_M_scatter GM_bitmap_M_scatter
 #define GB_bitmap_M_scatter_whole GM_bitmap_M_scatter_whole
+#define GB_bitmap_pack GM_bitmap_pack
+#define GB_bitmap_packed_ewise GM_bitmap_packed_ewise
 #define GB_bitmap_selector GM_bitmap_selector
 #define GB_bitmap_subref GM_bitmap_subref
+#define GB_bitmap_unpack GM_bitmap_unpack
 #define GB_bitshift_int16 GM_bitshift_int16
 #define GB_bitshift_int32 GM_bitshift_int32
 #define GB_bitshift_int64 GM_bitshift_int64
@@ -3506,6 +3524,11 @@
 #define GB_concat_sparse GM_concat_sparse
 #define GB_conform GM_conform
 #define GB_conform_hyper GM_conform_hyper
+#define GB_Context_check GM_Context_check
+#define GB_Context_chunk GM_Context_chunk
+#define GB_Context_engaged GM_Context_engaged
+#define GB_Context_engaged_set GM_Context_engaged_set
+#define GB_Context_nthreads_max GM_Context_nthreads_max
 #define GB_convert_any_to_bitmap GM_convert_any_to_bitmap
 #define GB_convert_any_to_full GM_convert_any_to_full
 #define GB_convert_any_to_hyper GM_convert_any_to_hyper
@@ -3538,6 +3561,10 @@
 #define GB_debugify_ewise GM_debugify_ewise
 #define GB_debugify_mxm GM_debugify_mxm
 #define GB_debugify_reduce GM_debugify_reduce
+#define GB_deferred_apply GM_deferred_apply
+#define GB_deferred_count GM_deferred_count
+#define GB_deferred_drop GM_deferred_drop
+#define GB_deferred_flush GM_deferred_flush
 #define GB_dense_ewise3_accum GM_dense_ewise3_accum
 #define GB_dense_ewise3_noaccum GM_dense_ewise3_noaccum
 #define GB_dense_subassign_05d GM_dense_subassign_05d
@@ -3550,6 +3577,7 @@
 #define GB_deserialize GM_deserialize
 #define GB_deserialize_from_blob GM_deserialize_from_blob
 #define GB_divcomplex GM_divcomplex
+#define GB_dual_setElement GM_dual_setElement
 #define GB_dup GM_dup
 #define GB_dup_worker GM_dup_worker
 #define GB_ek_slice GM_ek_slice
@@ -3638,12 +3666,14 @@
 #define GB_Global_free_function GM_Global_free_function
 #define GB_Global_free_function_set GM_Global_free_function_set
 #define GB_Global_free_pool_dump GM_Global_free_pool_dump
+#define GB_Global_free_pool_flush GM_Global_free_pool_flush
 #define GB_Global_free_pool_get GM_Global_free_pool_get
 #define GB_Global_free_pool_init GM_Global_free_pool_init
 #define GB_Global_free_pool_limit_get GM_Global_free_pool_limit_get
 #define GB_Global_free_pool_limit_set GM_Global_free_pool_limit_set
 #define GB_Global_free_pool_nblocks_total GM_Global_free_pool_nblocks_total
 #define GB_Global_free_pool_put GM_Global_free_pool_put
+#define GB_Global_free_pool_stats GM_Global_free_pool_stats
 #define GB_Global_get_wtime GM_Global_get_wtime
 #define GB_Global_gpu_chunk_get GM_Global_gpu_chunk_get
 #define GB_Global_gpu_chunk_set GM_Global_gpu_chunk_set
@@ -3663,8 +3693,12 @@
 #define GB_Global_hack_get GM_Global_hack_get
 #define GB_Global_hack_set GM_Global_hack_set
 #define GB_Global_have_realloc_function GM_Global_have_realloc_function
+#define GB_Global_huge_page_threshold_get GM_Global_huge_page_threshold_get
+#define GB_Global_huge_page_threshold_set GM_Global_huge_page_threshold_set
 #define GB_Global_hyper_switch_get GM_Global_hyper_switch_get
 #define GB_Global_hyper_switch_set GM_Global_hyper_switch_set
+#define GB_Global_index32_get GM_Global_index32_get
+#define GB_Global_index32_set GM_Global_index32_set
 #define GB_Global_is_csc_get GM_Global_is_csc_get
 #define GB_Global_is_csc_set GM_Global_is_csc_set
 #define GB_Global_malloc_debug_count_decrement GM_Global_malloc_debug_count_decrement
@@ -3677,6 +3711,10 @@
 #define GB_Global_malloc_is_thread_safe_set GM_Global_malloc_is_thread_safe_set
 #define GB_Global_malloc_tracking_get GM_Global_malloc_tracking_get
 #define GB_Global_malloc_tracking_set GM_Global_malloc_tracking_set
+#define GB_Global_memory_budget_get GM_Global_memory_budget_get
+#define GB_Global_memory_budget_set GM_Global_memory_budget_set
+#define GB_Global_memory_policy_get GM_Global_memory_policy_get
+#define GB_Global_memory_policy_set GM_Global_memory_policy_set
 #define GB_Global_memtable_add GM_Global_memtable_add
 #define GB_Global_memtable_clear GM_Global_memtable_clear
 #define GB_Global_memtable_dump GM_Global_memtable_dump
@@ -3697,6 +3735,9 @@
 #define GB_Global_print_mem_shallow_set GM_Global_print_mem_shallow_set
 #define GB_Global_print_one_based_get GM_Global_print_one_based_get
 #define GB_Global_print_one_based_set GM_Global_print_one_based_set
+#define GB_Global_pushpull_stats_add GM_Global_pushpull_stats_add
+#define GB_Global_pushpull_stats_clear GM_Global_pushpull_stats_clear
+#define GB_Global_pushpull_stats_get GM_Global_pushpull_stats_get
 #define GB_Global_realloc_function GM_Global_realloc_function
 #define GB_Global_realloc_function_set GM_Global_realloc_function_set
 #define GB_Global_timing_add GM_Global_timing_add
@@ -3798,6 +3839,8 @@
 #define GB_ijproperties GM_ijproperties
 #define GB_ijsort GM_ijsort
 #define GB_import GM_import
+#define GB_index32_pack GM_index32_pack
+#define GB_index32_unpack GM_index32_unpack
 #define GB_IndexUnaryOp_check GM_IndexUnaryOp_check
 #define GB_init GM_init
 #define GB_int64_multiply GM_int64_multiply
@@ -3923,6 +3966,7 @@
 #define GB_matvec_type GM_matvec_type
 #define GB_matvec_type_name GM_matvec_type_name
 #define GB_memcpy GM_memcpy
+#define GB_memory_placement GM_memory_placement
 #define GB_memoryUsage GM_memoryUsage
 #define GB_memset GM_memset
 #define GB_Monoid_check GM_Monoid_check
@@ -3934,6 +3978,8 @@
 #define GB_msort_3 GM_msort_3
 #define GB_msort_3_create_merge_tasks GM_msort_3_create_merge_tasks
 #define GB_mxm GM_mxm
+#define GB_mxm_batch GM_mxm_batch
+#define GB_mxm_reduce GM_mxm_reduce
 #define GB_namify_problem GM_namify_problem
 #define GB_new GM_new
 #define GB_new_bix GM_new_bix
@@ -3947,6 +3993,10 @@
 #define GB_Op_free GM_Op_free
 #define GB_op_is_second GM_op_is_second
 #define GB_op_name_and_defn GM_op_name_and_defn
+#define GB_packed_unpack GM_packed_unpack
+#define GB_packed_find GM_packed_find
+#define GB_packed_view GM_packed_view
+#define GB_parallel_for GM_parallel_for
 #define GB_Pending_alloc GM_Pending_alloc
 #define GB_Pending_free GM_Pending_free
 #define GB_Pending_n GM_Pending_n
@@ -4057,6 +4107,8 @@
 #define GB_transplant_conform GM_transplant_conform
 #define GB_transpose GM_transpose
 #define GB_transpose_bucket GM_transpose_bucket
+#define GB_transpose_cache_free GM_transpose_cache_free
+#define GB_transpose_cache_get GM_transpose_cache_get
 #define GB_transpose_cast GM_transpose_cast
 #define GB_transpose_in_place GM_transpose_in_place
 #define GB_transpose_ix GM_transpose_ix
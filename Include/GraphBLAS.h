@@ -431,6 +431,21 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 //      the future.  If chunk is set to <= GxB_DEFAULT (that is, zero), the
 //      default is used.
 //
+// GxB_MEMORY_BUDGET: a double parameter that limits the memory, in bytes,
+//      that GrB_mxm, GrB_mxv, and GrB_vxm may allocate for their workspace and
+//      result.  If <= GxB_DEFAULT (that is, zero), the global budget is used,
+//      which is also zero (no limit) by default.  If the method selected for
+//      C=A*B is estimated to exceed the budget, a method that uses less memory
+//      is used instead: the hash method in place of Gustavson's method, fewer
+//      threads (each of which needs its own workspace), or the masked dot
+//      product method if a mask is present and not complemented.  If no
+//      method fits, GrB_OUT_OF_MEMORY is returned without attempting the
+//      computation, and GrB_error reports the estimated peak memory.  The
+//      estimate is an upper bound; it does not include the memory already
+//      held by the input matrices.  GxB_mxm_batch is not used as a fallback,
+//      since GrB_mxm must return all of C at once; an application that can
+//      consume C one block at a time should call GxB_mxm_batch itself.
+//
 // GxB_AxB_METHOD: this is a hint to SuiteSparse:GraphBLAS on which algorithm
 //      it should use to compute C=A*B, in GrB_mxm, GrB_mxv, and GrB_vxm.
 //      SuiteSparse:GraphBLAS has four different heuristics, and the default
@@ -482,6 +497,7 @@ GrB_Info GrB_getVersion         // runtime access to C API version number
 // value for both enums, so the user can use them for both.
 #define GxB_NTHREADS 5
 #define GxB_CHUNK 7
+#define GxB_MEMORY_BUDGET 38
 
 // GPU control (DRAFT: in progress, do not use)
 #define GxB_GPU_CONTROL 21
@@ -501,6 +517,10 @@ typedef enum
     GxB_DESCRIPTOR_CHUNK = GxB_CHUNK,   // chunk size for small problems.
                     // If <= GxB_DEFAULT, then the default is used.
 
+    GxB_DESCRIPTOR_MEMORY_BUDGET = GxB_MEMORY_BUDGET,  // memory budget for
+                    // GrB_mxm, in bytes.  If <= GxB_DEFAULT, then the global
+                    // budget is used.
+
     // GPU control (DRAFT: in progress, do not use)
     GxB_DESCRIPTOR_GPU_CONTROL = GxB_GPU_CONTROL,
     GxB_DESCRIPTOR_GPU_CHUNK   = GxB_GPU_CHUNK,
@@ -4370,6 +4390,7 @@ typedef enum            // for global options or matrix options
     GxB_HYPER_SWITCH = 0,   // defines switch to hypersparse (a double value)
     GxB_BITMAP_SWITCH = 34, // defines switch to bitmap (a double value)
     GxB_FORMAT = 1,         // defines CSR/CSC format: GxB_BY_ROW or GxB_BY_COL
+    GxB_INDEX_32 = 42,      // if true, hold indices in 32 bits (bool)
 
     //------------------------------------------------------------
     // for GxB_Global_Option_get only:
@@ -4402,11 +4423,31 @@ typedef enum            // for global options or matrix options
     GxB_GLOBAL_CHUNK = GxB_CHUNK,       // chunk size for small problems.
                         // If <= GxB_DEFAULT, then the default is used.
 
+    GxB_GLOBAL_MEMORY_BUDGET = GxB_MEMORY_BUDGET,  // memory budget for
+                        // GrB_mxm, in bytes.  If <= GxB_DEFAULT, no limit.
+
     GxB_BURBLE = 99,    // diagnostic output (bool *)
     GxB_PRINTF = 101,   // printf function diagnostic output
     GxB_FLUSH = 102,    // flush function diagnostic output
     GxB_MEMORY_POOL = 103,  // memory pool control
     GxB_PRINT_1BASED = 104,   // print matrices as 0-based or 1-based
+    GxB_MEMORY_POOL_STATS = 105,    // memory pool statistics of this thread
+    GxB_MEMORY_POLICY = 106,        // placement of large blocks (int)
+    GxB_HUGE_PAGE_THRESHOLD = 107,  // min size for huge pages (int64_t)
+    GxB_PUSHPULL_STATS = 109,       // push/pull selection counts (int64_t)
+
+    //------------------------------------------------------------
+    // CPU JIT control, for GxB_Global_Option_get/set only:
+    //------------------------------------------------------------
+
+    GxB_JIT_C_CONTROL = 110,        // enable/disable the CPU JIT (bool)
+    GxB_JIT_C_COMPILER_NAME = 111,  // C compiler for JIT kernels (char *)
+    GxB_JIT_C_COMPILER_FLAGS = 112, // C compiler flags for JIT kernels (char *)
+    GxB_JIT_CACHE_PATH = 113,       // folder for JIT kernels (char *)
+    GxB_JIT_CACHE_HITS = 114,       // # kernels loaded from cache (int64_t)
+    GxB_JIT_CACHE_MISSES = 115,     // # kernels compiled (int64_t)
+    GxB_JIT_COMPILE_TIME = 116,     // time spent compiling kernels (double)
+    GxB_JIT_CACHE_BYTES = 117,      // size of the JIT cache folder (int64_t)
 
     //------------------------------------------------------------
     // for GxB_Matrix_Option_get only:
@@ -4420,6 +4461,10 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 32,      // sparsity control: 0 to 15; see below
+    GxB_TRANSPOSE_CACHE = 39,       // if true, cache the transpose (bool)
+    GxB_DUAL_FORMAT = 40,           // if true, keep both CSR and CSC (bool)
+    GxB_BITMAP_PACKED = 41,         // if true, pack a bitmap into bits (bool)
+    GxB_AxB_PLAN = 43,              // if true, reuse the analysis of C=A*B
 
     //------------------------------------------------------------
     // GPU and options (DRAFT: do not use)
@@ -4439,6 +4484,15 @@ typedef enum
 }
 GxB_Format_Value ;
 
+// GxB_MEMORY_POLICY can be one of these values:
+typedef enum
+{
+    GxB_MEMORY_POLICY_DEFAULT = 0,      // left to the operating system
+    GxB_MEMORY_POLICY_INTERLEAVE = 1,   // interleave pages across NUMA nodes
+    GxB_MEMORY_POLICY_FIRST_TOUCH = 2   // first touch by parallel threads
+}
+GxB_Memory_Policy_Value ;
+
 // The default format is by row.  These constants are defined as GB_PUBLIC
 // const, so that if SuiteSparse:GraphBLAS is recompiled with a different
 // default format, and the application is relinked but not recompiled, it will
@@ -4457,6 +4511,12 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 // size of b array for GxB_set/get (GxB_BITMAP_SWITCH, b)
 #define GxB_NBITMAP_SWITCH 8    // size of bitmap_switch parameter array
 
+// size of the stats array for GxB_get (GxB_MEMORY_POOL_STATS, stats)
+#define GxB_NMEMORY_POOL_STATS 4
+
+// size of the stats array for GxB_get (GxB_PUSHPULL_STATS, stats)
+#define GxB_NPUSHPULL_STATS 2
+
 // any sparsity value:
 #define GxB_ANY_SPARSITY (GxB_HYPERSPARSE + GxB_SPARSE + GxB_BITMAP + GxB_FULL)
 
@@ -4519,6 +4579,95 @@ GB_PUBLIC const double GxB_HYPER_DEFAULT ;
 //      a matrix always stays hypersparse, or always stays non-hypersparse,
 //      respectively.
 
+// GxB_TRANSPOSE_CACHE:
+//      GxB_Matrix_Option_set (A, GxB_TRANSPOSE_CACHE, true) asks GraphBLAS to
+//      keep a copy of the transpose of A, once it has been computed, so that
+//      it can be reused by later operations that require A' (GrB_mxm with a
+//      transposed input, GrB_transpose, GrB_reduce to a vector, GrB_extract,
+//      and so on).  This is useful when the same matrix is used transposed
+//      many times without being modified, at the cost of twice the memory for
+//      A.  The cached transpose is freed whenever A is modified, and rebuilt
+//      when next needed.  GrB_Matrix_wait (A, GrB_MATERIALIZE) constructs it
+//      right away.  The default is false.  Setting it to false frees the
+//      cached transpose, if present.  The memory used by the cached transpose
+//      is included in the result of GxB_Matrix_memoryUsage.
+
+// GxB_DUAL_FORMAT:
+//      GxB_Matrix_Option_set (A, GxB_DUAL_FORMAT, true) asks GraphBLAS to keep
+//      A in both formats, by row and by column, inside the single matrix A.
+//      This is useful for algorithms that use A in both orientations, such as
+//      a direction-optimizing BFS, which uses q'*A (push) when the frontier q
+//      is sparse and A*q (pull) when it is dense.  The second format is held
+//      as the cached transpose of A (see GxB_TRANSPOSE_CACHE, which is also
+//      enabled), and GrB_mxm, GrB_mxv, GrB_vxm, and other methods use
+//      whichever format avoids an explicit transpose.  The second format is
+//      constructed when first needed.  After that, GrB_Matrix_setElement and
+//      GrB_Matrix_removeElement update both formats, and the pending work in
+//      both is finished together by GrB_Matrix_wait.  Any other modification
+//      of A frees the second format, which is constructed again when next
+//      needed.  The default is false.  Setting GxB_TRANSPOSE_CACHE to false
+//      also sets GxB_DUAL_FORMAT to false.
+
+// GxB_BITMAP_PACKED:
+//      GxB_Matrix_Option_set (A, GxB_BITMAP_PACKED, true) asks GraphBLAS to
+//      hold the bitmap of A with one bit per entry, instead of one byte, when
+//      A is bitmap and not in use.  The bitmap is packed right away, and again
+//      by each GrB_Matrix_wait (A, GrB_COMPLETE).  A stays packed when it is
+//      used as an input; each method that needs the bitmap as bytes makes a
+//      temporary unpacked copy, and A is unpacked only when it is modified or
+//      exported.  If A is iso-valued (an unweighted graph, a BFS frontier or
+//      a set of visited nodes, for example), this takes 1/8th the memory of
+//      the unpacked matrix.  GrB_eWiseMult and GrB_eWiseAdd work directly on
+//      packed matrices if A, B, the mask (if present), and C (if its prior
+//      entries are needed) are all packed and iso with the same type and
+//      value, the operators return that value, no matrix is transposed, and C
+//      has the GxB_BITMAP_PACKED option.  C is then computed 64 entries at a
+//      time with bitwise AND, OR, and ANDNOT, and is left packed.
+//      GrB_Matrix_extractElement reads a packed matrix directly, without a
+//      copy.  Since a packed input is not modified, it can be used by several
+//      user threads at the same time, but the cost of the temporary copy is
+//      then paid by each method that needs it.  The default is false.  The
+//      option also applies to a GrB_Vector.
+
+// GxB_INDEX_32:
+//      GxB_Matrix_Option_set (A, GxB_INDEX_32, true) asks GraphBLAS to hold
+//      the pointers, hyperlist, and row/column indices of A (Ap, Ah, and Ai)
+//      as 32-bit integers instead of 64-bit, when A is sparse or hypersparse
+//      and not in use, and when its dimensions and number of entries are all
+//      less than 2^31.  The indices are narrowed right away, and again by each
+//      GrB_Matrix_wait (A, GrB_COMPLETE).  They are widened back to 64 bits
+//      when A is next modified or exported, and A is left with 64-bit indices
+//      if it has grown too large.  This reduces the memory taken by the
+//      pattern of A by half.  As with GxB_BITMAP_PACKED, A stays packed when
+//      it is used as an input, and each method that needs 64-bit indices
+//      makes a temporary widened copy.  GxB_Global_Option_set (GxB_INDEX_32,
+//      true) sets the default for new matrices.  The default is false.
+//
+//      The option only changes how A is held at rest.  All computations use
+//      64-bit indices, so it saves memory but does not make GrB_mxm or any
+//      other method faster.  The GxB import, export, pack, and unpack methods
+//      always take and return Ap, Ah, and Ai as GrB_Index (64-bit) arrays,
+//      whatever the option.  The option also applies to a GrB_Vector.
+
+// GxB_AxB_PLAN:
+//      GxB_Matrix_Option_set (C, GxB_AxB_PLAN, true) asks GraphBLAS to keep
+//      the symbolic analysis of C=A*B in C, when GrB_mxm computes C=A*B with
+//      the saxpy method, with no mask and no memory budget (GxB_MEMORY_BUDGET).
+//      The analysis is the set of parallel tasks, the sizes of their hash
+//      tables, and the number of entries in each vector of C.  If a later
+//      GrB_mxm computes C=A*B with the same patterns of A and B (their values
+//      may change), and the same number of threads and chunk size, the
+//      analysis is reused, and only the numeric work is done.  This is useful
+//      when the same product is computed many times with new values, as in an
+//      iterative solver or a graph algorithm with a fixed structure.  The
+//      analysis holds a copy of the patterns of A and B, which are compared
+//      with A and B to ensure the analysis is still valid, so it takes about
+//      as much memory as the patterns of A and B.  This memory is included in
+//      the result of GxB_Matrix_memoryUsage.  The analysis depends only on A
+//      and B, so it is kept when C is modified, and it is freed by
+//      GrB_Matrix_free or by setting the option to false.  The default is
+//      false.
+
 GB_PUBLIC const double GxB_ALWAYS_HYPER, GxB_NEVER_HYPER ;
 
 GB_PUBLIC
@@ -4568,6 +4717,82 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
 // global settings via GxB_Global_Option_set has no effect on matrices already
 // created.
 
+// The CPU JIT: if GraphBLAS is compiled with dlopen available, then C=A*B with
+// a semiring that has no pre-compiled kernel (a user-defined semiring, for
+// example) is computed by a kernel that is specialized for that semiring.
+// The kernel is written to the GxB_JIT_CACHE_PATH folder, compiled with the
+// GxB_JIT_C_COMPILER_NAME compiler and GxB_JIT_C_COMPILER_FLAGS, and loaded
+// into GraphBLAS.  Each kernel is compiled at most once while GraphBLAS is
+// running.  User-defined types and operators can be used in a JIT kernel
+// only if their definitions are given to GxB_Type_new and GxB_BinaryOp_new.
+// If the cache path is not set, a temporary folder is used, which is deleted
+// by GrB_finalize.  Use GxB_set (GxB_JIT_C_CONTROL, false) to disable the JIT.
+// The JIT is enabled by GrB_init only if the GraphBLAS source tree that the
+// library was compiled from is still present, since the kernels are compiled
+// with its header files.  The compiler is run directly, not with a shell: the
+// compiler name is a single program name or path, and the flags are split
+// into separate arguments at each space or tab.
+
+// If the cache path is set (with GxB_set or the GRAPHBLAS_JIT_CACHE_PATH
+// environment variable), the kernels are kept in a subfolder for this version
+// of GraphBLAS (GraphBLAS_v7.3.0_HASH, for example), and persist after
+// GraphBLAS finishes.  HASH is a hash of the compiler, its flags, and the
+// GraphBLAS header files the kernels are compiled with, so kernels compiled
+// with a different compiler, different flags, or a different build of
+// GraphBLAS are never loaded.  A kernel already in the cache is loaded without
+// compiling it, so the cache can be populated in advance and shared by many
+// processes.  Subfolders that are no longer used are not removed.  The
+// GxB_JIT_CACHE_HITS, GxB_JIT_CACHE_MISSES, GxB_JIT_COMPILE_TIME, and
+// GxB_JIT_CACHE_BYTES statistics report the number of kernels loaded from the
+// cache, the number of kernels compiled, the total time in seconds spent
+// compiling them, and the size in bytes of all files in the cache subfolder.
+
+// The memory pool: small blocks of memory freed by GraphBLAS are kept in a
+// pool of free blocks, one list for each power-of-2 block size, and reused
+// when GraphBLAS needs another block of the same size.  The GxB_MEMORY_POOL
+// option sets or gets the limit on the number of blocks in each list.  Each
+// user thread holds a small cache of blocks of up to 4 KB in front of the
+// pool, so that the threads do not contend for a lock on each malloc and free.
+// GxB_get (GxB_MEMORY_POOL_STATS, stats) returns the statistics of the cache
+// of the calling thread: stats [0] is the number of blocks obtained from the
+// cache, stats [1] and stats [2] are the number of times a batch of blocks
+// was moved from the pool to the cache and from the cache to the pool, and
+// stats [3] is the number of blocks currently held in the cache.  The caches
+// are returned to the pool by GrB_finalize, and the cache of a thread is
+// returned to the pool when the thread exits (if GraphBLAS is compiled with
+// POSIX threads), so that it can be used by threads started later.
+
+// Placement of large blocks: on a NUMA machine, a block of memory allocated
+// by one thread is placed on the NUMA node of the thread that first writes to
+// each page, which is often a single thread.  Other threads then access the
+// block remotely.  GxB_set (GxB_MEMORY_POLICY, policy) changes this for large
+// newly allocated blocks (256 KB or more).  GxB_MEMORY_POLICY_INTERLEAVE
+// spreads the pages of each block across all NUMA nodes available to the
+// process.  GxB_MEMORY_POLICY_FIRST_TOUCH has all threads touch the pages of
+// the block in parallel when it is allocated, each thread touching one
+// contiguous part of the block, just as the block is partitioned for the
+// parallel methods that use it.  GxB_set (GxB_HUGE_PAGE_THRESHOLD, bytes)
+// asks the operating system to use transparent huge pages for any newly
+// allocated block of at least that many bytes (0, the default, disables huge
+// pages).  These settings are hints, and are ignored on systems that do not
+// support them (they are currently used only on Linux).  Blocks reused from
+// the memory pool or resized by realloc are not affected.
+
+// Push/pull selection: GrB_mxv and GrB_vxm, and GrB_mxm when B is a single
+// column, can compute w<m>=A*u either by pushing each entry u(j) into the
+// column A(:,j) (the saxpy method), or by pulling each permitted entry w(i)
+// with the dot product of A(i,:) and u (the dot method), as in a
+// direction-optimizing BFS.  If the GxB_AxB_METHOD of the descriptor is
+// GxB_DEFAULT, the method is selected on each call by comparing estimates of
+// the work of each: the sum of the degrees of the vectors of A selected by
+// the pattern of u for push, and the sum of the degrees of the rows of A
+// permitted by the mask for pull.  The pull work is reduced if the monoid can
+// terminate early (LOR or ANY, for example), and the work of transposing A is
+// included if A is not held in the needed orientation (see GxB_DUAL_FORMAT).
+// The choice is reported by the burble.  GxB_get (GxB_PUSHPULL_STATS, stats)
+// returns the number of times push (stats [0]) and pull (stats [1]) have been
+// selected, and GxB_set (GxB_PUSHPULL_STATS, NULL) sets both counts to zero.
+
 GB_PUBLIC
 GrB_Info GxB_Global_Option_set      // set a global default option
 (
@@ -4582,6 +4807,80 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
     ...                             // return value of the global option
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Context: thread control for all GraphBLAS methods called by one thread
+//------------------------------------------------------------------------------
+
+// A GxB_Context holds the number of threads and the chunk size to use for all
+// GraphBLAS methods called by a single user thread, including those that do
+// not take a descriptor (GrB_*_dup, GrB_*_build, GrB_*_wait, GrB_*_clear,
+// GrB_*_extractTuples, and so on).  This allows an application with many user
+// threads to partition the cores of the machine between them.  A user thread
+// engages a context with GxB_Context_engage, and releases it with
+// GxB_Context_disengage.  While engaged, the settings in the context are used
+// instead of the global settings.  Any setting in a descriptor still takes
+// precedence over the context.  A context may be engaged by several user
+// threads at the same time, but each thread may engage at most one context at
+// a time.  A context must not be freed while another thread has engaged it.
+// GxB_Context_engage returns GrB_NOT_IMPLEMENTED if the compiler does not
+// support thread-local storage.
+
+typedef struct GB_Context_opaque *GxB_Context ;
+
+typedef enum
+{
+    GxB_CONTEXT_NTHREADS = GxB_NTHREADS,    // max number of threads to use.
+                        // If <= GxB_DEFAULT, use the global setting.
+    GxB_CONTEXT_CHUNK = GxB_CHUNK           // chunk size for small problems.
+                        // If <= GxB_DEFAULT, use the global setting.
+}
+GxB_Context_Field ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_new            // create a new Context
+(
+    GxB_Context *Context            // handle of Context to create
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_free           // free a Context
+(
+    GxB_Context *Context            // handle of Context to free
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_set            // set a parameter in a Context
+(
+    GxB_Context Context,            // Context to modify
+    GxB_Context_Field field,        // parameter to change
+    ...                             // value to change it to
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_get            // get a parameter from a Context
+(
+    GxB_Context Context,            // Context to query
+    GxB_Context_Field field,        // parameter to query
+    ...                             // return value of the parameter
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_engage         // engage a Context for this thread
+(
+    GxB_Context Context             // Context to engage
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Context_disengage      // disengage a Context for this thread
+(
+    GxB_Context Context             // Context to disengage, or NULL for any
+) ;
+
+//      GxB_set (Context, GxB_NTHREADS, int nthreads_max) ;
+//      GxB_get (Context, GxB_NTHREADS, int *nthreads_max) ;
+//      GxB_set (Context, GxB_CHUNK, double chunk) ;
+//      GxB_get (Context, GxB_CHUNK, double *chunk) ;
+
 //------------------------------------------------------------------------------
 // GxB_set and GxB_get
 //------------------------------------------------------------------------------
@@ -4613,12 +4912,18 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_FORMAT, GxB_BY_COL) ;
 //      GxB_get (GxB_FORMAT, GxB_Format_Value *s) ;
 //
+//      GxB_set (GxB_INDEX_32, bool index32) ;
+//      GxB_get (GxB_INDEX_32, bool *index32) ;
+//
 //      GxB_set (GxB_NTHREADS, nthreads_max) ;
 //      GxB_get (GxB_NTHREADS, int *nthreads_max) ;
 //
 //      GxB_set (GxB_CHUNK, double chunk) ;
 //      GxB_get (GxB_CHUNK, double *chunk) ;
 //
+//      GxB_set (GxB_MEMORY_BUDGET, double bytes) ;
+//      GxB_get (GxB_MEMORY_BUDGET, double *bytes) ;
+//
 //      GxB_set (GxB_BURBLE, bool burble) ;
 //      GxB_get (GxB_BURBLE, bool *burble) ;
 //
@@ -4632,6 +4937,36 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_MEMORY_POOL, free_pool_limit) ;
 //      GxB_set (GxB_MEMORY_POOL, NULL) ;     // set defaults
 //      GxB_get (GxB_MEMORY_POOL, free_pool_limit) ;
+//
+//      int64_t stats [GxB_NMEMORY_POOL_STATS] ;
+//      GxB_get (GxB_MEMORY_POOL_STATS, stats) ;
+//
+//      GxB_set (GxB_MEMORY_POLICY, GxB_Memory_Policy_Value policy) ;
+//      GxB_get (GxB_MEMORY_POLICY, GxB_Memory_Policy_Value *policy) ;
+//
+//      GxB_set (GxB_HUGE_PAGE_THRESHOLD, int64_t bytes) ;
+//      GxB_get (GxB_HUGE_PAGE_THRESHOLD, int64_t *bytes) ;
+//
+//      int64_t stats [GxB_NPUSHPULL_STATS] ;
+//      GxB_get (GxB_PUSHPULL_STATS, stats) ;
+//      GxB_set (GxB_PUSHPULL_STATS, NULL) ;
+//
+//      GxB_set (GxB_JIT_C_CONTROL, bool jit_control) ;
+//      GxB_get (GxB_JIT_C_CONTROL, bool *jit_control) ;
+//
+//      GxB_set (GxB_JIT_C_COMPILER_NAME, char *compiler) ;
+//      GxB_get (GxB_JIT_C_COMPILER_NAME, char **compiler) ;
+//
+//      GxB_set (GxB_JIT_C_COMPILER_FLAGS, char *flags) ;
+//      GxB_get (GxB_JIT_C_COMPILER_FLAGS, char **flags) ;
+//
+//      GxB_set (GxB_JIT_CACHE_PATH, char *cache_path) ;
+//      GxB_get (GxB_JIT_CACHE_PATH, char **cache_path) ;
+//
+//      GxB_get (GxB_JIT_CACHE_HITS, int64_t *hits) ;
+//      GxB_get (GxB_JIT_CACHE_MISSES, int64_t *misses) ;
+//      GxB_get (GxB_JIT_COMPILE_TIME, double *compile_time) ;
+//      GxB_get (GxB_JIT_CACHE_BYTES, int64_t *bytes) ;
 
 // To get global options that can be queried but not modified:
 //
@@ -4656,6 +4991,21 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Matrix A, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_TRANSPOSE_CACHE, bool cache) ;
+//      GxB_get (GrB_Matrix A, GxB_TRANSPOSE_CACHE, bool *cache) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_DUAL_FORMAT, bool dual) ;
+//      GxB_get (GrB_Matrix A, GxB_DUAL_FORMAT, bool *dual) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_BITMAP_PACKED, bool packed) ;
+//      GxB_get (GrB_Matrix A, GxB_BITMAP_PACKED, bool *packed) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_INDEX_32, bool index32) ;
+//      GxB_get (GrB_Matrix A, GxB_INDEX_32, bool *index32) ;
+//
+//      GxB_set (GrB_Matrix C, GxB_AxB_PLAN, bool keep_plan) ;
+//      GxB_get (GrB_Matrix C, GxB_AxB_PLAN, bool *keep_plan) ;
 
 // To set/get a vector option or status:
 //
@@ -4671,6 +5021,12 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_CONTROL, int *scontrol) ;
 //
 //      GxB_get (GrB_Vector v, GxB_SPARSITY_STATUS, int *sparsity) ;
+//
+//      GxB_set (GrB_Vector v, GxB_BITMAP_PACKED, bool packed) ;
+//      GxB_get (GrB_Vector v, GxB_BITMAP_PACKED, bool *packed) ;
+//
+//      GxB_set (GrB_Vector v, GxB_INDEX_32, bool index32) ;
+//      GxB_get (GrB_Vector v, GxB_INDEX_32, bool *index32) ;
 
 // To set/get a descriptor field:
 //
@@ -4705,6 +5061,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GrB_Descriptor d, GxB_CHUNK, double chunk) ;
 //      GxB_get (GrB_Descriptor d, GxB_CHUNK, double *chunk) ;
 //
+//      GxB_set (GrB_Descriptor d, GxB_MEMORY_BUDGET, double bytes) ;
+//      GxB_get (GrB_Descriptor d, GxB_MEMORY_BUDGET, double *bytes) ;
+//
 //      GxB_set (GrB_Descriptor d, GxB_SORT, int sort) ;
 //      GxB_get (GrB_Descriptor d, GxB_SORT, int *sort) ;
 //
@@ -4723,7 +5082,8 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             GxB_Option_Field : GxB_Global_Option_set ,          \
             GrB_Vector       : GxB_Vector_Option_set ,          \
             GrB_Matrix       : GxB_Matrix_Option_set ,          \
-            GrB_Descriptor   : GxB_Desc_set                     \
+            GrB_Descriptor   : GxB_Desc_set          ,          \
+            GxB_Context      : GxB_Context_set                  \
     )                                                           \
     (arg1, __VA_ARGS__)
 
@@ -4740,7 +5100,9 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             const GrB_Matrix       : GxB_Matrix_Option_get ,    \
                   GrB_Matrix       : GxB_Matrix_Option_get ,    \
             const GrB_Descriptor   : GxB_Desc_get          ,    \
-                  GrB_Descriptor   : GxB_Desc_get               \
+                  GrB_Descriptor   : GxB_Desc_get          ,    \
+            const GxB_Context      : GxB_Context_get       ,    \
+                  GxB_Context      : GxB_Context_get            \
     )                                                           \
     (arg1, __VA_ARGS__)
 #endif
@@ -4769,6 +5131,7 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
             GrB_Vector       *: GrB_Vector_free       , \
             GrB_Matrix       *: GrB_Matrix_free       , \
             GrB_Descriptor   *: GrB_Descriptor_free   , \
+            GxB_Context      *: GxB_Context_free      , \
             GxB_Iterator     *: GxB_Iterator_free       \
     )                                                   \
     (object)
@@ -4918,6 +5281,75 @@ GrB_Info GrB_mxv                    // w<Mask> = accum (w, A*u)
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_mxm_reduce computes s = accum (s, reduce (C)), where C<M>=A*B, without
+// constructing C.  This is useful for computing a metric of a graph, such as
+// the number of triangles (s = sum (C) where C<L>=L*U' with the PLUS_PAIR
+// semiring), where C would otherwise be as large as the mask M and discarded
+// right after it is reduced.  The result is identical to GrB_mxm (C, M, NULL,
+// semiring, A, B, desc) followed by GrB_reduce (s, accum, monoid, C, NULL).
+// The descriptor can transpose A and/or B (GrB_INP0, GrB_INP1) and select a
+// structural mask (GrB_STRUCTURE).  The mask M is required.  C is not
+// constructed for the PLUS_PAIR semiring with the PLUS monoid (counting the
+// entries of C), or for a semiring with no precompiled or JIT kernel.
+// Otherwise, and if M is complemented (GrB_COMP) or the matrices are not in a
+// form the fused method can use directly, C is computed with the fastest
+// kernel for GrB_mxm and then reduced.
+
+GB_PUBLIC
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M,             // mask for C (required)
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+) ;
+
+// GxB_mxm_batch computes C=A*B one block of vectors at a time, for a result C
+// that is too large to be held in memory all at once.  Each block is passed to
+// the user function f as soon as it has been computed, and freed when f
+// returns, so the peak memory is bounded by the size of one block rather than
+// by nnz(C).  The blocks are held in the default format (GxB_FORMAT): if it is
+// GxB_BY_COL, each block is C(:,k:k+n-1) (an nrows(C)-by-n matrix), and
+// otherwise each block is C(k:k+n-1,:) (an n-by-ncols(C) matrix), where k is
+// passed to f.  Every column (or row) of C appears in exactly one block, in
+// increasing order.  The blocks are chosen so that their flop counts, which
+// bound their number of entries, fit in batch_size bytes (a single column or
+// row of C is never split, even if it exceeds the batch size).  If batch_size
+// is <= 0, half the memory budget (GxB_MEMORY_BUDGET) is used, leaving the
+// rest for the workspace of each block.  If there is no budget, C is computed
+// as a single block.
+//
+// The function f may take ownership of the block by setting (*C) to NULL; the
+// block is then not freed by GxB_mxm_batch.  Otherwise, it may use the block
+// in any way before returning, such as writing it to a file with
+// GxB_Matrix_serialize.  If f returns anything other than GrB_SUCCESS, the
+// computation stops and that value is returned.  The descriptor can transpose
+// A and/or B (GrB_INP0, GrB_INP1), and select the method (GxB_AxB_METHOD).  No
+// mask or accum operator can be used.
+
+typedef GrB_Info (*GxB_batch_function)
+(
+    GrB_Matrix *C,                  // block of C, may be taken by the function
+    GrB_Index k,                    // first column (or row) of C in the block
+    void *user_data                 // user_data passed to GxB_mxm_batch
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_mxm_batch              // C=A*B, passed to f one block at a time
+(
+    GxB_batch_function f,           // function to receive each block of C
+    void *user_data,                // passed to f, may be NULL
+    double batch_size,              // max bytes for each block of C
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for A and B
+) ;
+
 //==============================================================================
 // GrB_eWiseMult: element-wise matrix and vector operations, set intersection
 //==============================================================================
@@ -9751,6 +10183,15 @@ GrB_Info GxB_Descriptor_fprint      // print and check a GrB_Descriptor
     FILE *f                         // file for output
 ) ;
 
+GB_PUBLIC
+GrB_Info GxB_Context_fprint         // print and check a GxB_Context
+(
+    GxB_Context Context,            // object to print and check
+    const char *name,               // name of the object
+    GxB_Print_Level pr,             // print level
+    FILE *f                         // file for output
+) ;
+
 GB_PUBLIC
 GrB_Info GxB_Matrix_fprint          // print and check a GrB_Matrix
 (
@@ -9804,7 +10245,9 @@ GrB_Info GxB_Scalar_fprint          // print and check a GrB_Scalar
             const GrB_Matrix       : GxB_Matrix_fprint       ,  \
                   GrB_Matrix       : GxB_Matrix_fprint       ,  \
             const GrB_Descriptor   : GxB_Descriptor_fprint   ,  \
-                  GrB_Descriptor   : GxB_Descriptor_fprint      \
+                  GrB_Descriptor   : GxB_Descriptor_fprint   ,  \
+            const GxB_Context      : GxB_Context_fprint      ,  \
+                  GxB_Context      : GxB_Context_fprint         \
     )                                                           \
     (object, GB_STR(object), pr, f)
 
@@ -62,8 +62,10 @@
 #include "GB_zombie.h"
 #include "GB_partition.h"
 #include "GB_omp.h"
+#include "GB_deferred.h"
 #include "GB_context.h"
 #include "GB_nthreads.h"
+#include "GB_parallel_for.h"
 #include "GB_memory.h"
 #include "GB_werk.h"
 #include "GB_log2.h"
@@ -96,6 +98,7 @@
 #include "GB_convert.h"
 #include "GB_ops.h"
 #include "GB_cuda_gateway.h"
+#include "GB_fmv.h"
 
 #endif
 
@@ -13,7 +13,8 @@
 #include "GB_ek_slice.h"
 #include "GB_stringify.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 #include "GB_unused.h"
 
@@ -226,7 +227,7 @@ GrB_Info GB_AxB_colscale            // C = A*D, column scale with diagonal D
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_AxD(mult,xname) GB (_AxD_ ## mult ## xname)
+            #define GB_AxD(mult,xname) GB_FMV (_AxD_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                             \
             {                                                               \
@@ -36,9 +36,11 @@
 #include "GB_ek_slice.h"
 #include "GB_bitmap_assign_methods.h"
 #include "GB_stringify.h"
+#include "GB_AxB_jit.h"
 #include "GB_AxB__include1.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 
 GB_PUBLIC
@@ -427,7 +429,7 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
             //------------------------------------------------------------------
 
             #define GB_Adot2B(add,mult,xname) \
-                GB (_Adot2B_ ## add ## mult ## xname)
+                GB_FMV (_Adot2B_ ## add ## mult ## xname)
 
             #define GB_AxB_WORKER(add,mult,xname)                           \
             {                                                               \
@@ -455,6 +457,25 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<#M>=A'*B, dot product method
 
         #endif
 
+        //----------------------------------------------------------------------
+        // C = A'*B or A*B, using the dot product method, via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_AxB_dot2_jit (C, M, Mask_comp, Mask_struct,
+                A_not_transposed, A, A_slice, B, B_slice, semiring, flipxy,
+                nthreads, naslice, nbslice) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit C%s=A%s*B, C %s) ",
+                    (M == NULL) ? "" : (Mask_comp ? "<!M>" : "<M>"),
+                    A_not_transposed ? "" : "'",
+                    (C_sparsity == GxB_BITMAP) ? "bitmap" : "full") ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // C = A'*B or A*B, using the dot product method, with typecasting
         //----------------------------------------------------------------------
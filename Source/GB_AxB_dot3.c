@@ -14,9 +14,11 @@
 
 #include "GB_mxm.h"
 #include "GB_binop.h"
+#include "GB_AxB_jit.h"
 #include "GB_AxB__include1.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 #include "GB_unused.h"
 
@@ -279,7 +281,7 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
             //------------------------------------------------------------------
 
             #define GB_Adot3B(add,mult,xname) \
-                GB (_Adot3B_ ## add ## mult ## xname)
+                GB_FMV (_Adot3B_ ## add ## mult ## xname)
 
             #define GB_AxB_WORKER(add,mult,xname)                           \
             {                                                               \
@@ -304,6 +306,21 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
 
         #endif
 
+        //----------------------------------------------------------------------
+        // C<M> = A'*B, via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_AxB_dot3_jit (C, M, Mask_struct, A, B, semiring, flipxy,
+                TaskList, ntasks, nthreads) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit C<M>=A'*B) ") ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // C<M> = A'*B, via masked dot product method and typecasting
         //----------------------------------------------------------------------
@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_jit: C<M>=A'*B, dot3 method, via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_AxB_jit.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AxB_dot3_jit        // C<M>=A'*B, dot3 method, via the JIT
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_AxB_jit_enumify (&scode, C, M, Mask_struct, false, semiring,
+        flipxy, A, B))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_mxm_family,
+        "AxB_dot3", scode, semiring, NULL, NULL, C->type, A->type,
+        B->type) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (C, M, Mask_struct, A, B, TaskList, ntasks,
+        nthreads)) ;
+}
@@ -0,0 +1,452 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot3_reduce: s = reduce (C<M>=A*B), without constructing C
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The entries of C<M>=A*B are computed with the masked dot product method, as
+// in GB_AxB_dot3, except that C is not constructed.  Each entry C(i,j) is
+// reduced by the monoid into a scalar owned by the task that computes it, as
+// soon as it has been computed.  The scalars of all tasks are reduced to the
+// result s when done.  C(i,j) is computed only if M(i,j) is true, as the dot
+// product of the row A(i,:) and the column B(:,j), which are found as vectors
+// of A (or A') and B (or B').
+
+// If the semiring is PLUS_PAIR and the monoid is PLUS (as for counting the
+// triangles of a graph), with the same integer or double type, then C(i,j) is
+// the size of the intersection of the patterns of A(i,:) and B(:,j), and only
+// these sizes need to be summed.  Otherwise, the operators of the semiring and
+// the monoid are used via their function pointers, which is only done if
+// C<M>=A*B has no kernel in Generated2 and cannot be compiled by the JIT (a
+// user-defined semiring with no definitions, or one that requires typecasting,
+// for example).  If a factory or JIT kernel exists, GrB_NO_VALUE is returned,
+// and the caller computes C<M>=A*B with that kernel (via GB_mxm) and then
+// reduces C with the factory kernels of GB_reduce, which is much faster than
+// calling the operators for each entry, even though C is constructed.
+
+// The result s has the type of the monoid.  If C has no entries, s_exists is
+// returned as false and s is not modified.
+
+// M, A, and B must not have any pending work, and must be sparse or
+// hypersparse.  The multiply operator cannot be positional.  If these
+// conditions do not hold, GrB_NO_VALUE is returned and the caller must compute
+// C<M>=A*B and then reduce it.
+
+#include "GB_mxm.h"
+#include "GB_binop.h"
+#include "GB_jitifyer.h"
+#include "GB_transpose.h"
+#include "GB_ek_slice.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_WERK_POP (M_ek_slicing, int64_t) ;       \
+    GB_FREE_WORK (&Wx, Wx_size) ;               \
+    GB_FREE_WORK (&Wcount, Wcount_size) ;       \
+    GB_FREE_WORK (&Wexists, Wexists_size) ;     \
+    GB_Matrix_free (&AT) ;                      \
+    GB_Matrix_free (&BT) ;                      \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+GrB_Info GB_AxB_dot3_reduce         // s = reduce (C<M>=A*B), without C
+(
+    // output:
+    GB_void *s,                     // result, of type monoid->op->ztype
+    bool *s_exists,                 // true if C has at least one entry
+    // input:
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (s != NULL) ;
+    ASSERT (s_exists != NULL) ;
+    ASSERT_MONOID_OK (monoid, "monoid for dot3 reduce", GB0) ;
+    ASSERT_MATRIX_OK (M, "M for dot3 reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for dot3 reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for dot3 reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for dot3 reduce", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (M)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (B)) ;
+
+    (*s_exists) = false ;
+
+    struct GB_Matrix_opaque AT_header, BT_header ;
+    GrB_Matrix AT = NULL, BT = NULL ;
+    GB_WERK_DECLARE (M_ek_slicing, int64_t) ;
+    GB_void *restrict Wx = NULL ; size_t Wx_size = 0 ;
+    uint64_t *restrict Wcount = NULL ; size_t Wcount_size = 0 ;
+    bool *restrict Wexists = NULL ; size_t Wexists_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // check if the fused method can be used
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    if (!(GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ||
+        !(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ||
+        !(GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B)) ||
+        (M->iso && !Mask_struct) || GB_OP_IS_POSITIONAL (mult))
+    {
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the operators and types
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp add = semiring->add->op ;
+    GrB_BinaryOp reduce = monoid->op ;
+    GB_Type_code ccode = add->ztype->code ;
+    GB_Type_code zcode = reduce->ztype->code ;
+    size_t csize = add->ztype->size ;
+    size_t zsize = reduce->ztype->size ;
+
+    // C(i,j) is the number of terms in its dot product, and only the number
+    // of terms needs to be summed over all of C
+    bool count_only = (mult->opcode == GB_PAIR_binop_code)
+        && (add->opcode == GB_PLUS_binop_code)
+        && (reduce->opcode == GB_PLUS_binop_code)
+        && (ccode == zcode)
+        && ((ccode >= GB_INT8_code && ccode <= GB_UINT64_code)
+            || ccode == GB_FP64_code) ;
+
+    bool A_is_pattern, B_is_pattern ;
+    GB_binop_pattern (&A_is_pattern, &B_is_pattern, false, mult->opcode) ;
+    A_is_pattern = A_is_pattern || count_only ;
+    B_is_pattern = B_is_pattern || count_only ;
+
+    //--------------------------------------------------------------------------
+    // use GB_mxm and then reduce, if C<M>=A*B has a factory or JIT kernel
+    //--------------------------------------------------------------------------
+
+    if (!count_only)
+    {
+        bool has_kernel = false ;
+        #ifndef GBCUDA_DEV
+        GB_Opcode mult_binop_code, add_binop_code ;
+        GB_Type_code xcode, ycode, zcode_semiring ;
+        has_kernel = GB_AxB_semiring_builtin (A, A_is_pattern, B,
+            B_is_pattern, semiring, false, &mult_binop_code, &add_binop_code,
+            &xcode, &ycode, &zcode_semiring) ;
+        #endif
+        if (!has_kernel && GB_jitifyer_control_get ( ))
+        { 
+            // the same conditions as GB_AxB_jit_enumify
+            has_kernel = GB_JIT_OP_OK (mult) && GB_JIT_OP_OK (add)
+                && GB_JIT_TYPE_OK (mult->xtype) && GB_JIT_TYPE_OK (mult->ytype)
+                && GB_JIT_TYPE_OK (mult->ztype)
+                && (A_is_pattern || A->type == mult->xtype)
+                && (B_is_pattern || B->type == mult->ytype) ;
+        }
+        if (has_kernel)
+        { 
+            GBURBLE ("(mxm then reduce) ") ;
+            return (GrB_NO_VALUE) ;
+        }
+    }
+
+    GBURBLE ("(fused mxm+reduce) ") ;
+
+    //--------------------------------------------------------------------------
+    // get X and Y: the vectors of X are the rows of A, and of Y the columns
+    // of B
+    //--------------------------------------------------------------------------
+
+    // The rows of op(A) are the vectors of A if A is held by row and not
+    // transposed, or held by column and transposed.  Otherwise A is
+    // transposed.  B is handled in the same way.
+
+    GrB_Matrix X = A ;
+    if (A->is_csc != A_transpose)
+    {
+        GBURBLE ("(A transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+        GB_OK (GB_transpose_cast (AT, A->type, A->is_csc, A,
+            A_is_pattern && A->type->code != GB_UDT_code, Context)) ;
+        GB_OK (GB_convert_any_to_sparse (AT, Context)) ;
+        X = AT ;
+    }
+
+    GrB_Matrix Y = B ;
+    if (B->is_csc == B_transpose)
+    {
+        GBURBLE ("(B transpose) ") ;
+        GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
+        GB_OK (GB_transpose_cast (BT, B->type, B->is_csc, B,
+            B_is_pattern && B->type->code != GB_UDT_code, Context)) ;
+        GB_OK (GB_convert_any_to_sparse (BT, Context)) ;
+        Y = BT ;
+    }
+
+    const int64_t *restrict Xp = X->p ;
+    const int64_t *restrict Xh = X->h ;
+    const int64_t *restrict Xi = X->i ;
+    const GB_void *restrict Xx = (GB_void *) X->x ;
+    const int64_t xnvec = X->nvec ;
+    const int64_t xvlen = X->vlen ;
+    const bool X_is_hyper = GB_IS_HYPERSPARSE (X) ;
+    const bool X_iso = X->iso ;
+    const size_t xsize = X->type->size ;
+
+    const int64_t *restrict Yp = Y->p ;
+    const int64_t *restrict Yh = Y->h ;
+    const int64_t *restrict Yi = Y->i ;
+    const GB_void *restrict Yx = (GB_void *) Y->x ;
+    const int64_t ynvec = Y->nvec ;
+    const int64_t yvlen = Y->vlen ;
+    const bool Y_is_hyper = GB_IS_HYPERSPARSE (Y) ;
+    const bool Y_iso = Y->iso ;
+    const size_t ysize = Y->type->size ;
+
+    const int64_t *restrict Mp = M->p ;
+    const int64_t *restrict Mh = M->h ;
+    const int64_t *restrict Mi = M->i ;
+    const GB_void *restrict Mx = (GB_void *) (Mask_struct ? NULL : (M->x)) ;
+    const size_t msize = M->type->size ;
+    const int64_t mvlen = M->vlen ;
+    const bool M_is_csc = M->is_csc ;
+
+    GxB_binary_function fmult = mult->binop_function ;
+    GxB_binary_function fadd = add->binop_function ;
+    GxB_binary_function freduce = reduce->binop_function ;
+    size_t aki_size = mult->xtype->size ;
+    size_t bkj_size = mult->ytype->size ;
+    GB_cast_function cast_X = A_is_pattern ? NULL :
+        GB_cast_factory (mult->xtype->code, X->type->code) ;
+    GB_cast_function cast_Y = B_is_pattern ? NULL :
+        GB_cast_factory (mult->ytype->code, Y->type->code) ;
+    GB_cast_function cast_C = GB_cast_factory (zcode, ccode) ;
+
+    //--------------------------------------------------------------------------
+    // slice the entries of M and allocate the workspace
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    double work = (double) GB_nnz (M) + GB_nnz (X) + GB_nnz (Y) ;
+    int M_nthreads, M_ntasks ;
+    GB_SLICE_MATRIX_WORK (M, 32, chunk, work) ;
+
+    Wx = GB_MALLOC_WORK (M_ntasks * zsize, GB_void, &Wx_size) ;
+    Wcount = GB_MALLOC_WORK (M_ntasks, uint64_t, &Wcount_size) ;
+    Wexists = GB_MALLOC_WORK (M_ntasks, bool, &Wexists_size) ;
+    if (Wx == NULL || Wcount == NULL || Wexists == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // each task reduces the entries C(i,j) for its slice of M
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(M_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < M_ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t kfirst = kfirst_Mslice [tid] ;
+        int64_t klast  = klast_Mslice  [tid] ;
+        GB_void *restrict w = Wx + tid * zsize ;
+        uint64_t task_count = 0 ;
+        bool task_exists = false ;
+        GB_void aki [GB_VLA(aki_size)] ;
+        GB_void bkj [GB_VLA(bkj_size)] ;
+        GB_void t [GB_VLA(csize)] ;
+        GB_void cij [GB_VLA(csize)] ;
+        GB_void zij [GB_VLA(zsize)] ;
+
+        //----------------------------------------------------------------------
+        // reduce each entry C(i,j) for M(i,j) in this slice
+        //----------------------------------------------------------------------
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+            int64_t jM = GBH (Mh, k) ;
+            int64_t pM_start, pM_end ;
+            GB_get_pA (&pM_start, &pM_end, tid, k, kfirst, klast,
+                pstart_Mslice, Mp, mvlen) ;
+            for (int64_t pM = pM_start ; pM < pM_end ; pM++)
+            {
+                if (!GB_mcast (Mx, pM, msize)) continue ;
+
+                //--------------------------------------------------------------
+                // get the row A(i,:) and the column B(:,j)
+                //--------------------------------------------------------------
+
+                int64_t i = M_is_csc ? Mi [pM] : jM ;
+                int64_t j = M_is_csc ? jM : Mi [pM] ;
+                int64_t pleft = 0, pX, pX_end, pY, pY_end ;
+                if (!GB_lookup (X_is_hyper, Xh, Xp, xvlen, &pleft, xnvec-1, i,
+                    &pX, &pX_end)) continue ;
+                pleft = 0 ;
+                if (!GB_lookup (Y_is_hyper, Yh, Yp, yvlen, &pleft, ynvec-1, j,
+                    &pY, &pY_end)) continue ;
+                int64_t xknz = pX_end - pX ;
+                int64_t yknz = pY_end - pY ;
+                if (xknz == 0 || yknz == 0 ||
+                    Xi [pX_end-1] < Yi [pY] || Yi [pY_end-1] < Xi [pX])
+                {
+                    // the intersection is empty
+                    continue ;
+                }
+                // use a binary search to skip ahead in a much longer list
+                bool X_skip = (xknz > 32 * yknz) ;
+                bool Y_skip = (yknz > 32 * xknz) ;
+
+                //--------------------------------------------------------------
+                // cij = A(i,:)*B(:,j)
+                //--------------------------------------------------------------
+
+                bool cij_exists = false ;
+                while (pX < pX_end && pY < pY_end)
+                {
+                    int64_t ix = Xi [pX] ;
+                    int64_t iy = Yi [pY] ;
+                    if (ix < iy)
+                    {
+                        // A(i,ix) appears before B(iy,j)
+                        pX++ ;
+                        if (X_skip)
+                        {
+                            int64_t pright = pX_end - 1 ;
+                            GB_TRIM_BINARY_SEARCH (iy, Xi, pX, pright) ;
+                        }
+                    }
+                    else if (iy < ix)
+                    {
+                        // B(iy,j) appears before A(i,ix)
+                        pY++ ;
+                        if (Y_skip)
+                        {
+                            int64_t pright = pY_end - 1 ;
+                            GB_TRIM_BINARY_SEARCH (ix, Yi, pY, pright) ;
+                        }
+                    }
+                    else if (count_only)
+                    {
+                        // cij += 1
+                        task_count++ ;
+                        cij_exists = true ;
+                        pX++ ;
+                        pY++ ;
+                    }
+                    else
+                    {
+                        // cij += A(i,k) * B(k,j)
+                        if (!A_is_pattern)
+                        {
+                            cast_X (aki, Xx + (X_iso ? 0 : pX*xsize), xsize) ;
+                        }
+                        if (!B_is_pattern)
+                        {
+                            cast_Y (bkj, Yx + (Y_iso ? 0 : pY*ysize), ysize) ;
+                        }
+                        if (cij_exists)
+                        {
+                            fmult (t, aki, bkj) ;
+                            fadd (cij, cij, t) ;
+                        }
+                        else
+                        {
+                            fmult (cij, aki, bkj) ;
+                            cij_exists = true ;
+                        }
+                        pX++ ;
+                        pY++ ;
+                    }
+                }
+
+                //--------------------------------------------------------------
+                // w = reduce (w, cij)
+                //--------------------------------------------------------------
+
+                if (cij_exists && !count_only)
+                {
+                    cast_C (zij, cij, csize) ;
+                    if (task_exists)
+                    {
+                        freduce (w, w, zij) ;
+                    }
+                    else
+                    {
+                        memcpy (w, zij, zsize) ;
+                    }
+                }
+                task_exists = task_exists || cij_exists ;
+            }
+        }
+
+        Wcount [tid] = task_count ;
+        Wexists [tid] = task_exists ;
+    }
+
+    //--------------------------------------------------------------------------
+    // s = reduce (W)
+    //--------------------------------------------------------------------------
+
+    if (count_only)
+    {
+        uint64_t count = 0 ;
+        bool exists = false ;
+        for (tid = 0 ; tid < M_ntasks ; tid++)
+        {
+            count += Wcount [tid] ;
+            exists = exists || Wexists [tid] ;
+        }
+        if (exists)
+        {
+            GB_cast_function cast_count = GB_cast_factory (zcode,
+                GB_UINT64_code) ;
+            cast_count (s, &count, sizeof (uint64_t)) ;
+            (*s_exists) = true ;
+        }
+    }
+    else
+    {
+        for (tid = 0 ; tid < M_ntasks ; tid++)
+        {
+            if (!Wexists [tid]) continue ;
+            if (*s_exists)
+            {
+                freduce (s, s, Wx + tid * zsize) ;
+            }
+            else
+            {
+                memcpy (s, Wx + tid * zsize, zsize) ;
+                (*s_exists) = true ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
+
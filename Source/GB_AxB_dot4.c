@@ -23,7 +23,8 @@
 #include "GB_binop.h"
 #include "GB_unused.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE               \
@@ -217,7 +218,7 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
 
     info = GrB_NO_VALUE ;
 
-    #define GB_Adot4B(add,mult,xname) GB (_Adot4B_ ## add ## mult ## xname)
+    #define GB_Adot4B(add,mult,xname) GB_FMV (_Adot4B_ ## add ## mult ## xname)
     #define GB_AxB_WORKER(add,mult,xname)                           \
     {                                                               \
         info = GB_Adot4B (add,mult,xname) (C, A, A_slice, naslice,  \
@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GB_AxB_dot_intersect.h: intersection of two sorted lists of indices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_intersect_block finds the next pair of blocks Ai [pA:pA+w-1] and
+// Bi [pB:pB+w-1] that have at least one index in common, where Ai and Bi are
+// the sorted row indices of two sparse vectors A(:,i) and B(:,j), with no
+// duplicates, and w = GB_intersect_width (method) is 4 for AVX2 or 8 for
+// AVX512F.  On input, pA and pB are the first entries to consider.  On
+// output, they are advanced to the start of the two blocks, and the result is
+// a bit mask: bit t is set if Ai [pA+t] appears in Bi [pB:pB+w-1].  The
+// result is zero if fewer than w entries remain in either vector, in which
+// case the remaining entries are left for the caller to merge.  This is used
+// by GB_AxB_dot_cij.c for the dot product of two sparse vectors of similar
+// sparsity, when both are long enough for SIMD to be of use.
+
+// Each pair of blocks is compared all at once, by comparing the block of A
+// with each rotation of the block of B.  If no pair matches, the block with
+// the smaller last index is discarded (or both, if their last indices are
+// equal).  The caller does the same after using the matches in the blocks.
+
+// The method is selected at run time by GB_intersect_method, with
+// GB_Global_cpu_features_avx512f and GB_Global_cpu_features_avx2.  On any
+// other architecture, GB_intersect_block returns zero and the caller does
+// the entire scalar merge.
+
+#ifndef GB_AXB_DOT_INTERSECT_H
+#define GB_AXB_DOT_INTERSECT_H
+
+#if GB_COMPILER_SUPPORTS_AVX2 || GB_COMPILER_SUPPORTS_AVX512F
+#include <immintrin.h>
+#endif
+
+// SIMD is used only if both vectors have at least this many entries
+#define GB_INTERSECT_SIMD_MIN 16
+
+#define GB_INTERSECT_SCALAR  0
+#define GB_INTERSECT_AVX2    1
+#define GB_INTERSECT_AVX512F 2
+
+//------------------------------------------------------------------------------
+// GB_intersect_avx2: compare blocks of 4 indices with AVX2
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX2
+
+GB_TARGET_AVX2 static inline int GB_intersect_avx2
+(
+    const int64_t *restrict Ai, int64_t *pA_handle, const int64_t pA_end,
+    const int64_t *restrict Bi, int64_t *pB_handle, const int64_t pB_end
+)
+{
+    int64_t pA = (*pA_handle) ;
+    int64_t pB = (*pB_handle) ;
+    while (pA + 4 <= pA_end && pB + 4 <= pB_end)
+    {
+        // compare Ai [pA:pA+3] with all rotations of Bi [pB:pB+3]
+        __m256i a  = _mm256_loadu_si256 ((const __m256i *) (Ai + pA)) ;
+        __m256i b0 = _mm256_loadu_si256 ((const __m256i *) (Bi + pB)) ;
+        __m256i b1 = _mm256_permute4x64_epi64 (b0, 0x39) ;
+        __m256i b2 = _mm256_permute4x64_epi64 (b0, 0x4E) ;
+        __m256i b3 = _mm256_permute4x64_epi64 (b0, 0x93) ;
+        __m256i e01 = _mm256_or_si256 (_mm256_cmpeq_epi64 (a, b0),
+                                       _mm256_cmpeq_epi64 (a, b1)) ;
+        __m256i e23 = _mm256_or_si256 (_mm256_cmpeq_epi64 (a, b2),
+                                       _mm256_cmpeq_epi64 (a, b3)) ;
+        int mask = _mm256_movemask_pd (_mm256_castsi256_pd (
+            _mm256_or_si256 (e01, e23))) ;
+        if (mask != 0)
+        { 
+            // at least one index appears in both blocks
+            (*pA_handle) = pA ;
+            (*pB_handle) = pB ;
+            return ((int) mask) ;
+        }
+        // discard the block(s) with the smaller last index
+        int64_t alast = Ai [pA+3] ;
+        int64_t blast = Bi [pB+3] ;
+        pA += (alast <= blast) ? 4 : 0 ;
+        pB += (blast <= alast) ? 4 : 0 ;
+    }
+    // fewer than 4 entries remain in A(:,i) or B(:,j)
+    (*pA_handle) = pA ;
+    (*pB_handle) = pB ;
+    return (0) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_intersect_avx512f: compare blocks of 8 indices with AVX512F
+//------------------------------------------------------------------------------
+
+#if GB_COMPILER_SUPPORTS_AVX512F
+
+GB_TARGET_AVX512F static inline int GB_intersect_avx512f
+(
+    const int64_t *restrict Ai, int64_t *pA_handle, const int64_t pA_end,
+    const int64_t *restrict Bi, int64_t *pB_handle, const int64_t pB_end
+)
+{
+    int64_t pA = (*pA_handle) ;
+    int64_t pB = (*pB_handle) ;
+    while (pA + 8 <= pA_end && pB + 8 <= pB_end)
+    {
+        // compare Ai [pA:pA+7] with all rotations of Bi [pB:pB+7]
+        __m512i a = _mm512_loadu_si512 ((const void *) (Ai + pA)) ;
+        __m512i b = _mm512_loadu_si512 ((const void *) (Bi + pB)) ;
+        __mmask8 mask = _mm512_cmpeq_epi64_mask (a, b) ;
+        for (int r = 1 ; r < 8 ; r++)
+        { 
+            b = _mm512_alignr_epi64 (b, b, 1) ;
+            mask |= _mm512_cmpeq_epi64_mask (a, b) ;
+        }
+        if (mask != 0)
+        { 
+            // at least one index appears in both blocks
+            (*pA_handle) = pA ;
+            (*pB_handle) = pB ;
+            return ((int) mask) ;
+        }
+        // discard the block(s) with the smaller last index
+        int64_t alast = Ai [pA+7] ;
+        int64_t blast = Bi [pB+7] ;
+        pA += (alast <= blast) ? 8 : 0 ;
+        pB += (blast <= alast) ? 8 : 0 ;
+    }
+    // fewer than 8 entries remain in A(:,i) or B(:,j)
+    (*pA_handle) = pA ;
+    (*pB_handle) = pB ;
+    return (0) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_intersect_method: select the method for this CPU
+//------------------------------------------------------------------------------
+
+static inline int GB_intersect_method (void)
+{
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (GB_Global_cpu_features_avx512f ( ))
+    { 
+        return (GB_INTERSECT_AVX512F) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (GB_Global_cpu_features_avx2 ( ))
+    { 
+        return (GB_INTERSECT_AVX2) ;
+    }
+    #endif
+    return (GB_INTERSECT_SCALAR) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_width: block size of the selected method
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_intersect_width (const int method)
+{
+    return ((method == GB_INTERSECT_AVX512F) ? 8 : 4) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_intersect_block: find the next pair of blocks with a match
+//------------------------------------------------------------------------------
+
+static inline int GB_intersect_block
+(
+    const int method,
+    const int64_t *restrict Ai, int64_t *pA_handle, const int64_t pA_end,
+    const int64_t *restrict Bi, int64_t *pB_handle, const int64_t pB_end
+)
+{
+    #if GB_COMPILER_SUPPORTS_AVX512F
+    if (method == GB_INTERSECT_AVX512F)
+    { 
+        return (GB_intersect_avx512f (Ai, pA_handle, pA_end,
+            Bi, pB_handle, pB_end)) ;
+    }
+    #endif
+    #if GB_COMPILER_SUPPORTS_AVX2
+    if (method == GB_INTERSECT_AVX2)
+    { 
+        return (GB_intersect_avx2 (Ai, pA_handle, pA_end,
+            Bi, pB_handle, pB_end)) ;
+    }
+    #endif
+    return (0) ;
+}
+
+#endif
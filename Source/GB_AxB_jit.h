@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_AxB_jit.h: definitions for the CPU JIT kernels for C=A*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// These methods are used when no pre-compiled kernel in Generated2/ applies.
+// Each returns GrB_NO_VALUE if the JIT cannot handle the problem (the JIT is
+// disabled, typecasting is required, a user-defined type or operator has no
+// definition, or the kernel fails to compile), in which case the caller uses
+// its generic method.
+
+#ifndef GB_AXB_JIT_H
+#define GB_AXB_JIT_H
+#include "GB_AxB_saxpy.h"
+#include "GB_jitifyer.h"
+
+bool GB_AxB_jit_enumify     // enumify a C=A*B problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GrB_Matrix A,
+    const GrB_Matrix B
+) ;
+
+GrB_Info GB_AxB_dot2_jit        // C<#M>=A'*B, dot2 method, via the JIT
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool A_not_transposed,
+    const GrB_Matrix A, int64_t *restrict A_slice,
+    const GrB_Matrix B, int64_t *restrict B_slice,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    int nthreads, int naslice, int nbslice
+) ;
+
+GrB_Info GB_AxB_dot3_jit        // C<M>=A'*B, dot3 method, via the JIT
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AxB_saxpy_jit       // C<#M>=A*B, saxpy3 or bitmap, via the JIT
+(
+    GrB_Matrix C,                   // any sparsity
+    const GrB_Matrix M,
+    bool Mask_comp,
+    const bool Mask_struct,
+    const bool M_in_place,          // ignored if C is bitmap
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int saxpy_method,         // saxpy3 or bitmap method
+    // for saxpy3 only:
+    GB_saxpy3task_struct *restrict SaxpyTasks, // NULL if C is bitmap
+    int ntasks,
+    int nfine,
+    int nthreads,
+    const int do_sort,              // if true, sort in saxpy3
+    GB_Context Context
+) ;
+
+#endif
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// GB_AxB_jit_enumify: enumify a C=A*B problem for the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if the JIT can handle C=A*B, and the scode of the problem.
+// The parts of the scode that the JIT kernels handle at run time (the
+// sparsity structures of C, M, A, and B, the mask, and the iso properties of
+// A and B) are cleared, so that one kernel handles all of these cases.
+
+#include "GB_AxB_jit.h"
+
+bool GB_AxB_jit_enumify     // enumify a C=A*B problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Semiring semiring,
+    const bool flipxy,
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the JIT can handle this semiring
+    //--------------------------------------------------------------------------
+
+    if (!GB_jitifyer_control_get ( ) || C->iso)
+    { 
+        return (false) ;
+    }
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_BinaryOp add  = semiring->add->op ;
+    GB_Opcode mult_opcode = mult->opcode ;
+    if (GB_OPCODE_IS_POSITIONAL (mult_opcode) || C->type != mult->ztype
+        || !GB_JIT_OP_OK (mult) || !GB_JIT_OP_OK (add)
+        || !GB_JIT_TYPE_OK (mult->xtype) || !GB_JIT_TYPE_OK (mult->ytype)
+        || !GB_JIT_TYPE_OK (mult->ztype))
+    { 
+        return (false) ;
+    }
+
+    // FIRST, SECOND, and PAIR are unflipped by GB_AxB_meta
+    if (flipxy && (mult_opcode == GB_FIRST_binop_code ||
+        mult_opcode == GB_SECOND_binop_code ||
+        mult_opcode == GB_PAIR_binop_code))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the problem
+    //--------------------------------------------------------------------------
+
+    GB_enumify_mxm (scode, false, GB_sparsity (C), C->type, M, Mask_struct,
+        Mask_comp, semiring, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // A and B must not be typecasted, unless their values are not accessed
+    //--------------------------------------------------------------------------
+
+    bool A_is_pattern = (GB_RSHIFT ((*scode), 12, 4) == 0) ;
+    bool B_is_pattern = (GB_RSHIFT ((*scode),  8, 4) == 0) ;
+    GrB_Type a2type = flipxy ? mult->ytype : mult->xtype ;
+    GrB_Type b2type = flipxy ? mult->xtype : mult->ytype ;
+    if ((!A_is_pattern && A->type != a2type) ||
+        (!B_is_pattern && B->type != b2type))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // clear the parts of the scode handled at run time
+    //--------------------------------------------------------------------------
+
+    (*scode) &= ~(GB_LSHIFT (0x3, 45)       // A_iso and B_iso
+                | GB_LSHIFT (0xF, 20)       // mask
+                | GB_LSHIFT (0xFF, 0)) ;    // sparsity of C, M, A, and B
+    return (true) ;
+}
@@ -38,6 +38,91 @@
 #include "GB_mxm.h"
 #include "GB_transpose.h"
 
+//------------------------------------------------------------------------------
+// GB_AxB_meta_dot3_fits: check if dot3 can be used when saxpy is over budget
+//------------------------------------------------------------------------------
+
+// If saxpy has failed because it would exceed the memory budget, the masked
+// dot product (dot3) can be used instead, if the mask is present and not
+// complemented, and if dot3 fits in the budget.  C has the same pattern as M,
+// and A' must be computed for dot3 if A is not already transposed.  If dot3
+// does not fit, Context->memory_peak is revised to the smaller of the two
+// estimates.
+
+static bool GB_AxB_meta_dot3_fits
+(
+    GrB_Info info,                  // result from GB_AxB_saxpy
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const bool A_transpose_needed,  // if true, dot3 must compute A'
+    const GrB_Semiring semiring,
+    GB_Context Context
+)
+{
+    if (info != GrB_OUT_OF_MEMORY || Context == NULL ||
+        Context->memory_peak <= 0 || !GB_AxB_dot3_control (M, Mask_comp))
+    { 
+        return (false) ;
+    }
+    GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
+    size_t csize = semiring->add->op->ztype->size ;
+    double peak = ((double) GB_nnz_held (M)) * (sizeof (int64_t) + csize)
+        + (double) (M->p_size + M->h_size) ;
+    if (A_transpose_needed)
+    { 
+        peak += ((double) GB_nnz_held (A)) * (sizeof (int64_t) + A->type->size)
+            + ((double) (A->vlen + 1)) * sizeof (int64_t) ;
+    }
+    if (peak > memory_budget)
+    { 
+        Context->memory_peak = GB_IMIN (Context->memory_peak, peak) ;
+        return (false) ;
+    }
+    GBURBLE ("(over budget: use masked dot_product) ") ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_meta_transpose: AT = A', or AT = one (A'), using the cached transpose
+//------------------------------------------------------------------------------
+
+// If the transpose of A has been cached (see GB_transpose_cache_get), and no
+// typecasting is needed, then AT is a purely shallow copy of A->T.  Otherwise
+// AT = A' is computed with GB_transpose_cast.
+
+static GrB_Info GB_AxB_meta_transpose
+(
+    GrB_Matrix AT,                  // output matrix (static header)
+    const GrB_Type atype_cast,      // type of AT, if computed
+    const GrB_Matrix A,             // matrix to transpose
+    const bool A_is_pattern,        // if true, only the pattern of A is used
+    GB_Context Context
+)
+{
+    GrB_Matrix T = NULL ;
+    if (A_is_pattern || atype_cast == A->type)
+    {
+        GrB_Info info = GB_transpose_cache_get (&T, A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
+    if (T != NULL)
+    { 
+        GBURBLE ("(cached transpose) ") ;
+        return (GB_shallow_copy (AT, true, T, Context)) ;
+    }
+    return (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
+        Context)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_meta
+//------------------------------------------------------------------------------
+
 GB_PUBLIC
 GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 (
@@ -273,6 +358,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // transpose C when this function is done.
 
     bool swap_rule = false ;
+    int pushpull = 0 ;          // push/pull selection for C=A'*b, if any
     int A_in_is_diagonal = -1 ;            // not yet computed
     int B_in_is_diagonal = -1 ;            // not yet computed
 
@@ -388,7 +474,21 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             Mask_comp, A_in, B_in, accum, semiring_in, flipxy, can_do_in_place,
             allow_scale, B_in_is_diagonal, AxB_method, Context) ;
 
-        if (tentative_axb_method == GB_USE_SAXPY)
+        if (AxB_method == GxB_DEFAULT &&
+            (tentative_axb_method == GB_USE_DOT ||
+             tentative_axb_method == GB_USE_SAXPY))
+        { 
+            // if B is a single vector b, select push or pull for C=A'*b
+            pushpull = GB_AxB_meta_pushpull (M_in, Mask_comp, A_in, true,
+                B_in, semiring_in, Context) ;
+        }
+
+        if (pushpull != 0)
+        { 
+            // C=A'*b is computed as-is, by push (saxpy with A') or pull (dot)
+            swap_rule = false ;
+        }
+        else if (tentative_axb_method == GB_USE_SAXPY)
         { 
             // reconsider and use swap rule if saxpy C=(A')*B is too expensive.
             // C=(A')*B is either computed as-is, requiring a transpose of A,
@@ -477,13 +577,25 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     GrB_Matrix M ;
 
     if (M_transpose && M_in != NULL)
-    { 
+    {
         // MT = M_in' also typecasting to boolean.  It is not freed here
         // unless an error occurs, but is returned to the caller.
         // If Mask_struct is true, MT = one(M') is iso.
-        GBURBLE ("(M transpose) ") ;
-        GB_OK (GB_transpose_cast (MT, GrB_BOOL, C_is_csc, M_in, Mask_struct,
-            Context)) ;
+        GrB_Matrix T = NULL ;
+        GB_OK (GB_transpose_cache_get (&T, M_in, Context)) ;
+        if (T != NULL)
+        { 
+            // MT is a purely shallow copy of the cached transpose of M_in.
+            // It keeps the type of M_in, which is valid for any mask.
+            GBURBLE ("(M cached transpose) ") ;
+            GB_OK (GB_shallow_copy (MT, C_is_csc, T, Context)) ;
+        }
+        else
+        { 
+            GBURBLE ("(M transpose) ") ;
+            GB_OK (GB_transpose_cast (MT, GrB_BOOL, C_is_csc, M_in,
+                Mask_struct, Context)) ;
+        }
         M = MT ;
         (*M_transposed) = true ;
     }
@@ -585,7 +697,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // converted to C=(B*A)' and C=B*A, respectively.  It is left here
             // in case the swap_rule changes.
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
+            GB_OK (GB_AxB_meta_transpose (BT, btype_cast, B, B_is_pattern,
                 Context)) ;
             B = BT ;
         }
@@ -598,6 +710,22 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             Mask_comp, A, B, accum, semiring, flipxy, can_do_in_place,
             allow_scale, B_is_diagonal, AxB_method, Context) ;
 
+        if (AxB_method == GxB_DEFAULT && !btrans &&
+            (axb_method == GB_USE_DOT || axb_method == GB_USE_SAXPY))
+        {
+            // C<M>=A'*b: select pull (dot) or push (saxpy with A'), if not
+            // already selected above
+            if (pushpull == 0)
+            { 
+                pushpull = GB_AxB_meta_pushpull (M, Mask_comp, A, true, B,
+                    semiring, Context) ;
+            }
+            if (pushpull != 0)
+            { 
+                axb_method = pushpull ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // AT = A'
         //----------------------------------------------------------------------
@@ -606,7 +734,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // AT = A', or AT=one(A') if only the pattern is needed.
             GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-            GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
+            GB_OK (GB_AxB_meta_transpose (AT, atype_cast, A, A_is_pattern,
                 Context)) ;
             // do not use colscale if AT is now bitmap
             if (GB_IS_BITMAP (AT))
@@ -647,10 +775,19 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             default : 
                 // C = A'*B via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A'*B, saxpy (transposed %s) ", M_str, A_str) ;
-                GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
+                info = GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
                     mask_applied, done_in_place, AxB_method, do_sort,
-                    Context)) ;
+                    Context) ;
+                if (GB_AxB_meta_dot3_fits (info, M, Mask_comp, A, false,
+                    semiring, Context))
+                { 
+                    // C<M>=A'*B via dot3 instead, with the original A
+                    GB_Matrix_free (&AT) ;
+                    info = GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
+                        M, Mask_comp, Mask_struct, accum, A, B, semiring,
+                        flipxy, mask_applied, done_in_place, Context) ;
+                }
                 break ;
         }
 
@@ -692,7 +829,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
-            GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
+            GB_OK (GB_AxB_meta_transpose (BT, btype_cast, B, B_is_pattern,
                 Context)) ;
             // do not use rowscale if BT is now bitmap
             if (axb_method == GB_USE_ROWSCALE && GB_IS_BITMAP (BT))
@@ -726,7 +863,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) "
                     "(transposed %s) ", M_str, A_str, B_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
+                GB_OK (GB_AxB_meta_transpose (AT, atype_cast, A, A_is_pattern,
                     Context)) ;
                 GB_OK (GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
                     M, Mask_comp, Mask_struct, accum, AT, BT, semiring, flipxy,
@@ -736,10 +873,21 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             default : 
                 // C = A*B' via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
-                GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
+                info = GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, BT, semiring, flipxy,
                     mask_applied, done_in_place, AxB_method, do_sort,
-                    Context)) ;
+                    Context) ;
+                if (GB_AxB_meta_dot3_fits (info, M, Mask_comp, A, true,
+                    semiring, Context))
+                { 
+                    // C<M>=A*B' via dot3 instead
+                    GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+                    GB_OK (GB_AxB_meta_transpose (AT, atype_cast, A,
+                        A_is_pattern, Context)) ;
+                    info = GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
+                        M, Mask_comp, Mask_struct, accum, AT, BT, semiring,
+                        flipxy, mask_applied, done_in_place, Context) ;
+                }
                 break ;
         }
 
@@ -789,11 +937,12 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // dot product instead.
                 int ignore, saxpy_method ;
                 GB_AxB_saxpy_sparsity (&ignore, &saxpy_method, M, Mask_comp,
-                    A, B, Context) ;
-                if (saxpy_method == GB_SAXPY_METHOD_BITMAP)
+                    A, B, semiring, Context) ;
+                if (saxpy_method == GB_SAXPY_METHOD_BITMAP
+                ||  saxpy_method == GB_SAXPY_METHOD_BITWISE)
                 { 
                     // bitmap = hyper * (bitmap or full) is very efficient
-                    // to do via GB_bitmap_AxB_saxpy.
+                    // to do via GB_bitmap_AxB_saxpy or GB_AxB_saxpy_bitwise.
                     axb_method = GB_USE_SAXPY ;
                 }
                 else
@@ -808,6 +957,19 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // otherwise, always use GB_AxB_saxpy
                 axb_method = GB_USE_SAXPY ;
             }
+            // C<M>=A*b: select push (saxpy) or pull (dot with A')
+            pushpull = GB_AxB_meta_pushpull (M, Mask_comp, A, false, B,
+                semiring, Context) ;
+            if (pushpull != 0)
+            { 
+                axb_method = pushpull ;
+            }
+            if (axb_method == GB_USE_SAXPY &&
+                GB_AxB_msa_control (M, Mask_comp, A, B))
+            { 
+                // C<M>=A*B via saxpy3, in the pattern of the sparse mask M
+                AxB_method = GB_AxB_MSA ;
+            }
         }
 
         //----------------------------------------------------------------------
@@ -833,7 +995,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) ",
                     M_str, A_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
-                GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
+                GB_OK (GB_AxB_meta_transpose (AT, atype_cast, A, A_is_pattern,
                     Context)) ;
                 GB_OK (GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
                     M, Mask_comp, Mask_struct, accum, AT, B, semiring, flipxy,
@@ -843,14 +1005,43 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             default : 
                 // C = A*B via saxpy: Gustavson + Hash method
                 GBURBLE ("C%s=A*B, saxpy ", M_str) ;
-                GB_OK (GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
+                info = GB_AxB_saxpy (C, can_do_in_place ? C_in : NULL, M,
                     Mask_comp, Mask_struct, accum, A, B, semiring, flipxy,
                     mask_applied, done_in_place, AxB_method, do_sort,
-                    Context)) ;
+                    Context) ;
+                if (GB_AxB_meta_dot3_fits (info, M, Mask_comp, A, true,
+                    semiring, Context))
+                { 
+                    // C<M>=A*B via dot3 instead
+                    GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+                    GB_OK (GB_AxB_meta_transpose (AT, atype_cast, A,
+                        A_is_pattern, Context)) ;
+                    info = GB_AxB_dot (C, (can_do_in_place) ? C_in : NULL,
+                        M, Mask_comp, Mask_struct, accum, AT, B, semiring,
+                        flipxy, mask_applied, done_in_place, Context) ;
+                }
                 break ;
         }
     }
 
+    //--------------------------------------------------------------------------
+    // check if the method has exceeded the memory budget
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_OUT_OF_MEMORY && Context != NULL &&
+        Context->memory_peak > 0)
+    { 
+        // No method can compute C within the memory budget.  GB_mxm_batch is
+        // not tried, since it returns C one block at a time to a callback,
+        // and C must be returned here as a single matrix.
+        GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
+        GB_FREE_ALL ;
+        GB_ERROR (GrB_OUT_OF_MEMORY, "estimated peak memory %g bytes exceeds "
+            "the memory budget of %g bytes", Context->memory_peak,
+            memory_budget) ;
+    }
+    GB_OK (info) ;
+
     if (*M_transposed) { GBURBLE ("(M transposed) ") ; }
     if ((M != NULL) && !(*mask_applied)) { GBURBLE ("(mask later) ") ; }
 
@@ -83,8 +83,15 @@ void GB_AxB_meta_adotb_control
         }
         else if (GB_AxB_dot2_control (A, B, Context))
         { 
-            // C=A'*B or C<!M>=A'B* can efficiently use the dot2 method
-            (*axb_method) = GB_USE_DOT ;
+            // C=A'*B or C<!M>=A'B* can efficiently use the dot2 method,
+            // unless its bitmap C would exceed the memory budget
+            GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
+            size_t csize = semiring->add->op->ztype->size ;
+            double cnzmax = ((double) A->vdim) * ((double) B->vdim) ;
+            if (memory_budget <= 0 || cnzmax * (1 + csize) <= memory_budget)
+            { 
+                (*axb_method) = GB_USE_DOT ;
+            }
         }
     }
     else if (AxB_method == GxB_AxB_DOT)
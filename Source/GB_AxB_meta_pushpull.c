@@ -0,0 +1,197 @@
+//------------------------------------------------------------------------------
+// GB_AxB_meta_pushpull: select push (saxpy) or pull (dot) for C=A*b or A'*b
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// When B is a single vector b (GrB_mxv and GrB_vxm), C<M>=A*b or C<M>=A'*b can
+// be computed in two ways, as in a direction-optimizing BFS:
+
+//  push (saxpy): C = sum of A(:,k)*b(k) for each entry b(k), taking the sum
+//      of the degrees of the vectors of A selected by the pattern of b.
+//
+//  pull (dot): C(i) = A(:,i)'*b for each entry of C permitted by the mask,
+//      taking the sum of the degrees of those vectors.  If the monoid has a
+//      terminal value (LOR, ANY, MIN, ...) each dot product can exit early,
+//      so its work is reduced by GB_PUSHPULL_ALPHA (Beamer's heuristic).
+
+// For C=A*b, push uses A as-is and pull requires A'; for C=A'*b, pull uses A
+// as-is and push requires A'.  The degrees of A' are taken from the cached
+// transpose A->T, if present (see GxB_TRANSPOSE_CACHE and GxB_DUAL_FORMAT);
+// otherwise they are estimated from nnz(A), and the work to transpose A is
+// added to that method.  This work is GB_PUSHPULL_TRANSPOSE per entry of A,
+// since each entry is read and then written to A'.
+
+// The result is GB_USE_SAXPY or GB_USE_DOT, or zero if the cost model does
+// not apply (A is bitmap or full, or B is not a single vector), in which case
+// the method is selected by the caller as usual.  The choice is reported by
+// the burble, and counted in the statistics returned by
+// GxB_get (GxB_PUSHPULL_STATS, stats).
+
+#include "GB_mxm.h"
+
+// sum of the degrees of the vectors of X in the pattern of S, or not in the
+// pattern of S if S_comp is true (all vectors if S is NULL)
+static double GB_pushpull_degrees
+(
+    const GrB_Matrix X,         // sparse or hypersparse matrix
+    const GrB_Matrix S,         // single vector of length X->vdim, or NULL
+    const bool S_comp
+)
+{
+    double xnz = (double) GB_nnz (X) ;
+    if (S == NULL)
+    {
+        return (S_comp ? 0 : xnz) ;
+    }
+    const int64_t *restrict Xp = X->p ;
+    const int64_t *restrict Xh = X->h ;
+    const int64_t xnvec = X->nvec ;
+    const bool X_is_hyper = (Xh != NULL) ;
+    const int64_t *restrict Si = S->i ;
+    const int8_t  *restrict Sb = S->b ;
+    const int64_t snz = GB_IS_FULL (S) ? S->vlen : GB_nnz_held (S) ;
+    double sum = 0 ;
+    int64_t pleft = 0 ;
+    for (int64_t p = 0 ; p < snz ; p++)
+    {
+        if (Sb != NULL && !Sb [p]) continue ;
+        int64_t j = (Si == NULL) ? p : GB_UNFLIP (Si [p]) ;
+        int64_t pstart, pend ;
+        if (GB_lookup (X_is_hyper, Xh, Xp, X->vlen, &pleft, xnvec-1, j,
+            &pstart, &pend))
+        {
+            sum += (double) (pend - pstart) ;
+        }
+    }
+    return (S_comp ? (xnz - sum) : sum) ;
+}
+
+// number of entries in the pattern of a single vector S of length n, or not
+// in the pattern of S if S_comp is true (n if S is NULL)
+static double GB_pushpull_count
+(
+    const GrB_Matrix S,
+    const bool S_comp,
+    const int64_t n
+)
+{
+    double snz = (S == NULL) ? 0 : (double) GB_nnz (S) ;
+    return (S_comp || S == NULL) ? ((double) n - snz) : snz ;
+}
+
+int GB_AxB_meta_pushpull        // return GB_USE_SAXPY, GB_USE_DOT, or zero
+(
+    const GrB_Matrix M,         // mask for C, or NULL
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix
+    const bool atrans,          // if true, C=A'*B, otherwise C=A*B
+    const GrB_Matrix B,         // input matrix, a single vector
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (B->vdim != 1 || !(GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        || (M != NULL && M->vdim != 1))
+    {
+        // the cost model does not apply
+        return (0) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A for push/pull", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for push/pull", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (B)) ;
+
+    //--------------------------------------------------------------------------
+    // get A and its transpose, if cached
+    //--------------------------------------------------------------------------
+
+    double anz = (double) GB_nnz (A) ;
+    GrB_Matrix AT = A->T ;
+    if (AT != NULL && (GB_ANY_PENDING_WORK (AT) || !A->transpose_cache
+        || (Context != NULL && Context->output == A)))
+    {
+        // A->T is not yet usable; it must be finished or reconstructed
+        AT = NULL ;
+    }
+
+    // For C=A*b, push (saxpy) takes the vectors of A selected by b, and pull
+    // (dot) takes the vectors of A' permitted by M.  For C=A'*b, the roles
+    // of A and A' are swapped.
+    GrB_Matrix Apush = (atrans) ? AT : A ;
+    GrB_Matrix Apull = (atrans) ? A : AT ;
+    int64_t cnrows = (atrans) ? A->vdim : A->vlen ;
+    int64_t bnrows = B->vlen ;
+
+    //--------------------------------------------------------------------------
+    // estimate the work for push (saxpy)
+    //--------------------------------------------------------------------------
+
+    double push_work ;
+    if (Apush != NULL)
+    {
+        // sum the degrees of A(:,k) for each entry b(k)
+        push_work = GB_pushpull_degrees (Apush, B, false) ;
+    }
+    else
+    {
+        // A' must be computed; estimate the degrees from the average
+        push_work = GB_PUSHPULL_TRANSPOSE * anz
+            + anz * GB_pushpull_count (B, false, bnrows)
+            / (double) GB_IMAX (bnrows, 1) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // estimate the work for pull (dot)
+    //--------------------------------------------------------------------------
+
+    double ncand = GB_pushpull_count (M, Mask_comp, cnrows) ;
+    double pull_work ;
+    if (Apull != NULL)
+    {
+        // sum the degrees of A(:,i) for each C(i) permitted by the mask
+        pull_work = GB_pushpull_degrees (Apull, M, Mask_comp) ;
+    }
+    else
+    {
+        // A' must be computed; estimate the degrees from the average
+        pull_work = anz * ncand / (double) GB_IMAX (cnrows, 1) ;
+    }
+
+    if (semiring->add->terminal != NULL)
+    {
+        // each dot product can terminate early
+        pull_work /= GB_PUSHPULL_ALPHA ;
+    }
+
+    if (GB_IS_SPARSE (B) || GB_IS_HYPERSPARSE (B))
+    {
+        // each dot product must also search the sparse vector b
+        pull_work += ncand ;
+    }
+
+    if (Apull == NULL)
+    {
+        // add the work to compute A'
+        pull_work += GB_PUSHPULL_TRANSPOSE * anz ;
+    }
+
+    //--------------------------------------------------------------------------
+    // select push or pull
+    //--------------------------------------------------------------------------
+
+    bool push = (push_work <= pull_work) ;
+    GBURBLE ("(%s: push work %g, pull work %g) ", push ? "push" : "pull",
+        push_work, pull_work) ;
+    GB_Global_pushpull_stats_add (push) ;
+    return (push ? GB_USE_SAXPY : GB_USE_DOT) ;
+}
@@ -12,7 +12,8 @@
 #include "GB_apply.h"
 #include "GB_stringify.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL GB_phybix_free (C) ;
@@ -209,7 +210,7 @@ GrB_Info GB_AxB_rowscale            // C = D*B, row scale with diagonal D
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_DxB(mult,xname) GB (_DxB_ ## mult ## xname)
+            #define GB_DxB(mult,xname) GB_FMV (_DxB_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                     \
             {                                                       \
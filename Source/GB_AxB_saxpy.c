@@ -66,7 +66,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
 
     int C_sparsity, saxpy_method ;
     GB_AxB_saxpy_sparsity (&C_sparsity, &saxpy_method,
-        M, Mask_comp, A, B, Context) ;
+        M, Mask_comp, A, B, semiring, Context) ;
 
     //--------------------------------------------------------------------------
     // determine if C is iso
@@ -151,6 +151,23 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         }
     }
 
+    //--------------------------------------------------------------------------
+    // use saxpy3 if a bitmap C would exceed the memory budget
+    //--------------------------------------------------------------------------
+
+    if (saxpy_method == GB_SAXPY_METHOD_BITMAP
+    ||  saxpy_method == GB_SAXPY_METHOD_BITWISE)
+    {
+        GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
+        double cnzmax = ((double) A->vlen) * ((double) B->vdim) ;
+        if (memory_budget > 0 && cnzmax * (1 + zsize) > memory_budget)
+        { 
+            GBURBLE ("(over budget: bitmap C) ") ;
+            saxpy_method = GB_SAXPY_METHOD_3 ;
+            C_sparsity = GB_IS_HYPERSPARSE (B) ? GxB_HYPERSPARSE : GxB_SPARSE ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // burble
     //--------------------------------------------------------------------------
@@ -222,7 +239,7 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
         ASSERT (C_sparsity == GxB_HYPERSPARSE || C_sparsity == GxB_SPARSE) ;
         info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M, Mask_comp,
             Mask_struct, A, B, semiring, flipxy, mask_applied, AxB_method,
-            do_sort, Context) ;
+            do_sort, 0, Context) ;
 
         if (info == GrB_NO_VALUE)
         { 
@@ -239,6 +256,20 @@ GrB_Info GB_AxB_saxpy               // C = A*B using Gustavson/Hash/Bitmap
                 do_sort, Context) ;
         }
 
+    }
+    else if (saxpy_method == GB_SAXPY_METHOD_BITWISE)
+    { 
+
+        //----------------------------------------------------------------------
+        // bitwise method: C is bitmap, with a boolean semiring
+        //----------------------------------------------------------------------
+
+        // C = A*B is computed 64 columns at a time, where A is sparse or
+        // hypersparse, B is bitmap or full.  The mask is not applied.
+
+        ASSERT (C_sparsity == GxB_BITMAP) ;
+        info = GB_AxB_saxpy_bitwise (C, C_iso, cscalar, A, B, Context) ;
+
     }
     else
     { 
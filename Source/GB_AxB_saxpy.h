@@ -11,6 +11,7 @@
 #define GB_AXB_SAXPY_H
 #include "GB.h"
 #include "GB_AxB_saxpy3.h"
+#include "GB_AxB_dot_intersect.h"
 
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy
@@ -49,6 +50,7 @@ void GB_AxB_saxpy_sparsity          // determine C_sparsity and method to use
     const bool Mask_comp,           // if true, use !M
     const GrB_Matrix A,             // input A matrix
     const GrB_Matrix B,             // input B matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
     GB_Context Context
 ) ;
 
@@ -98,6 +100,20 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// bitwise saxpy: C=A*B where A is sparse/hyper, B is bitmap/full; boolean
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy_bitwise       // C = A*B, with a boolean semiring
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_iso,               // true if C is iso
+    const GB_void *cscalar,         // iso value of C
+    const GrB_Matrix A,             // input matrix A, sparse or hypersparse
+    const GrB_Matrix B,             // input matrix B, bitmap or full
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // saxpy methods
 //------------------------------------------------------------------------------
@@ -105,6 +121,7 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 #define GB_SAXPY_METHOD_3 3
 #define GB_SAXPY_METHOD_BITMAP 5
 #define GB_SAXPY_METHOD_ISO_FULL 6
+#define GB_SAXPY_METHOD_BITWISE 7
 
 #endif
 
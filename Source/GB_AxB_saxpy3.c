@@ -89,10 +89,12 @@
 
 #include "GB_mxm.h"
 #include "GB_AxB_saxpy_generic.h"
+#include "GB_AxB_jit.h"
 #include "GB_control.h"
 #include "GB_AxB__include1.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 #include "GB_unused.h"
 
@@ -130,6 +132,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    const int nthreads_limit,       // if > 0, use at most this many threads
     GB_Context Context
 )
 {
@@ -177,6 +180,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //--------------------------------------------------------------------------
 
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    if (nthreads_limit > 0)
+    { 
+        nthreads_max = GB_IMIN (nthreads_max, nthreads_limit) ;
+    }
+    GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
 
     //--------------------------------------------------------------------------
     // define workspace
@@ -281,14 +289,64 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int nthreads, ntasks, nfine ;
     bool M_in_place = false ;
 
-    if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
-        GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16)
+    // The analysis in phase0 and phase1 is kept in the output matrix of the
+    // user-callable method, if it has the GxB_AxB_PLAN option, and reused by
+    // the next C=A*B with the same patterns of A and B.  Only C=A*B with no
+    // mask and no memory budget is planned.
+    GrB_Matrix C_output = (Context == NULL) ? NULL : Context->output ;
+    const bool keep_plan = (C_output != NULL && C_output->keep_plan &&
+        M == NULL && memory_budget <= 0) ;
+    const bool reuse_plan = keep_plan &&
+        GB_AxB_saxpy3_plan_match (C_output->saxpy3_plan, A, B, C_sparsity,
+        AxB_method, nthreads_max, chunk) ;
+
+    // The MSA method is selected by GB_AxB_meta for C<M>=A*B when M is sparse
+    // or hypersparse, not complemented, and sparse enough.  It is disabled if
+    // saxpy3 is retried with the Hash method to fit in the memory budget.
+    const bool use_msa = (AxB_method == GB_AxB_MSA) && !reuse_plan &&
+        GB_AxB_dot3_control (M, Mask_comp) ;
+
+    if (reuse_plan)
+    { 
+        // Use the tasks from a prior C=A*B.  The hash tables are allocated
+        // below, as usual, and the counts in C->p are restored in phase1.
+        GBURBLE ("(saxpy3 plan reuse) ") ;
+        const GB_saxpy3_plan_struct *plan = C_output->saxpy3_plan ;
+        ntasks = plan->ntasks ;
+        nfine = plan->nfine ;
+        nthreads = plan->nthreads ;
+        SaxpyTasks = GB_MALLOC_WORK (ntasks, GB_saxpy3task_struct,
+            &SaxpyTasks_size) ;
+        if (SaxpyTasks == NULL)
+        { 
+            info = GrB_OUT_OF_MEMORY ;
+        }
+        else
+        { 
+            memcpy (SaxpyTasks, plan->SaxpyTasks,
+                ntasks * sizeof (GB_saxpy3task_struct)) ;
+            info = GrB_SUCCESS ;
+        }
+    }
+    else if (use_msa)
+    { 
+        // C<M>=A*B with the masked sparse accumulator: all tasks are coarse
+        // Gustavson tasks, and the pattern of C is taken from M.
+        GBURBLE ("(msa) ") ;
+        info = GB_AxB_saxpy3_slice_msa (C, M, A, B, nthreads_limit,
+            &SaxpyTasks, &SaxpyTasks_size, &ntasks, &nfine, &nthreads,
+            Context) ;
+        apply_mask = true ;
+    }
+    else if (nthreads_max == 1 && M == NULL && (AxB_method != GxB_AxB_HASH) &&
+        GB_IMIN (GB_nnz (A), GB_nnz (B)) > cvlen/16 && memory_budget <= 0)
     { 
         // Skip the flopcount analysis if only a single thread is being used,
         // no mask is present, the Hash method is not explicitly selected, and
         // the problem is not extremely sparse.  In this case, use a single
         // coarse Gustavson task only.  In this case, the flop count analysis
-        // is not needed.
+        // is not needed.  The analysis is always done if a memory budget is
+        // in effect, since it is used to estimate the size of C.
         GBURBLE ("(single-threaded Gustavson) ") ;
         info = GB_AxB_saxpy3_slice_quick (C, A, B,
             &SaxpyTasks, &SaxpyTasks_size, &ntasks, &nfine, &nthreads,
@@ -300,8 +358,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         // the general case.  This may select a single task for a single thread
         // anyway, but this decision would be based on the analysis.
         info = GB_AxB_saxpy3_slice_balanced (C, M, Mask_comp, A, B, AxB_method,
-            &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place,
-            &ntasks, &nfine, &nthreads, Context) ;
+            nthreads_limit, &SaxpyTasks, &SaxpyTasks_size, &apply_mask,
+            &M_in_place, &ntasks, &nfine, &nthreads, Context) ;
     }
 
     #ifdef GB_TIMING
@@ -402,7 +460,9 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
     int nfine_hash = 0 ;
     int nfine_gus = 0 ;
+    int nfine_private = 0 ;
     int ncoarse_hash = 0 ;
+    int ncoarse_esc = 0 ;
     int ncoarse_1hash = 0 ;
     int ncoarse_gus = 0 ;
 
@@ -414,11 +474,18 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         int64_t k = SaxpyTasks [taskid].vector ;
         bool is_fine = (k >= 0) ;
         bool use_Gustavson = (hash_size == cvlen) ;
+        bool use_esc = !is_fine && SaxpyTasks [taskid].use_esc ;
+        bool use_private = is_fine && SaxpyTasks [taskid].use_private ;
 
         if (is_fine)
         {
             // fine task
-            if (use_Gustavson)
+            if (use_private)
+            { 
+                // fine Gustavson task with a private workspace
+                nfine_private++ ;
+            }
+            else if (use_Gustavson)
             { 
                 // fine Gustavson task
                 nfine_gus++ ;
@@ -437,6 +504,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                 // coarse Gustavson task
                 ncoarse_gus++ ;
             }
+            else if (use_esc)
+            { 
+                // coarse ESC task
+                ncoarse_esc++ ;
+            }
             else
             { 
                 // coarse hash task
@@ -444,10 +516,11 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             }
         }
 
-        if (taskid != SaxpyTasks [taskid].leader)
+        if (taskid != SaxpyTasks [taskid].leader && !use_private)
         { 
             // allocate a single shared hash table for all fine
-            // tasks that compute a single C(:,j)
+            // tasks that compute a single C(:,j), unless each task
+            // has its own private workspace
             continue ;
         }
 
@@ -465,14 +538,14 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             int64_t hi_size2 = GB_IMAX (hi_size, 64) ;
             Hf_size_total += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
         }
-        else
+        else if (!use_esc)
         { 
-            // Hf is int64_t for all other methods
+            // Hf is int64_t for all other methods, except ESC (no Hf)
             Hf_size_total += hi_size ;
         }
         if (!is_fine && !use_Gustavson)
         { 
-            // only coarse hash tasks need Hi
+            // only coarse hash and ESC tasks need Hi
             Hi_size_total += hi_size ;
         }
         // all tasks use an Hx array of size hash_size
@@ -483,11 +556,65 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         }
     }
 
+    //--------------------------------------------------------------------------
+    // check the memory budget
+    //--------------------------------------------------------------------------
+
+    if (memory_budget > 0)
+    {
+        // The peak memory is the hash tables, the task descriptors, and C
+        // itself.  The # of entries in C is bounded by the flop count, which
+        // GB_AxB_saxpy3_slice_balanced leaves in Cp [cnvec], and by the size
+        // of the mask if it is used and not complemented.  The estimate is an
+        // upper bound, and does not include the inputs M, A, and B.
+        double cnz_max = GB_IMIN ((double) Cp [cnvec],
+            ((double) cvlen) * ((double) cvdim)) ;
+        if (M != NULL && !Mask_comp)
+        { 
+            cnz_max = GB_IMIN (cnz_max, (double) GB_nnz_held (M)) ;
+        }
+        double peak = sizeof (int64_t) * (double) (Hi_size_total+Hf_size_total)
+            + ((double) csize) * ((double) Hx_size_total)
+            + (double) (SaxpyTasks_size + C->p_size + C->h_size)
+            + cnz_max * (sizeof (int64_t) + (C_iso ? 0 : csize)) ;
+        if (peak > memory_budget)
+        {
+            // Try again with the Hash method, or with fewer threads (and
+            // thus fewer tasks and hash tables).  Otherwise, give up, and let
+            // the caller try another method.  The thread limit is passed to
+            // the retry, so the Context is not modified.
+            GB_FREE_ALL ;
+            int nthreads_retry = nthreads_limit ;
+            if ((ncoarse_gus + nfine_gus) > 0 && AxB_method != GxB_AxB_HASH)
+            { 
+                GBURBLE ("(over budget: use hash) ") ;
+                AxB_method = GxB_AxB_HASH ;
+            }
+            else if (nthreads > 1)
+            { 
+                GBURBLE ("(over budget: use %d threads) ", nthreads/2) ;
+                nthreads_retry = nthreads/2 ;
+            }
+            else
+            { 
+                GBURBLE ("(over budget: %g bytes) ", peak) ;
+                Context->memory_peak = peak ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            info = GB_AxB_saxpy3 (C, C_iso, cscalar, C_sparsity, M_input,
+                Mask_comp_input, Mask_struct, A, B, semiring, flipxy,
+                mask_applied, AxB_method, do_sort, nthreads_retry, Context) ;
+            return (info) ;
+        }
+    }
+
     GBURBLE ("(nthreads %d", nthreads) ;
     if (ncoarse_gus  > 0) GBURBLE (" coarse: %d",      ncoarse_gus) ;
     if (ncoarse_hash > 0) GBURBLE (" coarse hash: %d", ncoarse_hash) ;
+    if (ncoarse_esc  > 0) GBURBLE (" coarse esc: %d",  ncoarse_esc) ;
     if (nfine_gus    > 0) GBURBLE (" fine: %d",        nfine_gus) ;
     if (nfine_hash   > 0) GBURBLE (" fine hash: %d",   nfine_hash) ;
+    if (nfine_private > 0) GBURBLE (" fine private: %d", nfine_private) ;
     GBURBLE (") ") ;
 
     //--------------------------------------------------------------------------
@@ -528,20 +655,22 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
 
-        if (taskid != SaxpyTasks [taskid].leader)
+        int64_t hash_size = SaxpyTasks [taskid].hsize ;
+        int64_t k = SaxpyTasks [taskid].vector ;
+        bool is_fine = (k >= 0) ;
+        bool use_Gustavson = (hash_size == cvlen) ;
+        bool use_esc = !is_fine && SaxpyTasks [taskid].use_esc ;
+        bool use_private = is_fine && SaxpyTasks [taskid].use_private ;
+
+        if (taskid != SaxpyTasks [taskid].leader && !use_private)
         { 
             // allocate a single hash table for all fine
             // tasks that compute a single C(:,j)
             continue ;
         }
 
-        int64_t hash_size = SaxpyTasks [taskid].hsize ;
-        int64_t k = SaxpyTasks [taskid].vector ;
-        bool is_fine = (k >= 0) ;
-        bool use_Gustavson = (hash_size == cvlen) ;
-
         SaxpyTasks [taskid].Hi = Hi_part ;
-        SaxpyTasks [taskid].Hf = (GB_void *) Hf_part ;
+        SaxpyTasks [taskid].Hf = use_esc ? NULL : ((GB_void *) Hf_part) ;
         SaxpyTasks [taskid].Hx = Hx_part ;
 
         int64_t hi_size = GB_IMAX (hash_size, 8) ;
@@ -558,14 +687,14 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             int64_t hi_size2 = GB_IMAX (hi_size, 64) ;
             Hf_part += GB_ICEIL (hi_size2, sizeof (int64_t)) ;
         }
-        else
+        else if (!use_esc)
         { 
-            // Hf is int64_t for all other methods
+            // Hf is int64_t for all other methods, except ESC (no Hf)
             Hf_part += hi_size ;
         }
         if (!is_fine && !use_Gustavson)
         { 
-            // only coarse hash tasks need Hi
+            // only coarse hash and ESC tasks need Hi
             Hi_part += hi_size ;
         }
         // all tasks use an Hx array of size hash_size
@@ -581,7 +710,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     {
         int leader = SaxpyTasks [taskid].leader ;
         ASSERT (SaxpyTasks [leader].vector >= 0) ;
-        if (taskid != leader)
+        if (taskid != leader && !SaxpyTasks [taskid].use_private)
         { 
             // this fine task (Gustavson or hash) shares its hash table
             // with all other tasks in its team, for a single vector C(:,j).
@@ -606,8 +735,61 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     ttt = omp_get_wtime ( ) ;
     #endif
 
-    GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
-        A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+    if (use_msa)
+    {
+        // no symbolic analysis: C(:,j) has room for all entries in M(:,j)
+        const int64_t *restrict Mp = M->p ;
+        const int64_t *restrict M_Yp = NULL ;
+        const int64_t *restrict M_Yi = NULL ;
+        const int64_t *restrict M_Yx = NULL ;
+        int64_t M_hash_bits = 0 ;
+        const bool M_is_hyper = GB_IS_HYPERSPARSE (M) ;
+        if (M_is_hyper)
+        { 
+            M_Yp = M->Y->p ;
+            M_Yi = M->Y->i ;
+            M_Yx = M->Y->x ;
+            M_hash_bits = M->Y->vdim - 1 ;
+        }
+        int nth = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        int64_t kk ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (kk = 0 ; kk < cnvec ; kk++)
+        {
+            int64_t j = GBH (Bh, kk) ;
+            int64_t pM_start, pM_end ;
+            if (M_is_hyper)
+            { 
+                GB_hyper_hash_lookup (Mp, M_Yp, M_Yi, M_Yx, M_hash_bits, j,
+                    &pM_start, &pM_end) ;
+            }
+            else
+            { 
+                pM_start = Mp [j] ;
+                pM_end   = Mp [j+1] ;
+            }
+            Cp [kk] = pM_end - pM_start ;
+        }
+    }
+    else if (reuse_plan)
+    { 
+        // restore the counts in C->p from the symbolic analysis of the plan
+        int nth = GB_nthreads (cnvec, chunk, nthreads_max) ;
+        GB_memcpy (Cp, C_output->saxpy3_plan->Cp, (cnvec+1) * sizeof (int64_t),
+            nth) ;
+    }
+    else
+    { 
+        GB_AxB_saxpy3_symbolic (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads) ;
+        if (keep_plan)
+        { 
+            // keep the analysis for the next C=A*B
+            GB_AxB_saxpy3_plan_save (C_output, C, A, B, C_sparsity,
+                AxB_method, nthreads_max, chunk, SaxpyTasks, ntasks, nfine,
+                nthreads, Context) ;
+        }
+    }
 
 // the above phase takes 1.6 seconds for 64 trials of the web graph.
 
@@ -655,7 +837,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             //------------------------------------------------------------------
 
             #define GB_Asaxpy3B(add,mult,xname) \
-                GB (_Asaxpy3B_ ## add ## mult ## xname)
+                GB_FMV (_Asaxpy3B_ ## add ## mult ## xname)
 
             #define GB_AxB_WORKER(add,mult,xname)                           \
             {                                                               \
@@ -678,6 +860,23 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 
         #endif
 
+        //----------------------------------------------------------------------
+        // saxpy3 method via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_AxB_saxpy_jit (C, M, Mask_comp, Mask_struct,
+                M_in_place, A, B, semiring, flipxy, GB_SAXPY_METHOD_3,
+                SaxpyTasks, ntasks, nfine, nthreads, do_sort,
+                Context) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit sparse saxpy) ") ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // generic saxpy3 method
         //----------------------------------------------------------------------
@@ -699,6 +898,47 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         return (GrB_OUT_OF_MEMORY) ;
     }
 
+    //--------------------------------------------------------------------------
+    // remove the gaps left by the MSA method
+    //--------------------------------------------------------------------------
+
+    if (use_msa)
+    {
+        // Each coarse MSA task has compacted its entries to the start of the
+        // space for C(:,kfirst:klast), of size nnz (M (:,kfirst:klast)).  The
+        // space after them, for entries in M that are not in A*B, is removed
+        // by shifting the entries of each task to the end of the prior task.
+        int64_t *restrict Ci = C->i ;
+        GB_void *restrict Cx = (GB_void *) C->x ;
+        int64_t cnz = 0 ;
+        for (int taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+            int64_t kfirst = SaxpyTasks [taskid].start ;
+            int64_t klast  = SaxpyTasks [taskid].end ;
+            int64_t my_cjnz = SaxpyTasks [taskid].my_cjnz ;
+            if (kfirst > klast) continue ;
+            int64_t pC_first = Cp [kfirst] ;
+            int64_t gap = pC_first - cnz ;
+            if (gap > 0)
+            { 
+                memmove (Ci + cnz, Ci + pC_first, my_cjnz * sizeof (int64_t)) ;
+                if (!C_iso)
+                { 
+                    memmove (Cx + cnz * csize, Cx + pC_first * csize,
+                        my_cjnz * csize) ;
+                }
+                for (int64_t kk = kfirst ; kk <= klast ; kk++)
+                { 
+                    Cp [kk] -= gap ;
+                }
+            }
+            cnz += my_cjnz ;
+        }
+        Cp [cnvec] = cnz ;
+        C->nvals = cnz ;
+        C->nvec_nonempty = -1 ;
+    }
+
     //--------------------------------------------------------------------------
     // prune empty vectors, free workspace, and return result
     //--------------------------------------------------------------------------
@@ -31,6 +31,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     bool *mask_applied,             // if true, then mask was applied
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
     const int do_sort,              // if nonzero, try to sort in saxpy3
+    const int nthreads_limit,       // if > 0, use at most this many threads
     GB_Context Context
 ) ;
 
@@ -59,6 +60,28 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
 // Hash method is not used, and Gustavson's method is used, with the hash size
 // is set to C->vlen.
 
+// A coarse task whose vectors each need only a few flops (at most
+// GB_SAXPY3_ESC_FLMAX) can use the expand-sort-compress (ESC) method instead,
+// if no mask is applied during saxpy3.  The row indices of A(:,k) for all k in
+// B(:,j) are gathered into Hi, sorted, and compressed directly into C(:,j),
+// which is left sorted.  Hi and Hx are used, of size hsize, but not Hf.
+
+// The fine Gustavson tasks for a single C(:,j) with many updates per row,
+// such as a hub column of a power-law graph, can each use a private Hf and Hx
+// workspace instead, if no mask is applied during saxpy3.  Each task computes
+// its part of A*B(:,j) with no atomics, and the team then merges the private
+// workspaces into the workspace of the leader, each task merging a subset of
+// the rows of C(:,j).
+
+// For C<M>=A*B with a sparse or hypersparse mask M that is not complemented,
+// GB_AxB_meta can select the masked sparse accumulator (MSA) method, where
+// all tasks are coarse Gustavson tasks.  The pattern of C is a subset of the
+// pattern of M, so the symbolic phase1 is skipped: C->p is taken from M, each
+// task compacts the entries it finds, and the gaps left by entries of M not
+// present in A*B are removed after phase5.  No zombies are created.
+
+#define GB_SAXPY3_ESC_FLMAX 32
+
 typedef struct
 {
     int64_t start ;     // starting vector for coarse task, p for fine task
@@ -71,9 +94,92 @@ typedef struct
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
     int leader ;        // leader fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
+    bool use_esc ;      // true for a coarse ESC task
+    bool use_private ;  // true for a fine task with a private workspace
+    bool use_msa ;      // true for a coarse MSA task
 }
 GB_saxpy3task_struct ;
 
+//------------------------------------------------------------------------------
+// GB_saxpy3_plan_struct: symbolic analysis of C=A*B, kept for reuse
+//------------------------------------------------------------------------------
+
+// If the output matrix of GrB_mxm has the GxB_AxB_PLAN option, and C=A*B is
+// computed by GB_AxB_saxpy3 with no mask, the tasks from phase0 and the counts
+// in C->p from phase1 are kept in a plan, with a copy of the patterns of A and
+// B, and the settings that the tasks depend on.  A later C=A*B with the same
+// patterns and settings reuses the tasks and counts, and skips phase0 and
+// phase1.  The numeric phases (phase2 to phase5) are always done.
+
+typedef struct
+{
+    int64_t vlen ;      // length of each vector
+    int64_t vdim ;      // number of vectors
+    int64_t nvec ;      // number of vectors in p and h
+    int64_t nz ;        // number of entries in i, or in b if bitmap
+    int sparsity ;      // hypersparse, sparse, bitmap, or full
+    int64_t *p ; size_t p_size ;    // copy of A->p, or NULL
+    int64_t *h ; size_t h_size ;    // copy of A->h, or NULL
+    int64_t *i ; size_t i_size ;    // copy of A->i, or NULL
+    int8_t  *b ; size_t b_size ;    // copy of A->b, or NULL
+}
+GB_saxpy3_pattern ;
+
+typedef struct GB_saxpy3_plan_struct
+{
+    size_t header_size ;            // size of this struct
+    // the patterns and settings that the plan depends on
+    GB_saxpy3_pattern A_pattern ;
+    GB_saxpy3_pattern B_pattern ;
+    int C_sparsity ;                // C is sparse or hypersparse
+    GrB_Desc_Value AxB_method ;     // Default, Gustavson, or Hash
+    int nthreads_max ;              // max # of threads from the Context
+    double chunk ;                  // chunk size from the Context
+    // the analysis: tasks from phase0, and counts in C->p from phase1
+    GB_saxpy3task_struct *SaxpyTasks ; size_t SaxpyTasks_size ;
+    int ntasks ;                    // # of tasks (coarse and fine)
+    int nfine ;                     // # of fine tasks
+    int nthreads ;                  // # of threads to use
+    int64_t *Cp ; size_t Cp_size ;  // C->p after phase1, of size cnvec+1
+}
+GB_saxpy3_plan_struct ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_match: check if a saxpy3 plan can be reused
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_match       // true if the plan can be reused
+(
+    const GB_saxpy3_plan_struct *plan,  // plan to check, may be NULL
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    int C_sparsity,                 // C is sparse or hypersparse
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads from the Context
+    double chunk                    // chunk size from the Context
+) ;
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: keep the saxpy3 analysis in a plan
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_save
+(
+    GrB_Matrix C_output,            // matrix that keeps the plan
+    const GrB_Matrix C,             // C->p holds the counts from phase1
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    int C_sparsity,                 // C is sparse or hypersparse
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads from the Context
+    double chunk,                   // chunk size from the Context
+    const GB_saxpy3task_struct *SaxpyTasks, // tasks from phase0
+    int ntasks,                     // # of tasks (coarse and fine)
+    int nfine,                      // # of fine tasks
+    int nthreads,                   // # of threads to use
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_flopcount:  compute flops for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
@@ -117,6 +223,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    const int nthreads_limit,       // if > 0, use at most this many threads
     // outputs
     GB_saxpy3task_struct **SaxpyTasks_handle,
     size_t *SaxpyTasks_size_handle,
@@ -147,6 +254,27 @@ GrB_Info GB_AxB_saxpy3_slice_quick
     GB_Context Context
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_msa: create coarse MSA tasks for saxpy3
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AxB_saxpy3_slice_msa
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix M,             // mask matrix, sparse or hypersparse
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const int nthreads_limit,       // if > 0, use at most this many threads
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    int *ntasks,                    // # of tasks created (all coarse)
+    int *nfine,                     // # of fine tasks created (always zero)
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+) ;
+
 //------------------------------------------------------------------------------
 // GB_AxB_saxpy3_symbolic: symbolic analysis for GB_AxB_saxpy3
 //------------------------------------------------------------------------------
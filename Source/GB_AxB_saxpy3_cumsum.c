@@ -13,6 +13,87 @@
 #include "GB_AxB_saxpy3.h"
 #include "GB_unused.h"
 
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cumsum_task: phase3 for a single fine task
+//------------------------------------------------------------------------------
+
+// arguments for GB_AxB_saxpy3_cumsum_task
+typedef struct
+{
+    GB_saxpy3task_struct *SaxpyTasks ;
+    int64_t cvlen ;
+}
+GB_saxpy3_cumsum_args ;
+
+static void GB_AxB_saxpy3_cumsum_task (void *arg, int64_t taskid)
+{
+    GB_saxpy3_cumsum_args *args = (GB_saxpy3_cumsum_args *) arg ;
+    GB_saxpy3task_struct *SaxpyTasks = args->SaxpyTasks ;
+    const int64_t cvlen = args->cvlen ;
+
+    //--------------------------------------------------------------------------
+    // get the task descriptor
+    //--------------------------------------------------------------------------
+
+    // int64_t kk = SaxpyTasks [taskid].vector ;
+    int64_t hash_size = SaxpyTasks [taskid].hsize ;
+    bool use_Gustavson = (hash_size == cvlen) ;
+    int team_size = SaxpyTasks [taskid].team_size ;
+    int leader    = SaxpyTasks [taskid].leader ;
+    int my_teamid = taskid - leader ;
+    int64_t my_cjnz = 0 ;
+
+    if (use_Gustavson)
+    {
+
+        //----------------------------------------------------------------------
+        // phase3: fine Gustavson task, C=A*B, C<M>=A*B, or C<!M>=A*B
+        //----------------------------------------------------------------------
+
+        // Hf [i] == 2 if C(i,j) is an entry in C(:,j)
+
+        int8_t *restrict Hf ;
+        Hf = (int8_t *restrict) SaxpyTasks [taskid].Hf ;
+        int64_t istart, iend ;
+        GB_PARTITION (istart, iend, cvlen, my_teamid, team_size) ;
+        for (int64_t i = istart ; i < iend ; i++)
+        {
+            if (Hf [i] == 2)
+            { 
+                my_cjnz++ ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // phase3: fine hash task, C=A*B, C<M>=A*B, or C<!M>=A*B
+        //----------------------------------------------------------------------
+
+        // (Hf [hash] & 3) == 2 if C(i,j) is an entry in C(:,j),
+        // and the index i of the entry is (Hf [hash] >> 2) - 1.
+
+        int64_t *restrict Hf = (int64_t *restrict) SaxpyTasks [taskid].Hf ;
+        int64_t mystart, myend ;
+        GB_PARTITION (mystart, myend, hash_size, my_teamid, team_size) ;
+        for (int64_t hash = mystart ; hash < myend ; hash++)
+        {
+            if ((Hf [hash] & 3) == 2)
+            { 
+                my_cjnz++ ;
+            }
+        }
+    }
+
+    SaxpyTasks [taskid].my_cjnz = my_cjnz ;   // count my nnz(C(:,j))
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_cumsum
+//------------------------------------------------------------------------------
+
 void GB_AxB_saxpy3_cumsum
 (
     GrB_Matrix C,               // finalize C->p
@@ -38,74 +119,17 @@ void GB_AxB_saxpy3_cumsum
     // phase3: count nnz(C(:,j)) for fine tasks
     //==========================================================================
 
-    int taskid ;
-    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
-    for (taskid = 0 ; taskid < nfine ; taskid++)
-    {
-
-        //----------------------------------------------------------------------
-        // get the task descriptor
-        //----------------------------------------------------------------------
-
-        // int64_t kk = SaxpyTasks [taskid].vector ;
-        int64_t hash_size = SaxpyTasks [taskid].hsize ;
-        bool use_Gustavson = (hash_size == cvlen) ;
-        int team_size = SaxpyTasks [taskid].team_size ;
-        int leader    = SaxpyTasks [taskid].leader ;
-        int my_teamid = taskid - leader ;
-        int64_t my_cjnz = 0 ;
-
-        if (use_Gustavson)
-        {
-
-            //------------------------------------------------------------------
-            // phase3: fine Gustavson task, C=A*B, C<M>=A*B, or C<!M>=A*B
-            //------------------------------------------------------------------
-
-            // Hf [i] == 2 if C(i,j) is an entry in C(:,j)
-
-            int8_t *restrict Hf ;
-            Hf = (int8_t *restrict) SaxpyTasks [taskid].Hf ;
-            int64_t istart, iend ;
-            GB_PARTITION (istart, iend, cvlen, my_teamid, team_size) ;
-            for (int64_t i = istart ; i < iend ; i++)
-            {
-                if (Hf [i] == 2)
-                { 
-                    my_cjnz++ ;
-                }
-            }
-
-        }
-        else
-        {
-
-            //------------------------------------------------------------------
-            // phase3: fine hash task, C=A*B, C<M>=A*B, or C<!M>=A*B
-            //------------------------------------------------------------------
-
-            // (Hf [hash] & 3) == 2 if C(i,j) is an entry in C(:,j),
-            // and the index i of the entry is (Hf [hash] >> 2) - 1.
-
-            int64_t *restrict Hf = (int64_t *restrict) SaxpyTasks [taskid].Hf ;
-            int64_t mystart, myend ;
-            GB_PARTITION (mystart, myend, hash_size, my_teamid, team_size) ;
-            for (int64_t hash = mystart ; hash < myend ; hash++)
-            {
-                if ((Hf [hash] & 3) == 2)
-                { 
-                    my_cjnz++ ;
-                }
-            }
-        }
-
-        SaxpyTasks [taskid].my_cjnz = my_cjnz ;   // count my nnz(C(:,j))
-    }
+    GB_saxpy3_cumsum_args args ;
+    args.SaxpyTasks = SaxpyTasks ;
+    args.cvlen = cvlen ;
+    GB_parallel_for (GB_AxB_saxpy3_cumsum_task, &args, nfine, nthreads) ;
 
     //==========================================================================
     // phase4: compute Cp with cumulative sum
     //==========================================================================
 
+    int taskid ;
+
     //--------------------------------------------------------------------------
     // sum nnz (C (:,j)) for fine tasks
     //--------------------------------------------------------------------------
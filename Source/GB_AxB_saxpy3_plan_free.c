@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_free: free the saxpy3 plan of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Free the saxpy3 plan A->saxpy3_plan of a matrix (see
+// GB_AxB_saxpy3_plan_save).  The matrix A is not modified otherwise, and
+// A->keep_plan is unchanged.
+
+#include "GB_AxB_saxpy3.h"
+
+void GB_AxB_saxpy3_plan_free    // free the saxpy3 plan of a matrix
+(
+    GrB_Matrix A                // matrix with the plan to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free A->saxpy3_plan
+    //--------------------------------------------------------------------------
+
+    if (A != NULL && A->saxpy3_plan != NULL)
+    {
+        GB_saxpy3_plan_struct *plan = A->saxpy3_plan ;
+        GB_saxpy3_pattern *patterns [2] = { &(plan->A_pattern),
+            &(plan->B_pattern) } ;
+        for (int k = 0 ; k < 2 ; k++)
+        {
+            GB_saxpy3_pattern *X = patterns [k] ;
+            GB_FREE (&(X->p), X->p_size) ;
+            GB_FREE (&(X->h), X->h_size) ;
+            GB_FREE (&(X->i), X->i_size) ;
+            GB_FREE (&(X->b), X->b_size) ;
+        }
+        GB_FREE (&(plan->SaxpyTasks), plan->SaxpyTasks_size) ;
+        GB_FREE (&(plan->Cp), plan->Cp_size) ;
+        GB_FREE (&(A->saxpy3_plan), plan->header_size) ;
+    }
+}
+
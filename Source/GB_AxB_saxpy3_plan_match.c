@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_match: check if a saxpy3 plan can be reused
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The tasks and the symbolic counts of C=A*B held in a saxpy3 plan (see
+// GB_AxB_saxpy3_plan_save) depend only on the patterns of A and B, the
+// sparsity of C, the AxB_method, and the number of threads and chunk size
+// from the Context (the mask is not used when the plan is made).  The plan
+// can be reused if all of these are unchanged.  The patterns are compared in
+// full, taking O(nnz(A)+nnz(B)) time, which is much less than the time to
+// recompute the analysis, since the flop count of A*B is not needed.
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_pattern_match: check if the pattern of A is unchanged
+//------------------------------------------------------------------------------
+
+static inline bool GB_pattern_match
+(
+    const GB_saxpy3_pattern *X,     // pattern of A when the plan was made
+    const GrB_Matrix A              // matrix to compare with X
+)
+{
+
+    //--------------------------------------------------------------------------
+    // compare the dimensions and sparsity
+    //--------------------------------------------------------------------------
+
+    if (X->vlen != A->vlen || X->vdim != A->vdim || X->nvec != A->nvec
+        || X->sparsity != GB_sparsity (A)
+        || (X->p == NULL) != (A->p == NULL)
+        || (X->h == NULL) != (A->h == NULL)
+        || (X->i == NULL) != (A->i == NULL)
+        || (X->b == NULL) != (A->b == NULL))
+    {
+        return (false) ;
+    }
+    int64_t anz = (A->b != NULL) ? GB_nnz_held (A) : GB_nnz (A) ;
+    if (X->nz != anz)
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compare the pattern
+    //--------------------------------------------------------------------------
+
+    return ((A->p == NULL ||
+                memcmp (X->p, A->p, (X->nvec + 1) * sizeof (int64_t)) == 0)
+        &&  (A->h == NULL ||
+                memcmp (X->h, A->h, X->nvec * sizeof (int64_t)) == 0)
+        &&  (A->i == NULL ||
+                memcmp (X->i, A->i, X->nz * sizeof (int64_t)) == 0)
+        &&  (A->b == NULL ||
+                memcmp (X->b, A->b, X->nz * sizeof (int8_t)) == 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_match
+//------------------------------------------------------------------------------
+
+bool GB_AxB_saxpy3_plan_match       // true if the plan can be reused
+(
+    const GB_saxpy3_plan_struct *plan,  // plan to check, may be NULL
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    int C_sparsity,                 // C is sparse or hypersparse
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads from the Context
+    double chunk                    // chunk size from the Context
+)
+{
+    return (plan != NULL
+        && plan->C_sparsity == C_sparsity
+        && plan->AxB_method == AxB_method
+        && plan->nthreads_max == nthreads_max
+        && plan->chunk == chunk
+        && GB_pattern_match (&(plan->A_pattern), A)
+        && GB_pattern_match (&(plan->B_pattern), B)) ;
+}
+
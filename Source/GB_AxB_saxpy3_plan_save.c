@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save: keep the saxpy3 analysis in a plan
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy3 calls this method after phase1, when C_output (the output
+// matrix of the user-callable method) has the GxB_AxB_PLAN option and no
+// plan that can be reused.  The tasks from phase0 and the counts in C->p from
+// phase1 are copied into a new plan, with a copy of the patterns of A and B
+// and the settings the tasks depend on (see GB_AxB_saxpy3_plan_match), and
+// any prior plan in C_output is freed.  The plan is optional, so if out of
+// memory, no plan is kept and no error is returned.
+
+#include "GB_AxB_saxpy3.h"
+
+//------------------------------------------------------------------------------
+// GB_pattern_save: copy the pattern of a matrix
+//------------------------------------------------------------------------------
+
+static bool GB_pattern_save         // return true if successful
+(
+    GB_saxpy3_pattern *X,           // pattern to construct, all NULL on input
+    const GrB_Matrix A,             // matrix to copy
+    int nthreads_max,
+    double chunk,
+    GB_Context Context
+)
+{
+
+    X->vlen = A->vlen ;
+    X->vdim = A->vdim ;
+    X->nvec = A->nvec ;
+    X->sparsity = GB_sparsity (A) ;
+    X->nz = (A->b != NULL) ? GB_nnz_held (A) : GB_nnz (A) ;
+    int nthreads = GB_nthreads (X->nz + X->nvec, chunk, nthreads_max) ;
+
+    if (A->p != NULL)
+    {
+        X->p = GB_MALLOC (X->nvec + 1, int64_t, &(X->p_size)) ;
+        if (X->p == NULL) return (false) ;
+        GB_memcpy (X->p, A->p, (X->nvec + 1) * sizeof (int64_t), nthreads) ;
+    }
+    if (A->h != NULL)
+    {
+        X->h = GB_MALLOC (GB_IMAX (X->nvec, 1), int64_t, &(X->h_size)) ;
+        if (X->h == NULL) return (false) ;
+        GB_memcpy (X->h, A->h, X->nvec * sizeof (int64_t), nthreads) ;
+    }
+    if (A->i != NULL)
+    {
+        X->i = GB_MALLOC (GB_IMAX (X->nz, 1), int64_t, &(X->i_size)) ;
+        if (X->i == NULL) return (false) ;
+        GB_memcpy (X->i, A->i, X->nz * sizeof (int64_t), nthreads) ;
+    }
+    if (A->b != NULL)
+    {
+        X->b = GB_MALLOC (GB_IMAX (X->nz, 1), int8_t, &(X->b_size)) ;
+        if (X->b == NULL) return (false) ;
+        GB_memcpy (X->b, A->b, X->nz * sizeof (int8_t), nthreads) ;
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_plan_save
+//------------------------------------------------------------------------------
+
+void GB_AxB_saxpy3_plan_save
+(
+    GrB_Matrix C_output,            // matrix that keeps the plan
+    const GrB_Matrix C,             // C->p holds the counts from phase1
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    int C_sparsity,                 // C is sparse or hypersparse
+    GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    int nthreads_max,               // max # of threads from the Context
+    double chunk,                   // chunk size from the Context
+    const GB_saxpy3task_struct *SaxpyTasks, // tasks from phase0
+    int ntasks,                     // # of tasks (coarse and fine)
+    int nfine,                      // # of fine tasks
+    int nthreads,                   // # of threads to use
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free any prior plan and allocate the new one
+    //--------------------------------------------------------------------------
+
+    ASSERT (C_output != NULL && C_output->keep_plan) ;
+    GB_AxB_saxpy3_plan_free (C_output) ;
+    size_t header_size ;
+    GB_saxpy3_plan_struct *plan = GB_CALLOC (1, GB_saxpy3_plan_struct,
+        &header_size) ;
+    if (plan == NULL)
+    {
+        // out of memory; do not keep a plan
+        return ;
+    }
+    plan->header_size = header_size ;
+    C_output->saxpy3_plan = plan ;
+
+    //--------------------------------------------------------------------------
+    // copy the patterns of A and B, and the settings
+    //--------------------------------------------------------------------------
+
+    bool ok = GB_pattern_save (&(plan->A_pattern), A, nthreads_max, chunk,
+        Context) ;
+    ok = ok && GB_pattern_save (&(plan->B_pattern), B, nthreads_max, chunk,
+        Context) ;
+    plan->C_sparsity = C_sparsity ;
+    plan->AxB_method = AxB_method ;
+    plan->nthreads_max = nthreads_max ;
+    plan->chunk = chunk ;
+
+    //--------------------------------------------------------------------------
+    // copy the tasks and the counts in C->p
+    //--------------------------------------------------------------------------
+
+    const int64_t cnvec = C->nvec ;
+    if (ok)
+    {
+        plan->SaxpyTasks = GB_MALLOC (ntasks, GB_saxpy3task_struct,
+            &(plan->SaxpyTasks_size)) ;
+        plan->Cp = GB_MALLOC (cnvec + 1, int64_t, &(plan->Cp_size)) ;
+        ok = (plan->SaxpyTasks != NULL && plan->Cp != NULL) ;
+    }
+
+    if (!ok)
+    {
+        // out of memory; do not keep a plan
+        GB_AxB_saxpy3_plan_free (C_output) ;
+        return ;
+    }
+
+    memcpy (plan->SaxpyTasks, SaxpyTasks,
+        ntasks * sizeof (GB_saxpy3task_struct)) ;
+    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+        // the hash tables are allocated by each C=A*B
+        plan->SaxpyTasks [taskid].Hi = NULL ;
+        plan->SaxpyTasks [taskid].Hf = NULL ;
+        plan->SaxpyTasks [taskid].Hx = NULL ;
+    }
+    plan->ntasks = ntasks ;
+    plan->nfine = nfine ;
+    plan->nthreads = nthreads ;
+    int nth = GB_nthreads (cnvec, chunk, nthreads_max) ;
+    GB_memcpy (plan->Cp, C->p, (cnvec + 1) * sizeof (int64_t), nth) ;
+    GBURBLE ("(saxpy3 plan saved) ") ;
+}
+
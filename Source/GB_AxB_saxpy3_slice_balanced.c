@@ -19,6 +19,7 @@
 #define GB_FINE_WORK 2
 #define GB_MWORK_ALPHA 0.01
 #define GB_MWORK_BETA 0.10
+#define GB_PRIVATE_CONTENTION 8
 
 #define GB_FREE_WORKSPACE                   \
 {                                           \
@@ -109,7 +110,9 @@ static inline int64_t GB_hash_table_size
 //------------------------------------------------------------------------------
 
 // Compute the max flop count for any vector in a coarse task, determine the
-// hash table size, and construct the coarse task.
+// hash table size, and construct the coarse task.  If esc_ok is true and the
+// task would use the Hash method with at most GB_SAXPY3_ESC_FLMAX flops per
+// vector, it uses the ESC method instead.
 
 static inline void GB_create_coarse_task
 (
@@ -122,7 +125,8 @@ static inline void GB_create_coarse_task
     double chunk,
     int nthreads_max,
     int64_t *Coarse_Work,   // workspace for parallel reduction for flop count
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const bool esc_ok       // if true, the ESC method may be used
 )
 {
 
@@ -174,13 +178,16 @@ static inline void GB_create_coarse_task
     SaxpyTasks [taskid].start  = kfirst ;
     SaxpyTasks [taskid].end    = klast ;
     SaxpyTasks [taskid].vector = -1 ;
-    SaxpyTasks [taskid].hsize  = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    int64_t hsize = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    SaxpyTasks [taskid].hsize  = hsize ;
     SaxpyTasks [taskid].Hi     = NULL ;      // assigned later
     SaxpyTasks [taskid].Hf     = NULL ;      // assigned later
     SaxpyTasks [taskid].Hx     = NULL ;      // assigned later
     SaxpyTasks [taskid].my_cjnz = 0 ;        // for fine tasks only 
     SaxpyTasks [taskid].leader  = taskid ;
     SaxpyTasks [taskid].team_size = 1 ;
+    SaxpyTasks [taskid].use_esc = esc_ok && (hsize < cvlen) &&
+        (flmax <= GB_SAXPY3_ESC_FLMAX) ;
 }
 
 //------------------------------------------------------------------------------
@@ -196,6 +203,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     const GrB_Matrix A,             // input matrix A
     const GrB_Matrix B,             // input matrix B
     GrB_Desc_Value AxB_method,      // Default, Gustavson, or Hash
+    const int nthreads_limit,       // if > 0, use at most this many threads
     // outputs
     GB_saxpy3task_struct **SaxpyTasks_handle,
     size_t *SaxpyTasks_size_handle,
@@ -240,6 +248,10 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     //--------------------------------------------------------------------------
 
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    if (nthreads_limit > 0)
+    { 
+        nthreads_max = GB_IMIN (nthreads_max, nthreads_limit) ;
+    }
     chunk = chunk * 8 ;
 
     //--------------------------------------------------------------------------
@@ -440,6 +452,22 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         }
     }
 
+    //--------------------------------------------------------------------------
+    // determine if the ESC method and private workspaces can be used
+    //--------------------------------------------------------------------------
+
+    // The ESC method is only used for coarse tasks that would otherwise use
+    // the Hash method, when the method is selected automatically, no mask is
+    // applied during saxpy3, and A is sparse or hypersparse.
+
+    const bool esc_ok =
+        !(AxB_method == GxB_AxB_HASH || AxB_method == GxB_AxB_GUSTAVSON) &&
+        !(*apply_mask) && (A_is_hyper || GB_IS_SPARSE (A)) ;
+
+    // Fine Gustavson tasks can use private workspaces if no mask is applied
+    // during saxpy3.
+    const bool private_ok = !(*apply_mask) ;
+
     //--------------------------------------------------------------------------
     // determine target task size
     //--------------------------------------------------------------------------
@@ -640,7 +668,8 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             // kcoarse_start:kk-1 form a single coarse task
                             GB_create_coarse_task (kcoarse_start, kk-1,
                                 SaxpyTasks, nc++, Bflops, cvlen, chunk,
-                                nthreads_max, Coarse_Work, AxB_method) ;
+                                nthreads_max, Coarse_Work, AxB_method,
+                                esc_ok) ;
                         }
 
                         // next coarse task (if any) starts at kk+1
@@ -695,6 +724,17 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                         int64_t hsize = 
                             GB_hash_table_size (jflops, cvlen, AxB_method) ;
 
+                        // Each row of C(:,j) is updated jflops/cvlen times on
+                        // average, by up to nconcurrent threads at once, and
+                        // each private workspace costs O(cvlen) to clear and
+                        // merge.  Use private workspaces for a Gustavson team
+                        // when the contention for each row is high.
+                        int nconcurrent = GB_IMIN (team_size, (*nthreads)) ;
+                        bool use_private = private_ok && (hsize == cvlen) &&
+                            (nconcurrent > 1) &&
+                            (jflops * nconcurrent >= GB_PRIVATE_CONTENTION *
+                                ((double) team_size) * ((double) cvlen)) ;
+
                         // construct the fine tasks for C(:,j)=A*B(:,j)
                         int leader = nf ;
                         for (int fid = 0 ; fid < team_size ; fid++)
@@ -712,6 +752,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                             SaxpyTasks [nf].my_cjnz = 0 ;
                             SaxpyTasks [nf].leader = leader ;
                             SaxpyTasks [nf].team_size = team_size ;
+                            SaxpyTasks [nf].use_private = use_private ;
                             nf++ ;
                         }
                     }
@@ -723,7 +764,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                     // kcoarse_start:klast-1 form a single coarse task
                     GB_create_coarse_task (kcoarse_start, klast-1, SaxpyTasks,
                         nc++, Bflops, cvlen, chunk, nthreads_max,
-                        Coarse_Work, AxB_method) ;
+                        Coarse_Work, AxB_method, esc_ok) ;
                 }
 
             }
@@ -732,7 +773,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
                 // This coarse task is OK as-is.
                 GB_create_coarse_task (kfirst, klast-1, SaxpyTasks,
                     nc++, Bflops, cvlen, chunk, nthreads_max,
-                    Coarse_Work, AxB_method) ;
+                    Coarse_Work, AxB_method, esc_ok) ;
             }
         }
 
@@ -744,13 +785,13 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
         // entire computation in a single fine or coarse task
         //----------------------------------------------------------------------
 
-        // create a single coarse task: hash or Gustavson
+        // create a single coarse task: hash, ESC, or Gustavson
         GB_create_coarse_task (0, bnvec-1, SaxpyTasks, 0, Bflops, cvlen, 1, 1,
-            Coarse_Work, AxB_method) ;
+            Coarse_Work, AxB_method, esc_ok) ;
 
         int64_t hash_size = SaxpyTasks [0].hsize ;
         bool use_Gustavson = (hash_size == cvlen) ;
-        if (bnvec == 1 && !use_Gustavson)
+        if (bnvec == 1 && !use_Gustavson && !SaxpyTasks [0].use_esc)
         { 
             // convert the single coarse hash task into a single fine hash task
             SaxpyTasks [0].start  = 0 ;           // first entry in B(:,0)
@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_slice_msa: construct coarse MSA tasks for GB_AxB_saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Create the tasks for C<M>=A*B with the masked sparse accumulator (MSA)
+// method, where M is sparse or hypersparse and not complemented.  All tasks
+// are coarse Gustavson tasks, each computing C(:,kfirst:klast) with its own
+// Gustavson workspace.  The vectors of B are split evenly by their flop
+// counts, which include the work to scatter and gather M(:,j).
+
+#include "GB_AxB_saxpy3.h"
+
+#define GB_NTASKS_PER_THREAD 2
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (Coarse, int64_t) ;         \
+}
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORKSPACE ;                             \
+    GB_FREE_WORK (&SaxpyTasks, SaxpyTasks_size) ;   \
+}
+
+GrB_Info GB_AxB_saxpy3_slice_msa
+(
+    // inputs
+    GrB_Matrix C,                   // output matrix
+    const GrB_Matrix M,             // mask matrix, sparse or hypersparse
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B
+    const int nthreads_limit,       // if > 0, use at most this many threads
+    // outputs
+    GB_saxpy3task_struct **SaxpyTasks_handle,
+    size_t *SaxpyTasks_size_handle,
+    int *ntasks,                    // # of tasks created (all coarse)
+    int *nfine,                     // # of fine tasks created (always zero)
+    int *nthreads,                  // # of threads to use
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+
+    (*ntasks) = 0 ;
+    (*nfine) = 0 ;
+    (*nthreads) = 0 ;
+
+    ASSERT_MATRIX_OK (M, "M for saxpy3_slice_msa A*B", GB0) ;
+    ASSERT (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)) ;
+    ASSERT (!GB_PENDING (M)) ;
+    ASSERT (GB_JUMBLED_OK (M)) ;
+    ASSERT (!GB_ZOMBIES (M)) ;
+    ASSERT_MATRIX_OK (A, "A for saxpy3_slice_msa A*B", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for saxpy3_slice_msa A*B", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // determine the # of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    if (nthreads_limit > 0)
+    { 
+        nthreads_max = GB_IMIN (nthreads_max, nthreads_limit) ;
+    }
+    chunk = chunk * 8 ;
+
+    //--------------------------------------------------------------------------
+    // define result and workspace
+    //--------------------------------------------------------------------------
+
+    GB_saxpy3task_struct *restrict SaxpyTasks = NULL ;
+    size_t SaxpyTasks_size = 0 ;
+    GB_WERK_DECLARE (Coarse, int64_t) ;
+
+    const int64_t bnvec = B->nvec ;
+    const int64_t cvlen = A->vlen ;
+
+    //--------------------------------------------------------------------------
+    // compute flop counts for each vector of B and C
+    //--------------------------------------------------------------------------
+
+    int64_t Mwork = 0 ;
+    int64_t *restrict Bflops = C->p ;    // use C->p as workspace for Bflops
+    GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, Bflops, M, false, A, B,
+        Context)) ;
+    double total_flops = (double) Bflops [bnvec] ;
+    GBURBLE ("axbwork %g ", total_flops - Mwork) ;
+    if (Mwork > 0) GBURBLE ("mwork %g ", (double) Mwork) ;
+
+    //--------------------------------------------------------------------------
+    // split the vectors of B into coarse tasks
+    //--------------------------------------------------------------------------
+
+    (*nthreads) = GB_nthreads (total_flops, chunk, nthreads_max) ;
+    int ntasks_max = ((*nthreads) == 1) ? 1 :
+        (GB_NTASKS_PER_THREAD * (*nthreads)) ;
+    ntasks_max = (int) GB_IMIN (ntasks_max, GB_IMAX (bnvec, 1)) ;
+
+    GB_WERK_PUSH (Coarse, ntasks_max + 1, int64_t) ;
+    SaxpyTasks = GB_MALLOC_WORK (ntasks_max, GB_saxpy3task_struct,
+        &SaxpyTasks_size) ;
+    if (Coarse == NULL || SaxpyTasks == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // clear SaxpyTasks
+    memset (SaxpyTasks, 0, SaxpyTasks_size) ;
+
+    GB_pslice (Coarse, Bflops, bnvec, ntasks_max, true) ;
+
+    //--------------------------------------------------------------------------
+    // create the coarse MSA tasks
+    //--------------------------------------------------------------------------
+
+    int nc = 0 ;
+    for (int taskid = 0 ; taskid < ntasks_max ; taskid++)
+    {
+        int64_t kfirst = Coarse [taskid] ;
+        int64_t klast  = Coarse [taskid+1] - 1 ;
+        if (kfirst > klast) continue ;
+        SaxpyTasks [nc].start   = kfirst ;
+        SaxpyTasks [nc].end     = klast ;
+        SaxpyTasks [nc].vector  = -1 ;
+        SaxpyTasks [nc].hsize   = cvlen ;
+        SaxpyTasks [nc].Hi      = NULL ;      // assigned later
+        SaxpyTasks [nc].Hf      = NULL ;      // assigned later
+        SaxpyTasks [nc].Hx      = NULL ;      // assigned later
+        SaxpyTasks [nc].my_cjnz = 0 ;         // # entries found in phase5
+        SaxpyTasks [nc].leader  = nc ;
+        SaxpyTasks [nc].team_size = 1 ;
+        SaxpyTasks [nc].use_msa = true ;
+        nc++ ;
+    }
+
+    if (nc == 0)
+    {
+        // B has no vectors: create a single empty task
+        SaxpyTasks [0].start   = 0 ;
+        SaxpyTasks [0].end     = -1 ;
+        SaxpyTasks [0].vector  = -1 ;
+        SaxpyTasks [0].hsize   = cvlen ;
+        SaxpyTasks [0].leader  = 0 ;
+        SaxpyTasks [0].team_size = 1 ;
+        SaxpyTasks [0].use_msa = true ;
+        nc = 1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    (*ntasks) = nc ;
+    (*nthreads) = GB_IMIN (*nthreads, *ntasks) ;
+    (*SaxpyTasks_handle) = SaxpyTasks ;
+    (*SaxpyTasks_size_handle) = SaxpyTasks_size ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -29,7 +29,8 @@
 #include "GB_mxm.h"
 #include "GB_control.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE               \
@@ -154,7 +155,8 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
 
     info = GrB_NO_VALUE ;
 
-    #define GB_Asaxpy5B(add,mult,xname) GB (_Asaxpy5B_ ## add ## mult ## xname)
+    #define GB_Asaxpy5B(add,mult,xname) \
+        GB_FMV (_Asaxpy5B_ ## add ## mult ## xname)
     #define GB_AxB_WORKER(add,mult,xname)                               \
     {                                                                   \
         info = GB_Asaxpy5B (add,mult,xname) (C, A,                      \
@@ -0,0 +1,333 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_bitwise: C=A*B for boolean semirings, 64 columns at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_AxB_saxpy_bitwise computes C=A*B where C is bitmap, A is sparse or
+// hypersparse, B is bitmap or full, and the semiring is boolean: its monoid
+// is LOR or ANY, and its multiplier is LAND or PAIR.  This is the typical
+// case for a multi-source BFS, where B holds the frontiers of up to a few
+// hundred sources, one per column.  GB_AxB_saxpy_sparsity selects this method
+// when B has enough entries in each row (see GB_SAXPY_METHOD_BITWISE).
+
+// Each row B(k,:) is packed into nb = ceil(n/64) 64-bit words, with one bit
+// per column of B (n = B->vdim).  Then for each entry A(i,k), the words of
+// B(k,:) are OR'ed into the words of C(i,:), so that 64 entries of C are
+// computed at a time, with a single bitwise OR.  This is the same as
+// C(i,:) = OR (B(k,:)) for all k in the pattern of A(i,:).  If C is iso, only
+// the pattern of C is computed.  Otherwise, the LAND multiplier is used, A
+// and B are both boolean, and a second set of words holds the values of
+// B(k,:) and C(i,:).  Finally, the packed rows of C are expanded into C->b
+// (and C->x if C is not iso).
+
+// The entries of A are split across the threads, and the words of C are
+// updated atomically if more than one thread is used.  The mask is not
+// applied; it is left for the caller (see GB_accum_mask).
+
+#include "GB_AxB_saxpy.h"
+#include "GB_ek_slice.h"
+#include "GB_atomics.h"
+
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&Bpat, Bpat_size) ;           \
+    GB_FREE_WORK (&Bval, Bval_size) ;           \
+    GB_FREE_WORK (&Cpat, Cpat_size) ;           \
+    GB_FREE_WORK (&Cval, Cval_size) ;           \
+    GB_WERK_POP (A_ek_slicing, int64_t) ;       \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_phybix_free (C) ;                        \
+}
+
+// target |= b, atomically if the words of C are shared between threads
+#define GB_OR_WORD(target,b)                    \
+{                                               \
+    if (use_atomics)                            \
+    {                                           \
+        uint64_t t ;                            \
+        GB_ATOMIC_READ                          \
+        t = (target) ;                          \
+        if ((t & (b)) != (b))                   \
+        {                                       \
+            GB_ATOMIC_UPDATE                    \
+            (target) |= (b) ;                   \
+        }                                       \
+    }                                           \
+    else                                        \
+    {                                           \
+        (target) |= (b) ;                       \
+    }                                           \
+}
+
+GrB_Info GB_AxB_saxpy_bitwise       // C = A*B, with a boolean semiring
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_iso,               // true if C is iso
+    const GB_void *cscalar,         // iso value of C
+    const GrB_Matrix A,             // input matrix A, sparse or hypersparse
+    const GrB_Matrix B,             // input matrix B, bitmap or full
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
+
+    ASSERT_MATRIX_OK (A, "A for bitwise saxpy A*B", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    ASSERT_MATRIX_OK (B, "B for bitwise saxpy A*B", GB0) ;
+    ASSERT (GB_IS_BITMAP (B) || GB_IS_FULL (B)) ;
+    ASSERT (A->vdim == B->vlen) ;
+    ASSERT (C_iso || (A->type == GrB_BOOL && B->type == GrB_BOOL)) ;
+
+    uint64_t *restrict Bpat = NULL ; size_t Bpat_size = 0 ;
+    uint64_t *restrict Bval = NULL ; size_t Bval_size = 0 ;
+    uint64_t *restrict Cpat = NULL ; size_t Cpat_size = 0 ;
+    uint64_t *restrict Cval = NULL ; size_t Cval_size = 0 ;
+    GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    const bool *restrict Ax = C_iso ? NULL : ((bool *) A->x) ;
+    const bool A_iso = A->iso ;
+    const int64_t avlen = A->vlen ;
+
+    const int8_t *restrict Bb = B->b ;
+    const bool *restrict Bx = C_iso ? NULL : ((bool *) B->x) ;
+    const bool B_iso = B->iso ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t bvdim = B->vdim ;
+
+    const int64_t cvlen = avlen ;
+    const int64_t cvdim = bvdim ;
+
+    // each row of B and C is packed into nb words
+    const int64_t nb = (bvdim + 63) / 64 ;
+
+    //--------------------------------------------------------------------------
+    // construct C
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = GrB_BOOL ;
+    int64_t cnzmax = 1 ;
+    (void) GB_int64_multiply ((GrB_Index *) &cnzmax, cvlen, cvdim) ;
+    // set C->iso = C_iso   OK
+    GB_OK (GB_new_bix (&C, // existing header
+        ctype, cvlen, cvdim, GB_Ap_null, true, GxB_BITMAP, false,
+        GB_HYPER_SWITCH_DEFAULT, -1, cnzmax, true, C_iso, Context)) ;
+    C->magic = GB_MAGIC ;
+    if (C_iso)
+    { 
+        memcpy (C->x, cscalar, ctype->size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(bitwise saxpy) ") ;
+    Bpat = GB_MALLOC_WORK (GB_IMAX (bvlen * nb, 1), uint64_t, &Bpat_size) ;
+    Cpat = GB_CALLOC_WORK (GB_IMAX (cvlen * nb, 1), uint64_t, &Cpat_size) ;
+    bool ok = (Bpat != NULL && Cpat != NULL) ;
+    if (!C_iso)
+    { 
+        Bval = GB_MALLOC_WORK (GB_IMAX (bvlen * nb, 1), uint64_t, &Bval_size) ;
+        Cval = GB_CALLOC_WORK (GB_IMAX (cvlen * nb, 1), uint64_t, &Cval_size) ;
+        ok = ok && (Bval != NULL && Cval != NULL) ;
+    }
+    if (!ok)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int tid ;
+
+    //--------------------------------------------------------------------------
+    // pack each row of B into nb words
+    //--------------------------------------------------------------------------
+
+    // Each task packs the rows kstart:kend-1 of B, one column at a time.
+
+    int nthreads = GB_nthreads (bvlen * bvdim, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (int) GB_IMIN (8 * nthreads, bvlen) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t kstart, kend ;
+        GB_PARTITION (kstart, kend, bvlen, tid, ntasks) ;
+        const int64_t nwords = (kend - kstart) * nb ;
+        memset (Bpat + kstart * nb, 0, nwords * sizeof (uint64_t)) ;
+        if (Bval != NULL)
+        { 
+            memset (Bval + kstart * nb, 0, nwords * sizeof (uint64_t)) ;
+        }
+        for (int64_t j = 0 ; j < bvdim ; j++)
+        {
+            const int64_t jb = j / 64 ;
+            const int bit = (int) (j % 64) ;
+            const int64_t pB_start = j * bvlen ;
+            for (int64_t k = kstart ; k < kend ; k++)
+            {
+                // get B(k,j)
+                const int64_t pB = pB_start + k ;
+                const uint64_t bkj = (Bb == NULL) ? 1 : (Bb [pB] != 0) ;
+                Bpat [k * nb + jb] |= (bkj << bit) ;
+                if (Bval != NULL)
+                { 
+                    const uint64_t bval = bkj && Bx [B_iso ? 0 : pB] ;
+                    Bval [k * nb + jb] |= (bval << bit) ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // C(i,:) |= B(k,:) for each entry A(i,k)
+    //--------------------------------------------------------------------------
+
+    int A_nthreads, A_ntasks ;
+    GB_SLICE_MATRIX_WORK (A, 8, chunk, GB_nnz (A) * nb + A->nvec) ;
+    const bool use_atomics = (A_nthreads > 1) ;
+
+    #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < A_ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_Aslice [tid] ;
+        int64_t klast  = klast_Aslice  [tid] ;
+        for (int64_t kA = kfirst ; kA <= klast ; kA++)
+        {
+
+            //------------------------------------------------------------------
+            // get A(:,k) and B(k,:)
+            //------------------------------------------------------------------
+
+            const int64_t k = GBH (Ah, kA) ;
+            int64_t pA_start, pA_end ;
+            GB_get_pA (&pA_start, &pA_end, tid, kA,
+                kfirst, klast, pstart_Aslice, Ap, avlen) ;
+            const uint64_t *restrict Bpat_k = Bpat + k * nb ;
+
+            //------------------------------------------------------------------
+            // C(i,:) |= B(k,:) for each entry A(i,k) in A(:,k)
+            //------------------------------------------------------------------
+
+            if (Cval == NULL)
+            {
+                // C is iso: compute just its pattern
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    uint64_t *restrict Cpat_i = Cpat + Ai [pA] * nb ;
+                    for (int64_t jb = 0 ; jb < nb ; jb++)
+                    { 
+                        GB_OR_WORD (Cpat_i [jb], Bpat_k [jb]) ;
+                    }
+                }
+            }
+            else
+            {
+                // C is not iso: compute its pattern and values
+                const uint64_t *restrict Bval_k = Bval + k * nb ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    const int64_t i = Ai [pA] ;
+                    uint64_t *restrict Cpat_i = Cpat + i * nb ;
+                    for (int64_t jb = 0 ; jb < nb ; jb++)
+                    { 
+                        GB_OR_WORD (Cpat_i [jb], Bpat_k [jb]) ;
+                    }
+                    if (Ax [A_iso ? 0 : pA])
+                    {
+                        // C(i,:) = C(i,:) LOR (A(i,k) LAND B(k,:))
+                        uint64_t *restrict Cval_i = Cval + i * nb ;
+                        for (int64_t jb = 0 ; jb < nb ; jb++)
+                        { 
+                            GB_OR_WORD (Cval_i [jb], Bval_k [jb]) ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // expand the packed rows of C into C->b and C->x
+    //--------------------------------------------------------------------------
+
+    // Each task expands the rows istart:iend-1 of C, one column at a time.
+
+    int8_t *restrict Cb = C->b ;
+    bool *restrict Cx = C_iso ? NULL : ((bool *) C->x) ;
+    int64_t cnvals = 0 ;
+
+    nthreads = GB_nthreads (cvlen * cvdim, chunk, nthreads_max) ;
+    ntasks = (nthreads == 1) ? 1 : (int) GB_IMIN (8 * nthreads, cvlen) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:cnvals)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t istart, iend ;
+        GB_PARTITION (istart, iend, cvlen, tid, ntasks) ;
+        int64_t task_cnvals = 0 ;
+        for (int64_t j = 0 ; j < cvdim ; j++)
+        {
+            const int64_t jb = j / 64 ;
+            const int bit = (int) (j % 64) ;
+            const int64_t pC_start = j * cvlen ;
+            for (int64_t i = istart ; i < iend ; i++)
+            { 
+                // get C(i,j) from the packed C(i,:)
+                const int8_t cij = (int8_t) ((Cpat [i * nb + jb] >> bit) & 1) ;
+                Cb [pC_start + i] = cij ;
+                task_cnvals += cij ;
+            }
+            if (Cx != NULL)
+            {
+                for (int64_t i = istart ; i < iend ; i++)
+                { 
+                    // get the value of C(i,j) from the packed C(i,:)
+                    const uint64_t w = Cval [i * nb + jb] ;
+                    Cx [pC_start + i] = (bool) ((w >> bit) & 1) ;
+                }
+            }
+        }
+        cnvals += task_cnvals ;
+    }
+
+    C->nvals = cnvals ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C bitwise saxpy", GB0) ;
+    return (GrB_SUCCESS) ;
+}
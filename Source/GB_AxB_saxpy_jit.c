@@ -0,0 +1,97 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_jit: C<#M>=A*B, saxpy3 or bitmap method, via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Like GB_AxB_saxpy_generic, this method handles both the saxpy3 method (C
+// is sparse or hypersparse) and the bitmap saxpy method (C is bitmap or
+// full), with a separate JIT kernel for each.
+
+#include "GB_AxB_jit.h"
+
+typedef GrB_Info (*GB_jit_saxpy3_function)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads, const int do_sort,
+    GB_Context Context
+) ;
+
+typedef GrB_Info (*GB_jit_saxbit_function)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+) ;
+
+GrB_Info GB_AxB_saxpy_jit       // C<#M>=A*B, saxpy3 or bitmap, via the JIT
+(
+    GrB_Matrix C,                   // any sparsity
+    const GrB_Matrix M,
+    bool Mask_comp,
+    const bool Mask_struct,
+    const bool M_in_place,          // ignored if C is bitmap
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    const int saxpy_method,         // saxpy3 or bitmap method
+    // for saxpy3 only:
+    GB_saxpy3task_struct *restrict SaxpyTasks, // NULL if C is bitmap
+    int ntasks,
+    int nfine,
+    int nthreads,
+    const int do_sort,              // if true, sort in saxpy3
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_AxB_jit_enumify (&scode, C, M, Mask_struct, Mask_comp, semiring,
+        flipxy, A, B))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    bool saxpy3 = (saxpy_method == GB_SAXPY_METHOD_3) ;
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_mxm_family,
+        saxpy3 ? "AxB_saxpy3" : "AxB_saxbit", scode, semiring, NULL,
+        NULL, C->type, A->type, B->type) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    if (saxpy3)
+    { 
+        GB_jit_saxpy3_function GB_jit_kernel =
+            (GB_jit_saxpy3_function) dl_function ;
+        return (GB_jit_kernel (C, M, Mask_comp, Mask_struct, M_in_place,
+            A, B, SaxpyTasks, ntasks, nfine, nthreads, do_sort, Context)) ;
+    }
+    else
+    { 
+        GB_jit_saxbit_function GB_jit_kernel =
+            (GB_jit_saxbit_function) dl_function ;
+        return (GB_jit_kernel (C, M, Mask_comp, Mask_struct, A, B, Context)) ;
+    }
+}
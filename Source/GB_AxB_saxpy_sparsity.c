@@ -11,12 +11,62 @@
 // C<!M>=A*B, based on the sparsity structures of C (on input), M, A, and B,
 // and whether or not M is complemented.
 
+// If C is bitmap, A is sparse or hypersparse, B is bitmap or full, and the
+// semiring is boolean (LOR_LAND, ANY_PAIR, and related semirings; see
+// GB_bitwise_semiring), then C=A*B can be computed 64 columns at a time by
+// GB_AxB_saxpy_bitwise.  This is done if B has, on average, at least 4
+// entries in each row for each 64-bit word of the packed B(k,:).
+
 // TODO: When A or B are bitmapped or full, they can be transposed in-place.
 // TODO: give the user control over this decision
 
 //------------------------------------------------------------------------------
 
 #include "GB_AxB_saxpy.h"
+#include "GB_binop.h"
+
+//------------------------------------------------------------------------------
+// GB_bitwise_semiring: true if GB_AxB_saxpy_bitwise can use the semiring
+//------------------------------------------------------------------------------
+
+static inline bool GB_bitwise_semiring
+(
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    // the monoid must be LOR or ANY, and the multiplier must be LAND or PAIR,
+    // all with a boolean result.  For boolean operators, PLUS and MAX are
+    // renamed LOR, and TIMES and MIN are renamed LAND.
+    GrB_BinaryOp add = semiring->add->op ;
+    GrB_BinaryOp mult = semiring->multiply ;
+    if (add->ztype != GrB_BOOL || mult->ztype != GrB_BOOL)
+    { 
+        return (false) ;
+    }
+    GB_Opcode add_opcode = GB_boolean_rename (add->opcode) ;
+    if (add_opcode != GB_LOR_binop_code && add_opcode != GB_ANY_binop_code)
+    { 
+        return (false) ;
+    }
+    if (mult->opcode == GB_PAIR_binop_code)
+    { 
+        // C is iso; the values of A and B are not accessed
+        return (true) ;
+    }
+
+    // C=A*B with the LAND multiplier requires A and B to be boolean, so that
+    // no typecasting is needed
+    return (mult->xtype == GrB_BOOL && mult->ytype == GrB_BOOL
+        && GB_boolean_rename (mult->opcode) == GB_LAND_binop_code
+        && A->type == GrB_BOOL && B->type == GrB_BOOL) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy_sparsity
+//------------------------------------------------------------------------------
 
 void GB_AxB_saxpy_sparsity          // determine C_sparsity and method to use
 (
@@ -28,6 +78,7 @@ void GB_AxB_saxpy_sparsity          // determine C_sparsity and method to use
     const bool Mask_comp,           // if true, use !M
     const GrB_Matrix A,             // input A matrix
     const GrB_Matrix B,             // input B matrix
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
     GB_Context Context
 )
 {
@@ -229,6 +280,15 @@ void GB_AxB_saxpy_sparsity          // determine C_sparsity and method to use
         {
             (*saxpy_method) = GB_SAXPY_METHOD_3 ;
         }
+        else if ((A_sparsity == GxB_HYPERSPARSE || A_sparsity == GxB_SPARSE)
+            && (B_sparsity == GxB_BITMAP || B_sparsity == GxB_FULL)
+            && GB_bitwise_semiring (semiring, A, B)
+            && (double) GB_nnz (B) >=
+               4 * ((double) B->vlen) * ((double) ((B->vdim + 63) / 64)))
+        { 
+            // B = {S,H} * {B,F} with a boolean semiring, 64 columns at a time
+            (*saxpy_method) = GB_SAXPY_METHOD_BITWISE ;
+        }
         else
         {
             (*saxpy_method) = GB_SAXPY_METHOD_BITMAP ;
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+// GB_Context_check: check and print a GxB_Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GB_Context_check       // check a GraphBLAS Context
+(
+    const GxB_Context Context,  // GraphBLAS Context to print and check
+    const char *name,           // name of the Context, optional
+    int pr,                     // print level
+    FILE *f                     // file for output
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GBPR0 ("\n    GraphBLAS Context: %s ", ((name != NULL) ? name : "")) ;
+
+    if (Context == NULL)
+    { 
+        GBPR0 ("NULL\n") ;
+        return (GrB_NULL_POINTER) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check object
+    //--------------------------------------------------------------------------
+
+    GB_CHECK_MAGIC (Context) ;
+
+    GBPR0 ("\n") ;
+
+    int nthreads_max = Context->nthreads_max ;
+    double chunk = Context->chunk ;
+
+    GBPR0 ("    Context.nthreads: ") ;
+    if (nthreads_max <= GxB_DEFAULT)
+    { 
+        GBPR0 ("default\n") ;
+    }
+    else
+    { 
+        GBPR0 ("%d\n", nthreads_max) ;
+    }
+
+    GBPR0 ("    Context.chunk:    ") ;
+    if (chunk <= GxB_DEFAULT)
+    { 
+        GBPR0 ("default\n") ;
+    }
+    else
+    { 
+        GBPR0 ("%g\n", chunk) ;
+    }
+
+    if (Context == GB_Context_engaged ( ))
+    { 
+        GBPR0 ("    Context is engaged by this thread\n") ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+// GB_Context_engaged: the GxB_Context engaged by the calling user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each user thread can engage a single GxB_Context, which is held in a
+// thread-local variable.  GB_Context_nthreads_max and GB_Context_chunk return
+// the settings of the engaged Context, or the global settings if the calling
+// thread has not engaged a Context or if the Context does not set them.  If
+// the compiler does not support thread-local storage, no Context can be
+// engaged, and the global settings are always used.
+
+#include "GB.h"
+
+#if GB_HAS_THREAD_LOCAL
+static GB_THREAD_LOCAL GxB_Context GB_Context_thread = NULL ;
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Context_engaged: return the Context engaged by this thread, or NULL
+//------------------------------------------------------------------------------
+
+GxB_Context GB_Context_engaged (void)
+{ 
+    #if GB_HAS_THREAD_LOCAL
+    return (GB_Context_thread) ;
+    #else
+    return (NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_engaged_set: engage a Context (or none) for this thread
+//------------------------------------------------------------------------------
+
+// Returns false if thread-local storage is not available.
+
+bool GB_Context_engaged_set (GxB_Context Context)
+{ 
+    #if GB_HAS_THREAD_LOCAL
+    GB_Context_thread = Context ;
+    return (true) ;
+    #else
+    return (Context == NULL) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_nthreads_max: max # of threads for this thread
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+int GB_Context_nthreads_max (void)
+{
+    #if GB_HAS_THREAD_LOCAL
+    GxB_Context Context = GB_Context_thread ;
+    if (Context != NULL && Context->nthreads_max > GxB_DEFAULT)
+    { 
+        return (Context->nthreads_max) ;
+    }
+    #endif
+    return (GB_Global_nthreads_max_get ( )) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_chunk: chunk size for this thread
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+double GB_Context_chunk (void)
+{
+    #if GB_HAS_THREAD_LOCAL
+    GxB_Context Context = GB_Context_thread ;
+    if (Context != NULL && Context->chunk > GxB_DEFAULT)
+    { 
+        return (Context->chunk) ;
+    }
+    #endif
+    return (GB_Global_chunk_get ( )) ;
+}
@@ -161,6 +161,11 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
         GBPR0 ("%g\n", chunk) ;
     }
 
+    if (D->memory_budget > GxB_DEFAULT)
+    { 
+        GBPR0 ("    d.budget   = %g bytes\n", D->memory_budget) ;
+    }
+
     if (D->do_sort)
     { 
         GBPR0 ("    d.sort     = true\n") ;
@@ -71,6 +71,7 @@
 
 //  desc->nthreads_max          max # number of threads to use (auto if <= 0)
 //  desc->chunk                 chunk size for threadds
+//  desc->memory_budget         max bytes for C=A*B (global budget if <= 0)
 
 //      These are copied from the GrB_Descriptor into the Context.
 
@@ -111,6 +112,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     GrB_Desc_Value AxB_desc  = GxB_DEFAULT ;
     int nthreads_desc        = GxB_DEFAULT ;
     double chunk_desc        = GxB_DEFAULT ;
+    double budget_desc       = GxB_DEFAULT ;
     int do_sort_desc         = GxB_DEFAULT ;
 
     // non-defaults descriptor values
@@ -130,6 +132,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
         // threads to use in the current GraphBLAS operation.
         nthreads_desc = desc->nthreads_max ;
         chunk_desc = desc->chunk ;
+        budget_desc = desc->memory_budget ;
     }
 
     // check for valid values of each descriptor field
@@ -180,6 +183,7 @@ GrB_Info GB_Descriptor_get      // get the contents of a descriptor
     // it is available to any internal function that needs it.
     Context->nthreads_max = nthreads_desc ;
     Context->chunk = chunk_desc ;
+    Context->memory_budget = budget_desc ;
 
     return (GrB_SUCCESS) ;
 }
@@ -37,5 +37,16 @@ GrB_Info GB_Matrix_removeElement
     GB_Context Context
 ) ;
 
+GrB_Info GB_dual_setElement     // C(row,col) = scalar, or remove C(row,col)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const bool remove,              // if true, remove C(row,col)
+    const void *scalar,             // scalar to set, if remove is false
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code, // type of the scalar
+    GB_Context Context
+) ;
+
 #endif
 
@@ -15,6 +15,53 @@
 
 #include "GB_atomics.h"
 
+//------------------------------------------------------------------------------
+// free_pool magazines: per-thread caches in front of the free_pool
+//------------------------------------------------------------------------------
+
+// Each thread that allocates or frees small blocks claims a magazine, which
+// holds up to GB_MAGAZINE_SIZE blocks of each size 2^k, for k = 3 to
+// GB_MAGAZINE_KMAX.  A thread gets and puts blocks in its own magazine without
+// any synchronization.  The global free_pool is accessed, in an OpenMP
+// critical section, only when the magazine is empty (a batch of blocks is
+// moved from the free_pool into the magazine) or full (a batch is moved back).
+// The magazines require both OpenMP and thread-local storage.
+
+// When a thread exits, its magazine is flushed to the free_pool and its slot
+// is placed on a free list, to be claimed by another thread.  This requires
+// POSIX threads (a pthread key destructor), and is enabled when GraphBLAS is
+// compiled with -DGBPTHREAD.  Otherwise, the magazine of an exited thread is
+// kept until GrB_finalize, and threads that start after GB_NMAGAZINES threads
+// have claimed a magazine use the free_pool directly.
+
+#if defined ( _OPENMP ) && GB_HAS_THREAD_LOCAL
+#define GB_FREE_POOL_MAGAZINES 1
+#else
+#define GB_FREE_POOL_MAGAZINES 0
+#endif
+
+#if GB_FREE_POOL_MAGAZINES && defined ( GBPTHREAD )
+#include <pthread.h>
+#define GB_MAGAZINE_THREAD_EXIT 1
+#else
+#define GB_MAGAZINE_THREAD_EXIT 0
+#endif
+
+#define GB_NMAGAZINES 256       // max # of threads with a magazine
+#define GB_MAGAZINE_KMAX 12     // blocks of up to 4 KB are cached per thread
+#define GB_MAGAZINE_SIZE 32     // max # of blocks of each size in a magazine
+
+typedef struct
+{
+    void *list [16] ;           // list [k]: linked list of blocks of size 2^k
+    int32_t nblocks [16] ;      // # of blocks in list [k]
+    int64_t hits ;              // # of blocks obtained from the magazine
+    int64_t refills ;           // # of batches moved from the free_pool
+    int64_t flushes ;           // # of batches moved to the free_pool
+    int64_t pad [5] ;           // pad to 256 bytes to avoid false sharing
+}
+GB_magazine_struct ;
+
 //------------------------------------------------------------------------------
 // Global storage: for all threads in a user application that uses GraphBLAS
 //------------------------------------------------------------------------------
@@ -37,6 +84,12 @@ typedef struct
     int nthreads_max ;          // max number of threads to use
     double chunk ;              // chunk size for determining # threads to use
 
+    //--------------------------------------------------------------------------
+    // memory budget
+    //--------------------------------------------------------------------------
+
+    double memory_budget ;      // max bytes for C=A*B (<= 0: no limit)
+
     //--------------------------------------------------------------------------
     // hypersparsity and CSR/CSC format control
     //--------------------------------------------------------------------------
@@ -44,6 +97,7 @@ typedef struct
     float bitmap_switch [GxB_NBITMAP_SWITCH] ; // default bitmap_switch
     float hyper_switch ;        // default hyper_switch for new matrices
     bool is_csc ;               // default CSR/CSC format for new matrices
+    bool index32 ;              // default GxB_INDEX_32 for new matrices
 
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
@@ -63,6 +117,21 @@ typedef struct
     void   (* free_function    ) (void *)         ;     // required
     bool malloc_is_thread_safe ;   // default is true
 
+    //--------------------------------------------------------------------------
+    // placement of large blocks of memory (see GB_memory_placement)
+    //--------------------------------------------------------------------------
+
+    int memory_policy ;             // GxB_MEMORY_POLICY_DEFAULT, _INTERLEAVE,
+                                    // or _FIRST_TOUCH
+    int64_t huge_page_threshold ;   // use huge pages for blocks of this size
+                                    // or larger (0: never)
+
+    //--------------------------------------------------------------------------
+    // push/pull selection for GrB_mxv and GrB_vxm (see GB_AxB_meta_pushpull)
+    //--------------------------------------------------------------------------
+
+    int64_t pushpull_stats [2] ;    // # of times push and pull were selected
+
     //--------------------------------------------------------------------------
     // memory usage tracking: for testing and debugging only
     //--------------------------------------------------------------------------
@@ -138,6 +207,20 @@ typedef struct
     int64_t free_pool_nblocks [64] ;
     int64_t free_pool_limit [64] ;
 
+    // free_pool_magazine [0:nmagazines-1] are the per-thread caches in use.
+    // A thread holds its magazine only for the current free_pool_generation,
+    // which is advanced when all magazines are returned to the free_pool (by
+    // GrB_finalize and GrB_init).  magazine_free [0:nmagazines_free-1] are
+    // the slots released by threads that have exited.
+
+    #if GB_FREE_POOL_MAGAZINES
+    GB_magazine_struct free_pool_magazine [GB_NMAGAZINES] ;
+    int magazine_free [GB_NMAGAZINES] ;
+    #endif
+    int nmagazines ;
+    int nmagazines_free ;
+    int64_t free_pool_generation ;
+
     //--------------------------------------------------------------------------
     // CPU features
     //--------------------------------------------------------------------------
@@ -173,6 +256,9 @@ GB_Global_struct GB_Global =
     .nthreads_max = 1,
     .chunk = GB_CHUNK_DEFAULT,
 
+    // no memory budget
+    .memory_budget = 0,
+
     // min dimension                density
     #define GB_BITSWITCH_1          ((float) 0.04)
     #define GB_BITSWITCH_2          ((float) 0.05)
@@ -196,6 +282,7 @@ GB_Global_struct GB_Global =
     .hyper_switch = GB_HYPER_SWITCH_DEFAULT,
 
     .is_csc = false,    // default is GxB_BY_ROW
+    .index32 = false,   // default is 64-bit indices
 
     // abort function for debugging only
     .abort_function   = abort,
@@ -206,6 +293,13 @@ GB_Global_struct GB_Global =
     .free_function    = free,
     .malloc_is_thread_safe = true,
 
+    // placement of large blocks: left to the operating system by default
+    .memory_policy = GxB_MEMORY_POLICY_DEFAULT,
+    .huge_page_threshold = 0,
+
+    // push/pull statistics
+    .pushpull_stats = {0, 0},
+
     // malloc tracking, for testing, statistics, and debugging only
     .malloc_tracking = false,
     .nmalloc = 0,                // memory block counter
@@ -339,6 +433,11 @@ GB_Global_struct GB_Global =
         0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
 #endif
 
+    // no thread has a magazine yet
+    .nmagazines = 0,
+    .nmagazines_free = 0,
+    .free_pool_generation = 1,
+
     // CPU features
     .cpu_features_avx2 = false,         // x86_64 with AVX2
     .cpu_features_avx512f = false,      // x86_64 with AVX512f
@@ -508,6 +607,22 @@ double GB_Global_chunk_get (void)
     return (GB_Global.chunk) ;
 }
 
+//------------------------------------------------------------------------------
+// memory_budget
+//------------------------------------------------------------------------------
+
+GB_PUBLIC
+void GB_Global_memory_budget_set (double memory_budget)
+{ 
+    GB_Global.memory_budget = fmax (memory_budget, 0) ;
+}
+
+GB_PUBLIC
+double GB_Global_memory_budget_get (void)
+{ 
+    return (GB_Global.memory_budget) ;
+}
+
 //------------------------------------------------------------------------------
 // hyper_switch
 //------------------------------------------------------------------------------
@@ -585,6 +700,20 @@ bool GB_Global_is_csc_get (void)
     return (GB_Global.is_csc) ;
 }
 
+//------------------------------------------------------------------------------
+// index32
+//------------------------------------------------------------------------------
+
+void GB_Global_index32_set (bool index32)
+{ 
+    GB_Global.index32 = index32 ;
+}
+
+bool GB_Global_index32_get (void)
+{ 
+    return (GB_Global.index32) ;
+}
+
 //------------------------------------------------------------------------------
 // abort_function
 //------------------------------------------------------------------------------
@@ -886,6 +1015,63 @@ bool GB_Global_malloc_is_thread_safe_get (void)
     return (GB_Global.malloc_is_thread_safe) ;
 }
 
+//------------------------------------------------------------------------------
+// memory_policy
+//------------------------------------------------------------------------------
+
+void GB_Global_memory_policy_set (int memory_policy)
+{ 
+    GB_Global.memory_policy = memory_policy ;
+}
+
+int GB_Global_memory_policy_get (void)
+{ 
+    return (GB_Global.memory_policy) ;
+}
+
+//------------------------------------------------------------------------------
+// huge_page_threshold
+//------------------------------------------------------------------------------
+
+void GB_Global_huge_page_threshold_set (int64_t huge_page_threshold)
+{ 
+    GB_Global.huge_page_threshold = GB_IMAX (huge_page_threshold, 0) ;
+}
+
+int64_t GB_Global_huge_page_threshold_get (void)
+{ 
+    return (GB_Global.huge_page_threshold) ;
+}
+
+//------------------------------------------------------------------------------
+// pushpull_stats: # of times push (saxpy) or pull (dot) was selected
+//------------------------------------------------------------------------------
+
+void GB_Global_pushpull_stats_add (bool push)
+{
+    int64_t *stat = &(GB_Global.pushpull_stats [push ? 0 : 1]) ;
+    #pragma omp atomic update
+    (*stat)++ ;
+}
+
+void GB_Global_pushpull_stats_get (int64_t *npush, int64_t *npull)
+{
+    int64_t *stats = GB_Global.pushpull_stats ;
+    #pragma omp atomic read
+    (*npush) = stats [0] ;
+    #pragma omp atomic read
+    (*npull) = stats [1] ;
+}
+
+void GB_Global_pushpull_stats_clear (void)
+{ 
+    int64_t *stats = GB_Global.pushpull_stats ;
+    #pragma omp atomic write
+    stats [0] = 0 ;
+    #pragma omp atomic write
+    stats [1] = 0 ;
+}
+
 //------------------------------------------------------------------------------
 // malloc_tracking
 //------------------------------------------------------------------------------
@@ -1222,6 +1408,139 @@ double GB_Global_timing_get (int k)
 // the free block to be at least 8 bytes in size.
 #define GB_NEXT(p) ((void **) p) [0]
 
+#if GB_FREE_POOL_MAGAZINES
+
+// Each thread records the magazine it holds in thread-local storage.  The
+// magazine is valid only if GB_magazine_generation matches the global
+// free_pool_generation.  If GB_magazine_slot is -1, then all magazines were
+// in use when the thread asked for one, and the thread uses the global
+// free_pool directly until the next generation.
+static GB_THREAD_LOCAL int64_t GB_magazine_generation = 0 ;
+static GB_THREAD_LOCAL int GB_magazine_slot = -1 ;
+
+// GB_magazine_flush: return the blocks of one magazine to the free_pool
+static void GB_magazine_flush (int slot)
+{
+    // This must be done inside the GB_free_pool critical section.  All blocks
+    // are moved to the free_pool, even if this exceeds its limit, so that
+    // they can be freed by GB_free_pool_finalize.
+    GB_magazine_struct *mag = &(GB_Global.free_pool_magazine [slot]) ;
+    for (int k = 3 ; k <= GB_MAGAZINE_KMAX ; k++)
+    {
+        void *p = mag->list [k] ;
+        while (p != NULL)
+        { 
+            void *next = GB_NEXT (p) ;
+            GB_NEXT (p) = GB_Global.free_pool [k] ;
+            GB_Global.free_pool [k] = p ;
+            GB_Global.free_pool_nblocks [k]++ ;
+            p = next ;
+        }
+        mag->list [k] = NULL ;
+        mag->nblocks [k] = 0 ;
+    }
+}
+
+#if GB_MAGAZINE_THREAD_EXIT
+
+// The value of the pthread key of a thread holds its slot and the generation
+// in which it was claimed: (generation << 9) + slot + 1.  The value is never
+// NULL for a thread that holds a magazine, so the destructor is called when
+// the thread exits.
+static pthread_key_t GB_magazine_key ;
+static pthread_once_t GB_magazine_key_once = PTHREAD_ONCE_INIT ;
+#define GB_MAGAZINE_GEN(generation) \
+    (((uintptr_t) (generation)) & (UINTPTR_MAX >> 9))
+
+// GB_magazine_thread_exit: release the magazine of a thread that exits
+static void GB_magazine_thread_exit (void *value)
+{
+    uintptr_t v = (uintptr_t) value ;
+    int slot = (int) (v & 0x1FF) - 1 ;
+    uintptr_t generation = v >> 9 ;
+    #pragma omp critical(GB_free_pool)
+    {
+        // the slot is released only if it has not been returned already by
+        // GB_magazine_release_all
+        if (generation == GB_MAGAZINE_GEN (GB_Global.free_pool_generation)
+            && slot >= 0 && slot < GB_Global.nmagazines)
+        { 
+            GB_magazine_flush (slot) ;
+            GB_Global.magazine_free [GB_Global.nmagazines_free++] = slot ;
+        }
+    }
+}
+
+static void GB_magazine_key_create (void)
+{
+    pthread_key_create (&GB_magazine_key, GB_magazine_thread_exit) ;
+}
+
+#endif
+
+// GB_magazine: return the magazine of this thread, claiming one if needed
+static inline GB_magazine_struct *GB_magazine (bool claim)
+{
+    int64_t generation ;
+    GB_ATOMIC_READ
+    generation = GB_Global.free_pool_generation ;
+    if (GB_magazine_generation != generation)
+    {
+        if (!claim) return (NULL) ;
+        // claim a new magazine for this thread, reusing the slot of a thread
+        // that has exited if possible
+        int slot = -1 ;
+        #if GB_MAGAZINE_THREAD_EXIT
+        pthread_once (&GB_magazine_key_once, GB_magazine_key_create) ;
+        #endif
+        #pragma omp critical(GB_free_pool)
+        {
+            generation = GB_Global.free_pool_generation ;
+            if (GB_Global.nmagazines_free > 0)
+            { 
+                slot = GB_Global.magazine_free [--GB_Global.nmagazines_free] ;
+            }
+            else if (GB_Global.nmagazines < GB_NMAGAZINES)
+            { 
+                slot = GB_Global.nmagazines++ ;
+            }
+            if (slot >= 0)
+            { 
+                memset (&(GB_Global.free_pool_magazine [slot]), 0,
+                    sizeof (GB_magazine_struct)) ;
+            }
+        }
+        GB_magazine_generation = generation ;
+        GB_magazine_slot = slot ;
+        #if GB_MAGAZINE_THREAD_EXIT
+        if (slot >= 0)
+        { 
+            uintptr_t v = (GB_MAGAZINE_GEN (generation) << 9)
+                + (uintptr_t) (slot + 1) ;
+            pthread_setspecific (GB_magazine_key, (void *) v) ;
+        }
+        #endif
+    }
+    return ((GB_magazine_slot < 0) ? NULL :
+        &(GB_Global.free_pool_magazine [GB_magazine_slot])) ;
+}
+
+// GB_magazine_release_all: return all magazines to the free_pool
+static void GB_magazine_release_all (void)
+{
+    // This must be done inside the GB_free_pool critical section.
+    for (int slot = 0 ; slot < GB_Global.nmagazines ; slot++)
+    { 
+        GB_magazine_flush (slot) ;
+    }
+    // all threads must claim a new magazine
+    GB_Global.nmagazines = 0 ;
+    GB_Global.nmagazines_free = 0 ;
+    GB_Global.free_pool_generation++ ;
+}
+
+#endif
+
 // free_pool_init: initialize the free_pool
 GB_PUBLIC
 void GB_Global_free_pool_init (bool clear)
@@ -1237,6 +1556,10 @@ void GB_Global_free_pool_init (bool clear)
                     GB_Global.free_pool [k] = NULL ;
                     GB_Global.free_pool_nblocks [k] = 0 ;
                 }
+                // all threads must claim a new magazine
+                GB_Global.nmagazines = 0 ;
+                GB_Global.nmagazines_free = 0 ;
+                GB_Global.free_pool_generation++ ;
             }
             // set the default free_pool_limit
             for (int k = 0 ; k < 64 ; k++)
@@ -1264,6 +1587,18 @@ void GB_Global_free_pool_init (bool clear)
     #endif
 }
 
+// free_pool_flush: return all per-thread magazines to the free_pool
+GB_PUBLIC
+void GB_Global_free_pool_flush (void)
+{
+    #if GB_FREE_POOL_MAGAZINES
+    #pragma omp critical(GB_free_pool)
+    {
+        GB_magazine_release_all ( ) ;
+    }
+    #endif
+}
+
 #ifdef GB_DEBUG
 // check if a block is valid
 static inline void GB_Global_free_pool_check (void *p, int k, char *where)
@@ -1283,14 +1618,53 @@ void *GB_Global_free_pool_get (int k)
     #ifdef _OPENMP
         void *p = NULL ;
         ASSERT (k >= 3 && k < 64) ;
-        #pragma omp critical(GB_free_pool)
+        #if GB_FREE_POOL_MAGAZINES
+        GB_magazine_struct *mag =
+            (k <= GB_MAGAZINE_KMAX) ? GB_magazine (true) : NULL ;
+        if (mag != NULL)
         {
-            p = GB_Global.free_pool [k] ;
+            if (mag->list [k] == NULL)
+            {
+                // refill the magazine with up to half its capacity
+                int32_t nrefill = GB_MAGAZINE_SIZE / 2 ;
+                bool refilled = false ;
+                #pragma omp critical(GB_free_pool)
+                {
+                    while (mag->nblocks [k] < nrefill &&
+                           GB_Global.free_pool [k] != NULL)
+                    { 
+                        void *q = GB_Global.free_pool [k] ;
+                        GB_Global.free_pool [k] = GB_NEXT (q) ;
+                        GB_Global.free_pool_nblocks [k]-- ;
+                        GB_NEXT (q) = mag->list [k] ;
+                        mag->list [k] = q ;
+                        mag->nblocks [k]++ ;
+                        refilled = true ;
+                    }
+                }
+                if (refilled) mag->refills++ ;
+            }
+            p = mag->list [k] ;
             if (p != NULL)
+            { 
+                // remove the block from the magazine
+                mag->list [k] = GB_NEXT (p) ;
+                mag->nblocks [k]-- ;
+                mag->hits++ ;
+            }
+        }
+        else
+        #endif
+        {
+            #pragma omp critical(GB_free_pool)
             {
-                // remove the block from the kth free_pool
-                GB_Global.free_pool_nblocks [k]-- ;
-                GB_Global.free_pool [k] = GB_NEXT (p) ;
+                p = GB_Global.free_pool [k] ;
+                if (p != NULL)
+                {
+                    // remove the block from the kth free_pool
+                    GB_Global.free_pool_nblocks [k]-- ;
+                    GB_Global.free_pool [k] = GB_NEXT (p) ;
+                }
             }
         }
         if (p != NULL)
@@ -1317,17 +1691,62 @@ bool GB_Global_free_pool_put (void *p, int k)
         GB_Global_free_pool_check (p, k, "put") ;
         #endif
         bool returned_to_pool = false ;
-        #pragma omp critical(GB_free_pool)
+        #if GB_FREE_POOL_MAGAZINES
+        GB_magazine_struct *mag =
+            (k <= GB_MAGAZINE_KMAX) ? GB_magazine (true) : NULL ;
+        if (mag != NULL)
         {
-            returned_to_pool =
-                (GB_Global.free_pool_nblocks [k] <
-                 GB_Global.free_pool_limit [k]) ;
+            // the magazine holds no more blocks than the free_pool limit
+            int64_t limit ;
+            GB_ATOMIC_READ
+            limit = GB_Global.free_pool_limit [k] ;
+            int32_t capacity = (int32_t) GB_IMIN (limit, GB_MAGAZINE_SIZE) ;
+            if (mag->nblocks [k] >= capacity)
+            {
+                // flush the magazine down to half its capacity
+                int32_t nkeep = capacity / 2 ;
+                bool flushed = false ;
+                #pragma omp critical(GB_free_pool)
+                {
+                    while (mag->nblocks [k] > nkeep &&
+                           GB_Global.free_pool_nblocks [k] <
+                           GB_Global.free_pool_limit [k])
+                    { 
+                        void *q = mag->list [k] ;
+                        mag->list [k] = GB_NEXT (q) ;
+                        mag->nblocks [k]-- ;
+                        GB_NEXT (q) = GB_Global.free_pool [k] ;
+                        GB_Global.free_pool [k] = q ;
+                        GB_Global.free_pool_nblocks [k]++ ;
+                        flushed = true ;
+                    }
+                }
+                if (flushed) mag->flushes++ ;
+            }
+            returned_to_pool = (mag->nblocks [k] < capacity) ;
             if (returned_to_pool)
+            { 
+                // add the block to the head of the magazine
+                GB_NEXT (p) = mag->list [k] ;
+                mag->list [k] = p ;
+                mag->nblocks [k]++ ;
+            }
+        }
+        else
+        #endif
+        {
+            #pragma omp critical(GB_free_pool)
             {
-                // add the block to the head of the free_pool list
-                GB_Global.free_pool_nblocks [k]++ ;
-                GB_NEXT (p) = GB_Global.free_pool [k] ;
-                GB_Global.free_pool [k] = p ;
+                returned_to_pool =
+                    (GB_Global.free_pool_nblocks [k] <
+                     GB_Global.free_pool_limit [k]) ;
+                if (returned_to_pool)
+                {
+                    // add the block to the head of the free_pool list
+                    GB_Global.free_pool_nblocks [k]++ ;
+                    GB_NEXT (p) = GB_Global.free_pool [k] ;
+                    GB_Global.free_pool [k] = p ;
+                }
             }
         }
         return (returned_to_pool) ;
@@ -1373,6 +1792,32 @@ void GB_Global_free_pool_dump (int pr)
                 fail = true ;
             }
         }
+        #if GB_FREE_POOL_MAGAZINES
+        for (int slot = 0 ; slot < GB_Global.nmagazines && !fail ; slot++)
+        {
+            GB_magazine_struct *mag = &(GB_Global.free_pool_magazine [slot]) ;
+            for (int k = 3 ; k <= GB_MAGAZINE_KMAX && !fail ; k++)
+            {
+                int64_t nblocks = mag->nblocks [k] ;
+                if (nblocks != 0 && pr > 0)
+                {
+                    printf ("magazine %3d pool %2d: " GBd " blocks\n",
+                        slot, k, nblocks) ;
+                }
+                int64_t nblocks_actual = 0 ;
+                void *p = mag->list [k] ;
+                for ( ; p != NULL && !fail ; p = GB_NEXT (p))
+                {
+                    size_t size = GB_Global_memtable_size (p) ;
+                    nblocks_actual++ ;
+                    fail = fail || (size != ((size_t) 1) << k) ;
+                    fail = fail || (nblocks_actual > nblocks) ;
+                }
+                fail = fail || (nblocks_actual != nblocks) ;
+                if (fail && pr > 0) printf ("    fail\n") ;
+            }
+        }
+        #endif
     }
     ASSERT (!fail) ;
     #endif
@@ -1387,10 +1832,10 @@ int64_t GB_Global_free_pool_limit_get (int k)
         int64_t nblocks = 0 ;
         if (k >= 3 && k < 64)
         {
-            #pragma omp critical(GB_free_pool)
-            {
-                nblocks = GB_Global.free_pool_limit [k] ;
-            }
+            // no critical section is needed; this is called for every
+            // malloc and free of the GB_*_memory methods
+            GB_ATOMIC_READ
+            nblocks = GB_Global.free_pool_limit [k] ;
         }
         return (nblocks) ;
     #else
@@ -1407,6 +1852,7 @@ void GB_Global_free_pool_limit_set (int k, int64_t nblocks)
         #ifdef _OPENMP
             #pragma omp critical(GB_free_pool)
             {
+                GB_ATOMIC_WRITE
                 GB_Global.free_pool_limit [k] = nblocks ;
             }
         #else
@@ -1429,11 +1875,50 @@ int64_t GB_Global_free_pool_nblocks_total (void)
         {
             nblocks += GB_Global.free_pool_nblocks [k] ;
         }
+        #if GB_FREE_POOL_MAGAZINES
+        // include the blocks held in the per-thread magazines
+        for (int slot = 0 ; slot < GB_Global.nmagazines ; slot++)
+        {
+            for (int k = 3 ; k <= GB_MAGAZINE_KMAX ; k++)
+            {
+                nblocks += GB_Global.free_pool_magazine [slot].nblocks [k] ;
+            }
+        }
+        #endif
     }
     #endif
     return (nblocks) ;
 }
 
+// free_pool_stats: statistics for the magazine of the calling thread
+GB_PUBLIC
+void GB_Global_free_pool_stats
+(
+    int64_t *hits,          // # of blocks obtained from the magazine
+    int64_t *refills,       // # of batches moved from the free_pool
+    int64_t *flushes,       // # of batches moved to the free_pool
+    int64_t *nblocks        // # of blocks currently held in the magazine
+)
+{
+    (*hits) = 0 ;
+    (*refills) = 0 ;
+    (*flushes) = 0 ;
+    (*nblocks) = 0 ;
+    #if GB_FREE_POOL_MAGAZINES
+    GB_magazine_struct *mag = GB_magazine (false) ;
+    if (mag != NULL)
+    {
+        (*hits) = mag->hits ;
+        (*refills) = mag->refills ;
+        (*flushes) = mag->flushes ;
+        for (int k = 3 ; k <= GB_MAGAZINE_KMAX ; k++)
+        { 
+            (*nblocks) += mag->nblocks [k] ;
+        }
+    }
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // get_wtime: return current wallclock time
 //------------------------------------------------------------------------------
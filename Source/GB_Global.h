@@ -35,6 +35,9 @@ GB_PUBLIC int      GB_Global_omp_get_max_threads (void) ;
 GB_PUBLIC void     GB_Global_chunk_set (double chunk) ;
 GB_PUBLIC double   GB_Global_chunk_get (void) ;
 
+GB_PUBLIC void     GB_Global_memory_budget_set (double memory_budget) ;
+GB_PUBLIC double   GB_Global_memory_budget_get (void) ;
+
 GB_PUBLIC void     GB_Global_hyper_switch_set (float hyper_switch) ;
 GB_PUBLIC float    GB_Global_hyper_switch_get (void) ;
 
@@ -47,6 +50,9 @@ GB_PUBLIC void     GB_Global_bitmap_switch_default (void) ;
           void     GB_Global_is_csc_set (bool is_csc) ;
           bool     GB_Global_is_csc_get (void) ;
 
+          void     GB_Global_index32_set (bool index32) ;
+          bool     GB_Global_index32_get (void) ;
+
 GB_PUBLIC void     GB_Global_abort_function_set
                         (void (* abort_function) (void)) ;
 GB_PUBLIC void     GB_Global_abort_function (void) ;
@@ -66,6 +72,17 @@ GB_PUBLIC void     GB_Global_malloc_is_thread_safe_set
                         (bool malloc_is_thread_safe) ;
 GB_PUBLIC bool     GB_Global_malloc_is_thread_safe_get (void) ;
 
+          void     GB_Global_memory_policy_set (int memory_policy) ;
+          int      GB_Global_memory_policy_get (void) ;
+          void     GB_Global_huge_page_threshold_set
+                        (int64_t huge_page_threshold) ;
+          int64_t  GB_Global_huge_page_threshold_get (void) ;
+
+          void     GB_Global_pushpull_stats_add (bool push) ;
+          void     GB_Global_pushpull_stats_get (int64_t *npush,
+                        int64_t *npull) ;
+          void     GB_Global_pushpull_stats_clear (void) ;
+
 GB_PUBLIC void     GB_Global_malloc_tracking_set (bool malloc_tracking) ;
           bool     GB_Global_malloc_tracking_get (void) ;
 
@@ -130,6 +147,9 @@ GB_PUBLIC void     GB_Global_free_pool_dump (int pr) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_limit_get (int k) ;
 GB_PUBLIC void     GB_Global_free_pool_limit_set (int k, int64_t nblocks) ;
 GB_PUBLIC int64_t  GB_Global_free_pool_nblocks_total (void) ;
+GB_PUBLIC void     GB_Global_free_pool_flush (void) ;
+GB_PUBLIC void     GB_Global_free_pool_stats (int64_t *hits,
+                        int64_t *refills, int64_t *flushes, int64_t *nblocks) ;
 
 typedef int (* GB_flush_function_t) (void) ;
 typedef int (* GB_printf_function_t) (const char *restrict format, ...) ;
@@ -35,10 +35,15 @@ GrB_Info GB_Iterator_attach
     }
 
     //--------------------------------------------------------------------------
-    // finish any pending work on the matrix
+    // finish any pending work on the matrix, and unpack it if packed
     //--------------------------------------------------------------------------
 
-    if (GB_ANY_PENDING_WORK (A))
+    // The iterator accesses the content of A directly, so a packed matrix is
+    // unpacked in place.  It is packed again by the next GrB_wait (A,
+    // GrB_COMPLETE).
+
+    GB_DEFERRED_FLUSH ;
+    if (GB_ANY_PENDING_WORK (A) || A->magic == GB_MAGIC_PACKED)
     {
         GrB_Info info ;
         GB_CONTEXT ("GxB_Iterator_attach") ;
@@ -48,6 +53,7 @@ GrB_Info GB_Iterator_attach
             Context->nthreads_max = desc->nthreads_max ;
             Context->chunk = desc->chunk ;
         }
+        GB_OK (GB_packed_unpack (A, Context)) ;
         GB_OK (GB_wait (A, "A", Context)) ;
     }
 
@@ -21,10 +21,13 @@ void GB_Matrix_free             // free a matrix
     if (Ahandle != NULL)
     {
         GrB_Matrix A = *Ahandle ;
-        if (A != NULL && (A->magic == GB_MAGIC || A->magic == GB_MAGIC2))
+        if (A != NULL && (A->magic == GB_MAGIC || A->magic == GB_MAGIC2
+            || A->magic == GB_MAGIC_PACKED))
         {
-            // free all content of A
+            // discard any work deferred on A, and free all content of A
+            GB_deferred_drop (A) ;
             size_t header_size = A->header_size ;
+            GB_AxB_saxpy3_plan_free (A) ;
             GB_phybix_free (A) ;
             if (!(A->static_header))
             { 
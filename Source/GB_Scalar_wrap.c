@@ -55,6 +55,13 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
 
     s->Y = NULL ;
     s->Y_shallow = false ;
+    s->T = NULL ;
+    s->transpose_cache = false ;
+    s->dual_format = false ;
+    s->bitmap_packed = false ;
+    s->index32 = false ;
+    s->keep_plan = false ;
+    s->saxpy3_plan = NULL ;
 
     s->nvals = 0 ;
 
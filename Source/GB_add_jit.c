@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GB_add_jit: C=A+B, C<#M>=A+B, eWiseAdd or eWiseUnion, via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_ewise_jit.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_add_jit         // C=A+B, C<#M>=A+B, eWiseAdd or eWiseUnion
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar,    // of type op->xtype
+    const GB_void *beta_scalar,     // of type op->ytype
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_ewise_jit_enumify (&scode, C, C_sparsity, M, Mask_struct,
+        Mask_comp, op, false, true, A, B))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_ewise_family,
+        "add", scode, NULL, NULL, (GB_Operator) op, C->type, A->type,
+        B->type) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (C, C_sparsity, M, Mask_struct, Mask_comp, A, B,
+        is_eWiseUnion, alpha_scalar, beta_scalar, Ch_is_Mh, C_to_M, C_to_A,
+        C_to_B, TaskList, C_ntasks, C_nthreads, Context)) ;
+}
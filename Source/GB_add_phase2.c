@@ -32,8 +32,10 @@
 #include "GB_unused.h"
 #include "GB_ek_slice.h"
 #include "GB_stringify.h"
+#include "GB_ewise_jit.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #undef  GB_FREE_WORKSPACE
@@ -340,7 +342,7 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_AaddB(mult,xname) GB (_AaddB_ ## mult ## xname)
+            #define GB_AaddB(mult,xname) GB_FMV (_AaddB_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                             \
             {                                                               \
@@ -376,6 +378,29 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
             }
 
         #endif
+
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_add_jit (C, C_sparsity, M, Mask_struct, Mask_comp, op,
+                A, B, is_eWiseUnion, alpha_scalar, beta_scalar, Ch_is_Mh,
+                C_to_M, C_to_A, C_to_B, TaskList, C_ntasks, C_nthreads,
+                Context) ;
+            if (info == GrB_OUT_OF_MEMORY)
+            { 
+                // out of memory
+                GB_FREE_ALL ;
+                return (info) ;
+            }
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit add: %s) ", op->name) ;
+            }
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -184,6 +184,12 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
             tnrows, tncols, A_transpose ? " (transposed)" : "") ;
     }
 
+    // in nonblocking mode, C=op(C) may be deferred (see GB_deferred.c)
+    if (GB_deferred_apply (C, M, Mask_comp, accum, op, A, A_transpose))
+    { 
+        return (GrB_SUCCESS) ;
+    }
+
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
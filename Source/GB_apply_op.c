@@ -23,8 +23,10 @@
 #include "GB_ek_slice.h"
 #include "GB_unused.h"
 #ifndef GBCUDA_DEV
-#include "GB_unop__include.h"
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_unop__include.h"
+#include "GB_fmv_include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL                         \
@@ -353,7 +355,7 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
             //------------------------------------------------------------------
 
             #define GB_unop_apply(unop,zname,aname) \
-                GB (_unop_apply_ ## unop ## zname ## aname)
+                GB_FMV (_unop_apply_ ## unop ## zname ## aname)
 
             #define GB_WORKER(unop,zname,ztype,aname,atype)             \
             {                                                           \
@@ -466,7 +468,8 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
                 // define the worker for the switch factory
                 //--------------------------------------------------------------
 
-                #define GB_bind1st(binop,xname) GB (_bind1st_ ## binop ## xname)
+                #define GB_bind1st(binop,xname) \
+                    GB_FMV (_bind1st_ ## binop ## xname)
                 #define GB_BINOP_WORKER(binop,xname)                    \
                 {                                                       \
                     if (GB_bind1st (binop, xname) (Cx, scalarx, Ax,     \
@@ -500,7 +503,8 @@ GrB_Info GB_apply_op        // apply a unary op, idxunop, or binop, Cx = op (A)
                 // define the worker for the switch factory
                 //--------------------------------------------------------------
 
-                #define GB_bind2nd(binop,xname) GB (_bind2nd_ ## binop ## xname)
+                #define GB_bind2nd(binop,xname) \
+                    GB_FMV (_bind2nd_ ## binop ## xname)
                 #undef  GB_BINOP_WORKER
                 #define GB_BINOP_WORKER(binop,xname)                    \
                 {                                                       \
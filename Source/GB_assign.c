@@ -24,14 +24,16 @@
 
 // Compare with GB_subassign, which uses M and C_replace differently
 
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_Matrix_free (&C2) ;          \
-    GB_Matrix_free (&M2) ;          \
-    GB_Matrix_free (&A2) ;          \
-    GB_Matrix_free (&SubMask) ;     \
-    GB_FREE_WORK (&I2, I2_size) ;   \
-    GB_FREE_WORK (&J2, J2_size) ;   \
+#define GB_FREE_ALL                      \
+{                                        \
+    GB_Matrix_free (&C2) ;               \
+    GB_Matrix_free (&M2) ;               \
+    GB_Matrix_free (&A2) ;               \
+    GB_Matrix_free (&SubMask) ;          \
+    GB_FREE_WORK (&I2, I2_size) ;        \
+    GB_FREE_WORK (&J2, J2_size) ;        \
+    GB_PACKED_VIEW_FREE (M_view, M_in) ; \
+    GB_PACKED_VIEW_FREE (A_view, A_in) ; \
 }
 
 #include "GB_assign.h"
@@ -84,16 +86,22 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
     GrB_Type atype = NULL ;
     int64_t ni, nj, nI, nJ, Icolon [3], Jcolon [3] ;
     int Ikind, Jkind ;
-    ASSERT_MATRIX_OK (C_in, "C_in for assign", GB0) ;
     int subassign_method ;
 
+    // unpack C, and get unpacked copies of any packed inputs
+    GrB_Matrix M_view = M_in, A_view = A_in ;
+    GB_OK (GB_packed_unpack (C_in, Context)) ;
+    GB_OK (GB_packed_view (&M_view, M_in, Context)) ;
+    GB_OK (GB_packed_view (&A_view, A_in, Context)) ;
+    ASSERT_MATRIX_OK (C_in, "C_in for assign", GB0) ;
+
     GB_OK (GB_assign_prep (&C, &M, &A, &subassign_method, &C2, &M2, &A2,
         &C2_header, &M2_header, &A2_header, &MT_header, &AT_header,
         &I, &I2, &I2_size, &ni, &nI, &Ikind, Icolon,
         &J, &J2, &J2_size, &nj, &nJ, &Jkind, Jcolon,
         &atype, C_in, &C_replace, &assign_kind,
-        M_in, Mask_comp, Mask_struct, M_transpose, accum,
-        A_in, A_transpose, Rows, nRows_in, Cols, nCols_in,
+        M_view, Mask_comp, Mask_struct, M_transpose, accum,
+        A_view, A_transpose, Rows, nRows_in, Cols, nCols_in,
         scalar_expansion, scalar, scalar_code, Context)) ;
 
     ASSERT_MATRIX_OK (C, "initial C for assign", GB0) ;
@@ -104,6 +112,7 @@ GrB_Info GB_assign                  // C<M>(Rows,Cols) += A or A'
         // GB_assign_prep has handled the entire assignment itself
         ASSERT_MATRIX_OK (C_in, "QUICK : Final C for assign", GB0) ;
         ASSERT (C == C_in) ;
+        GB_FREE_ALL ;
         return (GrB_SUCCESS) ;
     }
 
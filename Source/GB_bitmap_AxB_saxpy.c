@@ -9,9 +9,11 @@
 
 #include "GB_bitmap_AxB_saxpy.h"
 #include "GB_AxB_saxpy_generic.h"
+#include "GB_AxB_jit.h"
 #include "GB_AxB__include1.h"
 #ifndef GBCUDA_DEV
-#include "GB_AxB__include2.h"
+#define GB_FMV_HEADER "GB_AxB__include2.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL GB_phybix_free (C) ;
@@ -129,7 +131,7 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
             //------------------------------------------------------------------
 
             #define GB_AsaxbitB(add,mult,xname)  \
-                GB (_AsaxbitB_ ## add ## mult ## xname)
+                GB_FMV (_AsaxbitB_ ## add ## mult ## xname)
 
             #define GB_AxB_WORKER(add,mult,xname)                       \
             {                                                           \
@@ -154,6 +156,23 @@ GrB_Info GB_bitmap_AxB_saxpy        // C = A*B where C is bitmap
 
         #endif
 
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_AxB_saxpy_jit (C, M, Mask_comp, Mask_struct,
+                true, A, B, semiring, flipxy, GB_SAXPY_METHOD_BITMAP,
+                NULL, 0, 0, 0, 0,
+                Context) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit bitmap saxpy) ") ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // generic method
         //----------------------------------------------------------------------
@@ -62,8 +62,10 @@
 #include "GB_unused.h"
 #include "GB_ek_slice.h"
 #include "GB_stringify.h"
+#include "GB_ewise_jit.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE                   \
@@ -229,7 +231,7 @@ GrB_Info GB_bitmap_emult    // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
             //------------------------------------------------------------------
 
             #define GB_AemultB_bitmap(mult,xname) \
-                GB (_AemultB_bitmap_ ## mult ## xname)
+                GB_FMV (_AemultB_bitmap_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                             \
             {                                                               \
@@ -254,6 +256,22 @@ GrB_Info GB_bitmap_emult    // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
             }
 
         #endif
+
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_emult_bitmap_jit (C, ewise_method, M, Mask_struct,
+                Mask_comp, op, A, B, M_ek_slicing, M_ntasks, M_nthreads,
+                C_nthreads, Context) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit bitmap emult: %s) ", op->name) ;
+            }
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// GB_bitmap_pack: pack the bitmap of a matrix into bits
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The bitmap A->b of a bitmap matrix holds one int8_t per entry.
+// GB_bitmap_pack replaces it with an array of uint64_t words with one bit per
+// entry: A(i,j) is present if bit (p % 64) of word (p / 64) is set, where
+// p = i + j*vlen is the position of A(i,j) in A->b (with i and j swapped if A
+// is held by row).  Any bits past the end of the last word are zero.  This
+// takes 1/8th the memory of the int8_t bitmap.  For an iso matrix, A->x is a
+// single scalar, so a packed iso bitmap is a pattern held in one bit per
+// entry.  A->x is not modified.
+
+// A->magic is set to GB_MAGIC_PACKED.  A user-callable method that uses A as
+// an input works on an unpacked copy (see GB_packed_view), and one that
+// modifies A unpacks it in place (see GB_bitmap_unpack).  Only
+// GB_bitmap_packed_ewise and GB_packed_find operate on packed bitmaps
+// directly.
+
+#include "GB.h"
+
+GrB_Info GB_bitmap_pack         // pack the bitmap A->b into bits
+(
+    GrB_Matrix A,               // bitmap matrix to pack
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A to pack", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the packed bitmap
+    //--------------------------------------------------------------------------
+
+    const int64_t anz = A->vlen * A->vdim ;
+    const int64_t nwords = (anz + 63) / 64 ;
+    size_t Aw_size = 0 ;
+    uint64_t *restrict Aw = GB_MALLOC (GB_IMAX (nwords, 1), uint64_t,
+        &Aw_size) ;
+    if (Aw == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    Aw [0] = 0 ;
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap, 64 entries at a time
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    GB_BURBLE_N (anz, "(pack bitmap) ") ;
+
+    const int8_t *restrict Ab = A->b ;
+    int64_t k, anvals = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:anvals)
+    for (k = 0 ; k < nwords ; k++)
+    {
+        const int64_t pstart = k * 64 ;
+        const int64_t pend = GB_IMIN (pstart + 64, anz) ;
+        uint64_t w = 0 ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        { 
+            w |= ((uint64_t) (Ab [p] != 0)) << (p - pstart) ;
+        }
+        Aw [k] = w ;
+        anvals += GB_POPCOUNT64 (w) ;
+    }
+    ASSERT (anvals == A->nvals) ;
+
+    //--------------------------------------------------------------------------
+    // replace A->b with the packed bitmap
+    //--------------------------------------------------------------------------
+
+    if (!A->b_shallow)
+    { 
+        GB_FREE (&(A->b), A->b_size) ;
+    }
+    A->b = (int8_t *) Aw ; A->b_size = Aw_size ; A->b_shallow = false ;
+    A->nvals = anvals ;
+    A->magic = GB_MAGIC_PACKED ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// GB_bitmap_packed_ewise: C<M> = accum (C, A.*B or A+B) with packed bitmaps
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_eWiseMult and GrB_eWiseAdd call this method before checking their
+// inputs, which would unpack any packed bitmaps (see GB_bitmap_pack).  If all
+// matrices are packed iso bitmaps with the same type and the same value s, the
+// pattern of C is computed 64 entries at a time, directly from the packed
+// bitmaps, with bitwise AND (A.*B), OR (A+B and the accum), and ANDNOT (the
+// mask), and the number of entries in C is found with a popcount.  C is left
+// as a packed iso bitmap, with the value s.  This is the typical case for the
+// frontiers and sets of visited nodes in a multi-source BFS, held as boolean
+// matrices with one column (or row) per source.
+
+// The conditions are:
+//
+//  A and B are packed iso bitmaps, not transposed, with the same type, the
+//      same value s, and the same dimensions and format as C.
+//  op (s,s) == s, and accum (s,s) == s if accum is present, where all the
+//      types of op and accum are the same as the type of A.  Positional
+//      operators are not handled.
+//  The mask M, if present, is a packed bitmap, and is structural (or iso with
+//      a nonzero value).
+//  C has the type of A, and its GxB_BITMAP_PACKED option is true.  If the
+//      prior entries of C are needed (with the accum, or with a mask and no
+//      C_replace), C must also be a packed iso bitmap with the value s.
+//
+// Otherwise, GrB_NO_VALUE is returned and nothing is modified, and the caller
+// checks its inputs and uses GB_ewise as usual.  The inputs are not checked
+// here, except to ensure that they are valid for this method; any error is
+// left for the caller to report.
+
+#include "GB_ewise.h"
+#include "GB_get_mask.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE (&Cw, Cw_size) ;        \
+    GB_FREE (&Cx, Cx_size) ;        \
+}
+
+//------------------------------------------------------------------------------
+// GB_packed_like: true if A is packed, with the dimensions and format of C
+//------------------------------------------------------------------------------
+
+static inline bool GB_packed_like
+(
+    const GrB_Matrix A,
+    const GrB_Matrix C
+)
+{
+    return (A->magic == GB_MAGIC_PACKED && A->b != NULL && A->vlen == C->vlen
+        && A->vdim == C->vdim && A->is_csc == C->is_csc) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_packed_iso: true if A is packed and iso, with the type of C and value s
+//------------------------------------------------------------------------------
+
+static inline bool GB_packed_iso
+(
+    const GrB_Matrix A,
+    const GrB_Matrix C,
+    const GB_void *s            // value of each entry, of size C->type->size
+)
+{
+    return (GB_packed_like (A, C) && A->iso && A->type == C->type
+        && memcmp (A->x, s, C->type->size) == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_packed_op_ok: true if op (s,s) == s and op has the type of A
+//------------------------------------------------------------------------------
+
+static inline bool GB_packed_op_ok
+(
+    const GrB_BinaryOp op,
+    const GrB_Type type,
+    const GB_void *s
+)
+{
+    if (op->magic != GB_MAGIC || GB_OP_IS_POSITIONAL (op)
+        || op->binop_function == NULL || op->xtype != type
+        || op->ytype != type || op->ztype != type)
+    { 
+        return (false) ;
+    }
+    size_t zsize = type->size ;
+    GB_void z [GB_VLA(zsize)] ;
+    op->binop_function (z, s, s) ;
+    return (memcmp (z, s, zsize) == 0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_bitmap_packed_ewise
+//------------------------------------------------------------------------------
+
+GrB_Info GB_bitmap_packed_ewise     // C<M> = accum (C, A.*B or A+B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const bool Mask_comp_in,        // if true, complement the mask M
+    const bool Mask_struct_in,      // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // defines '+' for C=A+B, or .* for A.*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const bool eWiseAdd,            // if true, do set union (like A+B),
+                                    // otherwise do intersection (like A.*B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if this method applies
+    //--------------------------------------------------------------------------
+
+    if (C == NULL || A == NULL || B == NULL || op == NULL
+        || A->magic != GB_MAGIC_PACKED || B->magic != GB_MAGIC_PACKED
+        || !(C->magic == GB_MAGIC || C->magic == GB_MAGIC_PACKED)
+        || A_transpose || B_transpose
+        || !C->bitmap_packed || !(C->sparsity_control & GxB_BITMAP))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    // A and B must be packed iso bitmaps with the same value s
+    const GB_void *s = (GB_void *) A->x ;
+    if (!GB_packed_iso (A, C, s) || !GB_packed_iso (B, C, s))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    // op (s,s) and accum (s,s) must be s
+    if (!GB_packed_op_ok (op, C->type, s)
+        || (accum != NULL && !GB_packed_op_ok (accum, C->type, s)))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    // the mask must be a structural packed bitmap, or not present
+    bool Mask_comp = Mask_comp_in ;
+    bool Mask_struct = Mask_struct_in ;
+    GrB_Matrix M = NULL ;
+    if (M_in != NULL)
+    {
+        if (!GB_packed_like (M_in, C))
+        { 
+            return (GrB_NO_VALUE) ;
+        }
+        M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+        if (M == NULL || !Mask_struct)
+        { 
+            // the mask is empty, or valued
+            return (GrB_NO_VALUE) ;
+        }
+    }
+    else if (Mask_comp)
+    { 
+        // C<!NULL> is handled by the caller
+        return (GrB_NO_VALUE) ;
+    }
+
+    // the prior entries of C are needed with the accum, or with a mask and no
+    // C_replace
+    const bool C_needed = (accum != NULL) || (M != NULL && !C_replace) ;
+    if (C_needed && !GB_packed_iso (C, C, s))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the new C
+    //--------------------------------------------------------------------------
+
+    const size_t csize = C->type->size ;
+    const int64_t cnz = C->vlen * C->vdim ;
+    const int64_t nwords = (cnz + 63) / 64 ;
+    uint64_t *restrict Cw = NULL ; size_t Cw_size = 0 ;
+    GB_void *restrict Cx = NULL ; size_t Cx_size = 0 ;
+    Cw = GB_MALLOC (GB_IMAX (nwords, 1), uint64_t, &Cw_size) ;
+    Cx = GB_MALLOC (csize, GB_void, &Cx_size) ;
+    if (Cw == NULL || Cx == NULL)
+    { 
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    Cw [0] = 0 ;
+    memcpy (Cx, s, csize) ;
+
+    //--------------------------------------------------------------------------
+    // compute the pattern of C, 64 entries at a time
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nwords, chunk, nthreads_max) ;
+    GBURBLE ("(packed bitmap %s) ", eWiseAdd ? "add" : "emult") ;
+
+    const uint64_t *restrict Aw = (uint64_t *) A->b ;
+    const uint64_t *restrict Bw = (uint64_t *) B->b ;
+    const uint64_t *restrict Mw = (M == NULL) ? NULL : (uint64_t *) M->b ;
+    const uint64_t *restrict Cw_old = C_needed ? (uint64_t *) C->b : NULL ;
+    const bool do_accum = (accum != NULL) ;
+    int64_t k, cnvals = 0 ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:cnvals)
+    for (k = 0 ; k < nwords ; k++)
+    {
+        // T = A+B or A.*B
+        uint64_t z = eWiseAdd ? (Aw [k] | Bw [k]) : (Aw [k] & Bw [k]) ;
+        if (do_accum)
+        { 
+            // Z = accum (C,T)
+            z |= Cw_old [k] ;
+        }
+        if (Mw != NULL)
+        {
+            // C<M> = Z, or C<!M> = Z
+            const uint64_t m = Mask_comp ? (~Mw [k]) : Mw [k] ;
+            z &= m ;
+            if (!C_replace)
+            { 
+                // keep the entries of C outside the mask
+                z |= (Cw_old [k] & ~m) ;
+            }
+        }
+        Cw [k] = z ;
+        cnvals += GB_POPCOUNT64 (z) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the content of C with the packed iso bitmap
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with A, B, and/or M, which are no longer needed
+    GB_phy_free (C) ;
+    GB_bix_free (C) ;
+    C->b = (int8_t *) Cw ; C->b_size = Cw_size ; C->b_shallow = false ;
+    C->x = Cx ; C->x_size = Cx_size ; C->x_shallow = false ;
+    C->iso = true ;
+    C->plen = -1 ;
+    C->nvec = C->vdim ;
+    C->nvec_nonempty = (C->vlen == 0) ? 0 : C->vdim ;
+    C->nvals = cnvals ;
+    C->magic = GB_MAGIC_PACKED ;
+    return (GrB_SUCCESS) ;
+}
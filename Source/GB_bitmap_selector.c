@@ -9,6 +9,7 @@
 
 #include "GB_select.h"
 #include "GB_sel__include.h"
+#include "GB_select_jit.h"
 
 #define GB_FREE_ALL ;
 
@@ -85,8 +86,18 @@ GrB_Info GB_bitmap_selector
     }                                                                   \
     break ;
 
-    const GB_Type_code typecode = (A->iso) ? GB_ignore_code : acode ;
-    #include "GB_select_factory.c"
+    // try the JIT first, for a user-defined index unary operator
+    info = GB_select_bitmap_jit (C->b, (GB_void *) C->x, &cnvals, A, flipij,
+        ythunk, op, nthreads) ;
+    if (info != GrB_NO_VALUE)
+    { 
+        GB_BURBLE_MATRIX (A, "(jit bitmap select: %s) ", op->name) ;
+    }
+    else
+    {
+        const GB_Type_code typecode = (A->iso) ? GB_ignore_code : acode ;
+        #include "GB_select_factory.c"
+    }
 
     //--------------------------------------------------------------------------
     // return result
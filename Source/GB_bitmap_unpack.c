@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GB_bitmap_unpack: unpack the bitmap of a matrix from bits
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A->b has been packed into bits by GB_bitmap_pack, it is unpacked here
+// into the conventional int8_t bitmap, and A->magic is set back to GB_MAGIC.
+// If A is NULL or its bitmap is not packed, nothing is done.  If out of
+// memory, A is left unchanged, with its bitmap still packed.  If the packed
+// bitmap is shallow (see GB_packed_view), it is not freed.
+
+// The A->bitmap_packed setting is not changed, so A is packed again by
+// GrB_Matrix_wait, if it is still bitmap.
+
+#include "GB.h"
+
+GrB_Info GB_bitmap_unpack       // unpack the bitmap A->b from bits
+(
+    GrB_Matrix A,               // matrix to unpack, if packed
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->magic != GB_MAGIC_PACKED || A->b == NULL)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the bitmap
+    //--------------------------------------------------------------------------
+
+    const int64_t anz = A->vlen * A->vdim ;
+    const int64_t nwords = (anz + 63) / 64 ;
+    size_t Ab_size = 0 ;
+    int8_t *restrict Ab = GB_MALLOC (GB_IMAX (anz, 1), int8_t, &Ab_size) ;
+    if (Ab == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the bitmap, 64 entries at a time
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    GB_BURBLE_N (anz, "(unpack bitmap) ") ;
+
+    const uint64_t *restrict Aw = (uint64_t *) A->b ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < nwords ; k++)
+    {
+        const int64_t pstart = k * 64 ;
+        const int64_t pend = GB_IMIN (pstart + 64, anz) ;
+        const uint64_t w = Aw [k] ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        { 
+            Ab [p] = (int8_t) ((w >> (p - pstart)) & 1) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the packed bitmap with A->b
+    //--------------------------------------------------------------------------
+
+    if (!A->b_shallow)
+    { 
+        GB_FREE (&(A->b), A->b_size) ;
+    }
+    A->b = Ab ; A->b_size = Ab_size ; A->b_shallow = false ;
+    A->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (A, "A unpacked", GB0) ;
+    return (GrB_SUCCESS) ;
+}
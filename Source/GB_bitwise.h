@@ -330,5 +330,29 @@ inline int64_t GB_bitshift_int64 (int64_t x, int8_t k)
     }
 }
 
+//------------------------------------------------------------------------------
+// popcount
+//------------------------------------------------------------------------------
+
+// GB_POPCOUNT64 (x) returns the number of bits set in the uint64_t value x.
+
+#if GB_COMPILER_GCC || GB_COMPILER_CLANG || GB_COMPILER_ICX || GB_COMPILER_ICC
+
+    #define GB_POPCOUNT64(x) __builtin_popcountll (x)
+
+#else
+
+    static inline int GB_popcount64 (uint64_t x)
+    {
+        x = x - ((x >> 1) & 0x5555555555555555ULL) ;
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL) ;
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL ;
+        return ((int) ((x * 0x0101010101010101ULL) >> 56)) ;
+    }
+
+    #define GB_POPCOUNT64(x) GB_popcount64 (x)
+
+#endif
+
 #endif
 
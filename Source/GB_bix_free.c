@@ -38,6 +38,9 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
     ASSERT (GB_PENDING_OK (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
 
+    // the cached transpose of A is no longer valid
+    GB_transpose_cache_free (A) ;
+
     // free A->b unless it is shallow
     if (!A->b_shallow)
     { 
@@ -119,6 +119,12 @@ GrB_Info GB_build               // build matrix
     // check C
     GrB_Info info ;
     ASSERT (C != NULL) ;
+    info = GB_packed_unpack (C, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
     if (GB_nnz (C) > 0 || GB_PENDING (C))
     { 
         // The matrix has existing entries.  This is required by the GraphBLAS
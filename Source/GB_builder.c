@@ -107,7 +107,8 @@
 #include "GB_sort.h"
 #include "GB_binop.h"
 #ifndef GBCUDA_DEV
-#include "GB_red__include.h"
+#define GB_FMV_HEADER "GB_red__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_I_WORK(t) (((t) < 0) ? -1 : I_work [t])
@@ -1247,7 +1248,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
                     #define GB_INCLUDE_SECOND_OPERATOR
 
                     #define GB_red(opname,aname) \
-                        GB (_red_build_ ## opname ## aname)
+                        GB_FMV (_red_build_ ## opname ## aname)
 
                     #define GB_RED_WORKER(opname,aname,atype)               \
                     {                                                       \
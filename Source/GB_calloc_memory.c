@@ -42,6 +42,7 @@ static inline void *GB_calloc_helper
         #endif
     }
 
+    bool cleared = false ;
     if (p == NULL)
     {
         // no block in the free_pool, so allocate it
@@ -49,13 +50,17 @@ static inline void *GB_calloc_helper
         #ifdef GB_MEMDUMP
         printf ("hard calloc %p %ld\n", p, *size) ;
         #endif
+
+        // place a large block on the NUMA nodes and/or use huge pages; this
+        // may also clear the block
+        cleared = GB_memory_placement (p, size_requested, true) ;
     }
 
     #ifdef GB_MEMDUMP
     GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
     #endif
 
-    if (p != NULL)
+    if (p != NULL && !cleared)
     { 
         // clear the block of memory with a parallel memset
         GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
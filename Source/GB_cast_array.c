@@ -14,7 +14,8 @@
 
 #include "GB.h"
 #ifndef GBCUDA_DEV
-#include "GB_unop__include.h"
+#define GB_FMV_HEADER "GB_unop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 GB_PUBLIC
@@ -59,7 +60,7 @@ void GB_cast_array              // typecast an array
         //----------------------------------------------------------------------
 
         #define GB_unop_apply(zname,xname)                                  \
-            GB (_unop_apply__identity ## zname ## xname)
+            GB_FMV (_unop_apply__identity ## zname ## xname)
 
         #define GB_WORKER(ignore1,zname,ztype,xname,xtype)                  \
         {                                                                   \
@@ -20,6 +20,8 @@
 // the matrix A is left in an invalid state (A->magic == GB_MAGIC2).  Only the
 // header is left.
 
+// If A is packed (see GB_packed_unpack), its content is freed as-is.
+
 // A is first converted to sparse or hypersparse, and then conformed via
 // GB_conform.  If A->sparsity_control disables the sparse and hypersparse
 // structures, A is converted bitmap instead.
@@ -38,7 +40,8 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     //--------------------------------------------------------------------------
 
     ASSERT (A != NULL) ;
-    ASSERT (A->magic == GB_MAGIC || A->magic == GB_MAGIC2) ;
+    ASSERT (A->magic == GB_MAGIC || A->magic == GB_MAGIC2
+        || A->magic == GB_MAGIC_PACKED) ;
 
     // zombies and pending tuples have no effect; about to delete them anyway
     ASSERT (GB_ZOMBIES_OK (A)) ;
@@ -49,6 +52,12 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     // clear the content of A if bitmap
     //--------------------------------------------------------------------------
 
+    if (A->magic == GB_MAGIC_PACKED)
+    { 
+        // a packed matrix is not unpacked just to be cleared
+        GB_phybix_free (A) ;
+    }
+
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
     int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
     if (((sparsity_control & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0)
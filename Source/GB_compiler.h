@@ -277,10 +277,61 @@
 
 #endif
 
+//------------------------------------------------------------------------------
+// thread-local storage
+//------------------------------------------------------------------------------
+
+// GB_THREAD_LOCAL declares a static variable with one copy per thread.  It is
+// used by the per-thread caches of the free_pool (see GB_Global.c), and by the
+// GxB_Context engaged by each user thread (see GB_Context_engaged.c).  Both are
+// disabled if the compiler does not support thread-local storage.
+
+#if GB_COMPILER_MSC
+
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL __declspec(thread)
+
+#elif GB_COMPILER_GCC || GB_COMPILER_CLANG || GB_COMPILER_ICX || GB_COMPILER_ICC
+
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL __thread
+
+#elif (defined (__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)) \
+    && !defined (__STDC_NO_THREADS__)
+
+    // ANSI C11 and later
+    #define GB_HAS_THREAD_LOCAL 1
+    #define GB_THREAD_LOCAL _Thread_local
+
+#else
+
+    #define GB_HAS_THREAD_LOCAL 0
+    #define GB_THREAD_LOCAL
+
+#endif
+
+//------------------------------------------------------------------------------
+// determine the target architecture (see GB_cpu_features.h for GBX86)
+//------------------------------------------------------------------------------
+
+#if !defined ( GBX86 )
+
+    #if ( defined (_M_X64) || defined (__x86_64__)) && \
+        ! ( defined (__CLR_VER) || defined (__pnacl__) )
+    // the target architecture is x86_64, and not a virtual machine
+    #define GBX86 1
+    #else
+    #define GBX86 0
+    #endif
+
+#endif
+
 //------------------------------------------------------------------------------
 // AVX2 and AVX512F support for the x86_64 architecture
 //------------------------------------------------------------------------------
 
+// GBX86 must be determined above, before it is tested here.
+
 // gcc 7.5.0 cannot compile code with __attribute__ ((target ("avx512f"))), or
 // avx2 (it triggers a bug in the compiler), but those targets are fine with
 // gcc 9.3.0 or later.  It might be OK on gcc 8.x but I haven't tested this.
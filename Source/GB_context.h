@@ -21,7 +21,13 @@
 // -Wformat-truncation will print a warning (see pragmas above).  Ignore the
 // warning.
 
-// Threading control is described in GB_nthreads.h.
+// Threading control is described in GB_nthreads.h.  The default number of
+// threads and chunk size are taken from the GxB_Context engaged by the calling
+// user thread, or from the global settings if no GxB_Context is engaged.
+
+// Context->memory_budget limits the memory used by C=A*B (see GB_AxB_meta and
+// GB_AxB_saxpy3).  If a method cannot fit in the budget, it sets
+// Context->memory_peak to its estimate of the peak memory it would need.
 
 // GB_WERK_SIZE is the size of a small fixed-sized array in the Context, used
 // for small werkspace allocations (typically O(# of threads or # tasks)).
@@ -34,9 +40,12 @@ typedef struct
 {
     GB_void Werk [GB_WERK_SIZE] ;   // werkspace stack
     double chunk ;                  // chunk size for small problems
+    double memory_budget ;          // max bytes for C=A*B (<= 0: default)
+    double memory_peak ;            // estimated bytes, if over budget
     const char *where ;             // GraphBLAS function where error occurred
     char **logger_handle ;          // error report
     size_t *logger_size_handle ;
+    GrB_Matrix output ;             // object modified by the method, if any
     int nthreads_max ;              // max # of threads to use
     int pwerk ;                     // top of Werk stack, initially zero
 }
@@ -44,6 +53,23 @@ GB_Context_struct ;
 
 typedef GB_Context_struct *GB_Context ;
 
+//------------------------------------------------------------------------------
+// the GxB_Context engaged by the calling user thread
+//------------------------------------------------------------------------------
+
+GxB_Context GB_Context_engaged (void) ;
+bool GB_Context_engaged_set (GxB_Context Context) ;
+GB_PUBLIC int GB_Context_nthreads_max (void) ;
+GB_PUBLIC double GB_Context_chunk (void) ;
+
+GrB_Info GB_Context_check       // check a GraphBLAS Context
+(
+    const GxB_Context Context,  // GraphBLAS Context to print and check
+    const char *name,           // name of the Context, optional
+    int pr,                     // print level
+    FILE *f                     // file for output
+) ;
+
 // GB_WHERE keeps track of the currently running user-callable function.
 // User-callable functions in this implementation are written so that they do
 // not call other unrelated user-callable functions (except for GrB_*free).
@@ -61,16 +87,33 @@ typedef GB_Context_struct *GB_Context ;
     /* set Context->where so GrB_error can report it if needed */   \
     Context->where = where_string ;                                 \
     /* get the default max # of threads and default chunk size */   \
-    Context->nthreads_max = GB_Global_nthreads_max_get ( ) ;        \
-    Context->chunk = GB_Global_chunk_get ( ) ;                      \
+    Context->nthreads_max = GB_Context_nthreads_max ( ) ;           \
+    Context->chunk = GB_Context_chunk ( ) ;                         \
+    /* get the default memory budget */                             \
+    Context->memory_budget = GB_Global_memory_budget_get ( ) ;      \
+    Context->memory_peak = 0 ;                                      \
     /* get the pointer to where any error will be logged */         \
     Context->logger_handle = NULL ;                                 \
     Context->logger_size_handle = NULL ;                            \
+    /* no object is modified by the method yet */                   \
+    Context->output = NULL ;                                        \
     /* initialize the Werk stack */                                 \
     Context->pwerk = 0 ;
 
+// GB_WHERE and GB_WHERE1 also finish any work deferred by the calling user
+// thread in nonblocking mode (see GB_deferred.c).  GrB_apply with a unary
+// operator uses GB_WHERE_NO_FLUSH instead, since GB_apply may append its own
+// work to the work already deferred.
+
+// The object C passed to GB_WHERE and GB_WHERE_NO_FLUSH is modified by the
+// method, so its cached transpose (if any) is freed (see GB_transpose_cache_*),
+// and it is recorded as Context->output so that the cached transpose of C is
+// not rebuilt while C is being modified.  GB_WHERE_KEEP is used for methods
+// that do not change the entries of C (the GrB_Descriptor setters and
+// GrB_Matrix_wait).
+
 // C is a matrix, vector, scalar, or descriptor
-#define GB_WHERE(C,where_string)                                    \
+#define GB_WHERE_LOG(C,where_string)                                \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
@@ -84,13 +127,63 @@ typedef GB_Context_struct *GB_Context ;
         Context->logger_size_handle = &(C->logger_size) ;           \
     }
 
+// C is a matrix, vector, or scalar, modified by the method
+#define GB_WHERE_NO_FLUSH(C,where_string)                           \
+    GB_WHERE_LOG (C, where_string)                                  \
+    if (C != NULL)                                                  \
+    {                                                               \
+        /* the entries of C are about to change */                  \
+        GB_transpose_cache_free ((GrB_Matrix) C) ;                  \
+        Context->output = (GrB_Matrix) C ;                          \
+    }
+
+#define GB_WHERE(C,where_string)                                    \
+    GB_WHERE_NO_FLUSH (C, where_string)                             \
+    GB_DEFERRED_FLUSH ;
+
+// C is a matrix modified by GrB_Matrix_setElement or GrB_Matrix_removeElement.
+// If C is held in both formats (GxB_DUAL_FORMAT), C->T is kept, since the
+// method updates it as well (see GB_dual_setElement).
+#define GB_WHERE_ELEMENT(C,where_string)                            \
+    GB_WHERE_LOG (C, where_string)                                  \
+    if (C != NULL)                                                  \
+    {                                                               \
+        if (!C->dual_format)                                        \
+        {                                                           \
+            /* the entries of C are about to change */              \
+            GB_transpose_cache_free (C) ;                           \
+        }                                                           \
+        Context->output = C ;                                       \
+    }                                                               \
+    GB_DEFERRED_FLUSH ;
+
+// C is a matrix, vector, scalar, or descriptor, whose entries do not change
+#define GB_WHERE_KEEP(C,where_string)                               \
+    GB_WHERE_LOG (C, where_string)                                  \
+    GB_DEFERRED_FLUSH ;
+
 // create the Context, with no error logging
 #define GB_WHERE1(where_string)                                     \
     if (!GB_Global_GrB_init_called_get ( ))                         \
     {                                                               \
         return (GrB_PANIC) ; /* GrB_init not called */              \
     }                                                               \
-    GB_CONTEXT (where_string)
+    GB_CONTEXT (where_string)                                       \
+    GB_DEFERRED_FLUSH ;
+
+//------------------------------------------------------------------------------
+// GB_GET_MEMORY_BUDGET: get the memory budget for the current method
+//------------------------------------------------------------------------------
+
+// The memory budget is taken from the descriptor, or from the global setting
+// if the descriptor does not set it.  A budget <= 0 means there is no limit.
+
+#define GB_GET_MEMORY_BUDGET(memory_budget,Context)                         \
+    double memory_budget = (Context == NULL) ? 0 : Context->memory_budget ; \
+    if (Context != NULL && memory_budget <= GxB_DEFAULT)                    \
+    {                                                                       \
+        memory_budget = GB_Global_memory_budget_get ( ) ;                   \
+    }
 
 //------------------------------------------------------------------------------
 // error logging
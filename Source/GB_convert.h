@@ -150,6 +150,72 @@ GrB_Info GB_convert_any_to_bitmap   // convert to bitmap
     GB_Context Context
 ) ;
 
+GrB_Info GB_bitmap_pack         // pack the bitmap A->b into bits
+(
+    GrB_Matrix A,               // bitmap matrix to pack
+    GB_Context Context
+) ;
+
+GrB_Info GB_bitmap_unpack       // unpack the bitmap A->b from bits
+(
+    GrB_Matrix A,               // matrix to unpack, if packed
+    GB_Context Context
+) ;
+
+GrB_Info GB_index32_pack        // narrow A->p, A->h, and A->i to int32_t
+(
+    GrB_Matrix A,               // sparse or hypersparse matrix to pack
+    GB_Context Context
+) ;
+
+GrB_Info GB_index32_unpack      // widen A->p, A->h, and A->i to int64_t
+(
+    GrB_Matrix A,               // matrix to unpack, if held in 32 bits
+    GB_Context Context
+) ;
+
+GrB_Info GB_packed_unpack       // unpack a packed matrix, of any kind
+(
+    GrB_Matrix A,               // matrix to unpack, if packed
+    GB_Context Context
+) ;
+
+GrB_Info GB_packed_view         // unpacked copy of a packed matrix
+(
+    GrB_Matrix *Vhandle,        // V: A itself, or an unpacked copy of A
+    const GrB_Matrix A,         // input matrix, not modified
+    GB_Context Context
+) ;
+
+bool GB_packed_find         // find A(i,j) in a packed matrix
+(
+    int64_t *pA,            // position of A(i,j) in A->x, if found
+    const GrB_Matrix A,     // packed matrix to search; not modified
+    const int64_t i,        // index of A(i,j) in its vector
+    const int64_t j         // vector of A(i,j)
+) ;
+
+// GB_PACKED_VIEW (V,A) declares V as A itself, or as an unpacked copy of A if
+// A is packed (see GB_packed_view).  It does nothing if info is already an
+// error.  GB_PACKED_VIEW_FREE (V,A) frees V if it is a copy.
+#define GB_PACKED_VIEW(V,A)                                             \
+    GrB_Matrix V = (GrB_Matrix) (A) ;                                   \
+    if (info == GrB_SUCCESS)                                            \
+    {                                                                   \
+        info = GB_packed_view (&V, (GrB_Matrix) (A), Context) ;         \
+    }
+
+#define GB_PACKED_VIEW_FREE(V,A)                                        \
+    if (V != (GrB_Matrix) (A))                                          \
+    {                                                                   \
+        GB_Matrix_free (&V) ;                                           \
+    }
+
+// true if A->p, A->h, and A->i of A can be held as int32_t
+#define GB_INDEX32_OK(A)                                                \
+    ((A)->vlen <= INT32_MAX && (A)->vdim <= INT32_MAX                   \
+    && GB_nnz (A) <= INT32_MAX)
+
 GB_PUBLIC
 void GB_convert_any_to_full     // convert any matrix to full
 (
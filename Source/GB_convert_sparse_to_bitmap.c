@@ -9,7 +9,8 @@
 
 #include "GB_ek_slice.h"
 #ifndef GBCUDA_DEV
-#include "GB_type__include.h"
+#define GB_FMV_HEADER "GB_type__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE                   \
@@ -34,27 +34,11 @@
 #define GB_CPU_FEATURES_H
 
 //------------------------------------------------------------------------------
-// GB_compiler.h: determine the compiler and architecture
+// GB_compiler.h: determine the compiler and architecture (including GBX86)
 //------------------------------------------------------------------------------
 
 #include "GB_compiler.h"
 
-//------------------------------------------------------------------------------
-// determine the target architecture
-//------------------------------------------------------------------------------
-
-#if !defined ( GBX86 )
-
-    #if ( defined (_M_X64) || defined (__x86_64__)) && \
-        ! ( defined (__CLR_VER) || defined (__pnacl__) )
-    // the target architecture is x86_64, and not a virtual machine
-    #define GBX86 1
-    #else
-    #define GBX86 0
-    #endif
-
-#endif
-
 //------------------------------------------------------------------------------
 // rely on Google's cpu_features package for run-time tests
 //------------------------------------------------------------------------------
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// GB_deferred: operations deferred in nonblocking mode
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// In GrB_NONBLOCKING mode, each user thread holds a short list of unary
+// operators to be applied, in order, to the values of a single matrix C, in a
+// thread-local variable.  The list is built by GrB_apply: C=op(C), with no
+// mask, no accum, and no transpose, where op is a user-defined unary operator
+// that does not typecast its input or output.  Consecutive calls of this kind
+// on the same matrix append their operators to the list.  Any other call to
+// GraphBLAS by the same thread first finishes the work on C (GB_WHERE calls
+// GB_deferred_flush), which applies all the operators in a single pass over
+// the values of C.  The chain C=op1(C), C=op2(C), C=op3(C) thus reads and
+// writes the values of C once, rather than three times, and allocates no
+// temporary matrices.
+
+// Only user-defined operators are deferred.  GB_apply_op has no factory
+// kernel for them, and applies them one entry at a time through the function
+// pointer of the operator, just as GB_deferred_flush does.  Built-in operators
+// are not deferred, since their factory kernels (Generated2/GB_unop__*) are
+// much faster than calling the operators through a function pointer, and
+// applying them right away costs a single pass over C anyway.
+
+// GB_deferred_count is the number of user threads that have deferred work,
+// so that GB_DEFERRED_FLUSH (used by GB_WHERE) only calls GB_deferred_flush
+// when some thread has deferred work.  An application that does not apply a
+// user-defined operator in place never calls it.
+
+// As required by the GraphBLAS C API for nonblocking mode, a matrix modified
+// by one user thread must be completed by that thread (with GrB_wait or any
+// other GraphBLAS call) before it is used by another user thread.
+
+// If the compiler does not support thread-local storage, no operations are
+// deferred.
+
+#include "GB.h"
+#include "GB_atomics.h"
+
+int64_t GB_deferred_count = 0 ;
+
+// max # of operators in a chain
+#define GB_DEFERRED_MAX 16
+
+#if GB_HAS_THREAD_LOCAL
+typedef struct
+{
+    GrB_Matrix C ;                          // matrix to modify, or NULL
+    int nops ;                              // # of operators to apply
+    GrB_UnaryOp ops [GB_DEFERRED_MAX] ;     // the operators, in order
+}
+GB_deferred_struct ;
+
+static GB_THREAD_LOCAL GB_deferred_struct GB_deferred_thread ;
+#endif
+
+//------------------------------------------------------------------------------
+// GB_deferred_apply: defer C=op(A), if possible
+//------------------------------------------------------------------------------
+
+// Returns true if the operation has been deferred.  Otherwise, any prior work
+// deferred by this thread has been finished, and the caller must do the work
+// now.
+
+bool GB_deferred_apply          // defer C=op(A), if possible
+(
+    GrB_Matrix C,               // input/output matrix
+    const GrB_Matrix M,         // optional mask for C
+    const bool Mask_comp,       // M descriptor
+    const GrB_BinaryOp accum,   // optional accum for Z=accum(C,T)
+    const GB_Operator op,       // operator to apply
+    const GrB_Matrix A,         // input matrix
+    const bool A_transpose      // A matrix descriptor
+)
+{
+
+    #if GB_HAS_THREAD_LOCAL
+
+    //--------------------------------------------------------------------------
+    // check if C=op(C) can be done in place on the values of C
+    //--------------------------------------------------------------------------
+
+    GB_Opcode opcode = op->opcode ;
+    bool ok = (GB_Global_mode_get ( ) == GrB_NONBLOCKING)
+        && (C == A) && (M == NULL) && !Mask_comp && (accum == NULL)
+        && !A_transpose
+        && (opcode == GB_USER_unop_code)
+        && (op->xtype == C->type) && (op->ztype == C->type)
+        && (op->unop_function != NULL)
+        && !GB_ANY_PENDING_WORK (C) && !(C->iso)
+        && (C->x != NULL) && !(C->x_shallow) && GB_nnz (C) > 0 ;
+
+    GB_deferred_struct *D = &GB_deferred_thread ;
+    if (!ok || (D->C != NULL && D->C != C) || D->nops == GB_DEFERRED_MAX)
+    { 
+        // finish any prior work; the caller must do this operation now
+        GB_deferred_flush ( ) ;
+        if (!ok) return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // append the operator to the list for C
+    //--------------------------------------------------------------------------
+
+    if (D->C == NULL)
+    { 
+        // this thread now has deferred work
+        GB_ATOMIC_UPDATE
+        GB_deferred_count++ ;
+    }
+    D->C = C ;
+    D->ops [D->nops++] = (GrB_UnaryOp) op ;
+    return (true) ;
+
+    #else
+
+    // thread-local storage is not available
+    return (false) ;
+
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_deferred_flush: do the work deferred by this thread
+//------------------------------------------------------------------------------
+
+void GB_deferred_flush (void)
+{
+
+    #if GB_HAS_THREAD_LOCAL
+
+    //--------------------------------------------------------------------------
+    // get the deferred work, and clear it
+    //--------------------------------------------------------------------------
+
+    GB_deferred_struct *D = &GB_deferred_thread ;
+    GrB_Matrix C = D->C ;
+    if (C == NULL) return ;
+    int nops = D->nops ;
+    GrB_UnaryOp ops [GB_DEFERRED_MAX] ;
+    memcpy (ops, D->ops, nops * sizeof (GrB_UnaryOp)) ;
+    D->C = NULL ;
+    D->nops = 0 ;
+    GB_ATOMIC_UPDATE
+    GB_deferred_count-- ;
+
+    //--------------------------------------------------------------------------
+    // Cx = ops [nops-1] (... ops [1] (ops [0] (Cx)))
+    //--------------------------------------------------------------------------
+
+    ASSERT (C->magic == GB_MAGIC) ;
+    ASSERT (!GB_ANY_PENDING_WORK (C) && !C->iso && !C->x_shallow) ;
+    const size_t csize = C->type->size ;
+    const int8_t *restrict Cb = C->b ;
+    GB_void *restrict Cx = (GB_void *) C->x ;
+    const int64_t cnz = GB_nnz_held (C) ;
+    int nthreads = GB_nthreads (cnz, GB_Context_chunk ( ),
+        GB_Context_nthreads_max ( )) ;
+
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < cnz ; p++)
+    {
+        if (!GBB (Cb, p)) continue ;
+        GB_void *cx = Cx + p * csize ;
+        GB_void z [GB_VLA(csize)] ;
+        for (int k = 0 ; k < nops ; k++)
+        { 
+            ops [k]->unop_function (z, cx) ;
+            memcpy (cx, z, csize) ;
+        }
+    }
+
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_deferred_drop: discard the work deferred on a matrix
+//------------------------------------------------------------------------------
+
+// When C is freed, its deferred work is no longer needed.
+
+void GB_deferred_drop           // discard the work deferred on a matrix
+(
+    GrB_Matrix C                // matrix being freed
+)
+{ 
+
+    #if GB_HAS_THREAD_LOCAL
+    GB_deferred_struct *D = &GB_deferred_thread ;
+    if (C != NULL && D->C == C)
+    { 
+        D->C = NULL ;
+        D->nops = 0 ;
+        GB_ATOMIC_UPDATE
+        GB_deferred_count-- ;
+    }
+    #endif
+}
+
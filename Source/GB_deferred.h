@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// GB_deferred.h: operations deferred in nonblocking mode
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_DEFERRED_H
+#define GB_DEFERRED_H
+
+// In GrB_NONBLOCKING mode, GrB_apply of a user-defined unary operator to a
+// matrix or vector in place, C=op(C), is not done right away, but recorded by
+// the calling user thread.  A chain of such operations on the same matrix is
+// fused into a single pass over the values of C, C=op3(op2(op1(C))) for
+// example, which is done when the thread next calls GraphBLAS for any other
+// purpose (GB_deferred_flush is called by GB_WHERE and GB_WHERE1).  See
+// GB_deferred.c.
+
+bool GB_deferred_apply          // defer C=op(A), if possible
+(
+    GrB_Matrix C,               // input/output matrix
+    const GrB_Matrix M,         // optional mask for C
+    const bool Mask_comp,       // M descriptor
+    const GrB_BinaryOp accum,   // optional accum for Z=accum(C,T)
+    const GB_Operator op,       // operator to apply
+    const GrB_Matrix A,         // input matrix
+    const bool A_transpose      // A matrix descriptor
+) ;
+
+void GB_deferred_flush (void) ; // do the work deferred by this thread
+
+// GB_deferred_count is the number of user threads with deferred work.  A
+// thread always sees its own updates of the count, so a stale value (from
+// another thread deferring or flushing its own work) can only cause an
+// unneeded call to GB_deferred_flush, which then does nothing.
+extern int64_t GB_deferred_count ;
+
+#define GB_DEFERRED_FLUSH                                                   \
+{                                                                           \
+    if (GB_deferred_count > 0) GB_deferred_flush ( ) ;                      \
+}
+
+void GB_deferred_drop           // discard the work deferred on a matrix
+(
+    GrB_Matrix C                // matrix being freed
+) ;
+
+#endif
+
@@ -13,7 +13,8 @@
 #include "GB_binop.h"
 #include "GB_stringify.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 void GB_dense_ewise3_accum          // C += A+B, all matrices dense
@@ -90,7 +91,7 @@ void GB_dense_ewise3_accum          // C += A+B, all matrices dense
     //--------------------------------------------------------------------------
 
     #define GB_Cdense_ewise3_accum(op,xname) \
-        GB (_Cdense_ewise3_accum_ ## op ## xname)
+        GB_FMV (_Cdense_ewise3_accum_ ## op ## xname)
 
     #define GB_BINOP_WORKER(op,xname)                                       \
     {                                                                       \
@@ -14,7 +14,8 @@
 #include "GB_binop.h"
 #include "GB_stringify.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL ;
@@ -110,7 +111,7 @@ GrB_Info GB_dense_ewise3_noaccum    // C = A+B
     //--------------------------------------------------------------------------
 
     #define GB_Cdense_ewise3_noaccum(op,xname) \
-        GB (_Cdense_ewise3_noaccum_ ## op ## xname)
+        GB_FMV (_Cdense_ewise3_noaccum_ ## op ## xname)
 
     #define GB_BINOP_WORKER(op,xname)                                       \
     {                                                                       \
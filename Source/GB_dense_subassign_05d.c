@@ -23,7 +23,8 @@
 #include "GB_dense.h"
 #include "GB_unused.h"
 #ifndef GBCUDA_DEV
-#include "GB_type__include.h"
+#define GB_FMV_HEADER "GB_type__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #undef  GB_FREE_WORKSPACE
@@ -114,7 +115,7 @@ GrB_Info GB_dense_subassign_05d
         // define the worker for the switch factory
         //----------------------------------------------------------------------
 
-        #define GB_Cdense_05d(cname) GB (_Cdense_05d_ ## cname)
+        #define GB_Cdense_05d(cname) GB_FMV (_Cdense_05d_ ## cname)
 
         #define GB_WORKER(cname)                                              \
         {                                                                     \
@@ -29,7 +29,8 @@
 #include "GB_subassign_methods.h"
 #include "GB_dense.h"
 #ifndef GBCUDA_DEV
-#include "GB_type__include.h"
+#define GB_FMV_HEADER "GB_type__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #undef  GB_FREE_ALL
@@ -137,7 +138,7 @@ GrB_Info GB_dense_subassign_06d
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_Cdense_06d(cname) GB (_Cdense_06d_ ## cname)
+            #define GB_Cdense_06d(cname) GB_FMV (_Cdense_06d_ ## cname)
 
             #define GB_WORKER(cname)                                          \
             {                                                                 \
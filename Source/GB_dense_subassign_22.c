@@ -15,7 +15,8 @@
 #include "GB_binop.h"
 #include "GB_unused.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL ;
@@ -96,7 +97,7 @@ GrB_Info GB_dense_subassign_22      // C += b where C is dense and b is a scalar
         //----------------------------------------------------------------------
 
         #define GB_Cdense_accumb(accum,xname) \
-            GB (_Cdense_accumb_ ## accum ## xname)
+            GB_FMV (_Cdense_accumb_ ## accum ## xname)
 
         #define GB_BINOP_WORKER(accum,xname)                                \
         {                                                                   \
@@ -23,7 +23,8 @@
 #include "GB_dense.h"
 #include "GB_binop.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 #include "GB_unused.h"
 
@@ -128,7 +129,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         //----------------------------------------------------------------------
 
         #define GB_Cdense_accumB(accum,xname) \
-            GB (_Cdense_accumB_ ## accum ## xname)
+            GB_FMV (_Cdense_accumB_ ## accum ## xname)
 
         #define GB_BINOP_WORKER(accum,xname)                    \
         {                                                       \
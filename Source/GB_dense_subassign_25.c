@@ -28,7 +28,8 @@
 #include "GB_subassign_methods.h"
 #include "GB_dense.h"
 #ifndef GBCUDA_DEV
-#include "GB_type__include.h"
+#define GB_FMV_HEADER "GB_type__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #undef  GB_FREE_ALL
@@ -145,7 +146,7 @@ GrB_Info GB_dense_subassign_25
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_Cdense_25(cname) GB (_Cdense_25_ ## cname)
+            #define GB_Cdense_25(cname) GB_FMV (_Cdense_25_ ## cname)
 
             #define GB_WORKER(cname)                                          \
             {                                                                 \
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_dual_setElement: set or remove an entry in both formats of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C(row,col) = scalar, or C(row,col) is removed, for GrB_Matrix_setElement,
+// GrB_Matrix_setElement_Scalar, and GrB_Matrix_removeElement.  Not
+// user-callable.
+
+// If C is held in both formats (GxB_DUAL_FORMAT) and its second format C->T
+// exists, then C->T(col,row) is modified in the same way, with GB_setElement
+// or GB_Matrix_removeElement.  C->T can then have zombies and pending tuples,
+// just like C, and GB_wait finishes the work in both.  If C->T cannot be
+// updated (out of memory), it is freed, and constructed again when next
+// needed.  Otherwise, C->T is NULL since it has been freed by GB_WHERE, and
+// only C is modified.
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_dual_setElement     // C(row,col) = scalar, or remove C(row,col)
+(
+    GrB_Matrix C,                   // matrix to modify
+    const bool remove,              // if true, remove C(row,col)
+    const void *scalar,             // scalar to set, if remove is false
+    const GrB_Index row,            // row index
+    const GrB_Index col,            // column index
+    const GB_Type_code scalar_code, // type of the scalar
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // modify C
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+    if (remove)
+    {
+        GB_OK (GB_Matrix_removeElement (C, row, col, Context)) ;
+    }
+    else
+    {
+        GB_OK (GB_setElement (C, NULL, scalar, row, col, scalar_code,
+            Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // modify the second format of C, if present
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix T = C->T ;
+    if (T != NULL)
+    {
+        ASSERT (C->dual_format) ;
+        ASSERT (T->T == NULL) ;
+        ASSERT (GB_NROWS (T) == GB_NCOLS (C)) ;
+        ASSERT (GB_NCOLS (T) == GB_NROWS (C)) ;
+        if (remove)
+        {
+            info = GB_Matrix_removeElement (T, col, row, Context) ;
+        }
+        else
+        {
+            info = GB_setElement (T, NULL, scalar, col, row, scalar_code,
+                Context) ;
+        }
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory; C->T is constructed again when next needed
+            GB_transpose_cache_free (C) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -29,12 +29,12 @@
 
 #include "GB.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_PACKED_VIEW_FREE (A, A_in) ;
 
 GrB_Info GB_dup             // make an exact copy of a matrix
 (
     GrB_Matrix *Chandle,    // handle of output matrix to create
-    const GrB_Matrix A,     // input matrix to copy
+    const GrB_Matrix A_in,  // input matrix to copy
     GB_Context Context
 )
 { 
@@ -43,10 +43,15 @@ GrB_Info GB_dup             // make an exact copy of a matrix
     // check inputs
     //--------------------------------------------------------------------------
 
+    GrB_Info info ;
     ASSERT (Chandle != NULL) ;
-    ASSERT_MATRIX_OK (A, "A to duplicate", GB0) ;
     (*Chandle) = NULL ;
 
+    // get an unpacked copy of A, if it is packed
+    GrB_Matrix A = A_in ;
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
+    ASSERT_MATRIX_OK (A, "A to duplicate", GB0) ;
+
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
@@ -59,6 +64,8 @@ GrB_Info GB_dup             // make an exact copy of a matrix
 
     // set C->iso = A->iso      OK
     GB_BURBLE_MATRIX (A, "(iso dup) ") ;
-    return (GB_dup_worker (Chandle, A->iso, A, true, NULL, Context)) ;
+    info = GB_dup_worker (Chandle, A->iso, A, true, NULL, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
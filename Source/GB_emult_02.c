@@ -72,8 +72,10 @@
 #include "GB_binop.h"
 #include "GB_unused.h"
 #include "GB_stringify.h"
+#include "GB_ewise_jit.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE                   \
@@ -471,7 +473,8 @@ GrB_Info GB_emult_02        // C=A.*B when A is sparse/hyper, B bitmap/full
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_AemultB_02(mult,xname) GB (_AemultB_02_ ## mult ## xname)
+            #define GB_AemultB_02(mult,xname) \
+                GB_FMV (_AemultB_02_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                         \
             {                                                           \
@@ -500,6 +503,21 @@ GrB_Info GB_emult_02        // C=A.*B when A is sparse/hyper, B bitmap/full
             }
 
         #endif
+
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_emult_02_jit (C, M, Mask_struct, Mask_comp, op, A, B,
+                flipxy, Cp_kfirst, A_ek_slicing, A_ntasks, A_nthreads) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit emult_02: %s) ", op->name) ;
+            }
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// GB_emult_02_jit: C<#M>=A.*B, A sparse/hyper, B bitmap/full, via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_ewise_jit.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_emult_02_jit    // C<#M>=A.*B, A sparse/hyper, B bitmap/full
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_ewise_jit_enumify (&scode, C, GB_sparsity (A), M, Mask_struct,
+        Mask_comp, op, flipxy, false, A, B))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_ewise_family,
+        "emult_02", scode, NULL, NULL, (GB_Operator) op, C->type,
+        A->type, B->type) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (C, M, Mask_struct, Mask_comp, A, B, Cp_kfirst,
+        A_ek_slicing, A_ntasks, A_nthreads)) ;
+}
@@ -27,8 +27,10 @@
 #include "GB_binop.h"
 #include "GB_unused.h"
 #include "GB_stringify.h"
+#include "GB_ewise_jit.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_WORKSPACE                   \
@@ -305,7 +307,8 @@ GrB_Info GB_emult_04        // C<M>=A.*B, M sparse/hyper, A and B bitmap/full
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_AemultB_04(mult,xname) GB (_AemultB_04_ ## mult ## xname)
+            #define GB_AemultB_04(mult,xname) \
+                GB_FMV (_AemultB_04_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                             \
             {                                                               \
@@ -330,6 +333,21 @@ GrB_Info GB_emult_04        // C<M>=A.*B, M sparse/hyper, A and B bitmap/full
 
         #endif
 
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_emult_04_jit (C, M, Mask_struct, op, A, B, Cp_kfirst,
+                M_ek_slicing, M_ntasks, M_nthreads) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit emult_04: %s) ", op->name) ;
+            }
+        }
+
         //----------------------------------------------------------------------
         // generic worker
         //----------------------------------------------------------------------
@@ -28,8 +28,10 @@
 #include "GB_binop.h"
 #include "GB_unused.h"
 #include "GB_stringify.h"
+#include "GB_ewise_jit.h"
 #ifndef GBCUDA_DEV
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL             \
@@ -222,7 +224,7 @@ GrB_Info GB_emult_phase2             // C=A.*B or C<M>=A.*B
             // define the worker for the switch factory
             //------------------------------------------------------------------
 
-            #define GB_AemultB(mult,xname) GB (_AemultB_ ## mult ## xname)
+            #define GB_AemultB(mult,xname) GB_FMV (_AemultB_ ## mult ## xname)
 
             #define GB_BINOP_WORKER(mult,xname)                             \
             {                                                               \
@@ -248,6 +250,22 @@ GrB_Info GB_emult_phase2             // C=A.*B or C<M>=A.*B
             }
 
         #endif
+
+        //----------------------------------------------------------------------
+        // via the CPU JIT
+        //----------------------------------------------------------------------
+
+        if (!done)
+        { 
+            info = GB_emult_jit (C, C_sparsity, ewise_method, M, Mask_struct,
+                Mask_comp, op, A, B, C_to_M, C_to_A, C_to_B, TaskList,
+                C_ntasks, C_nthreads, Context) ;
+            done = (info != GrB_NO_VALUE) ;
+            if (done)
+            { 
+                GB_BURBLE_MATRIX (C, "(jit emult: %s) ", op->name) ;
+            }
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// User-defined types are not handled.
+// User-defined types and operators are enumified only by their type and
+// opcode; their definitions are not part of the rcode.
 
 #include "GB.h"
 #include "GB_stringify.h"
@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GB_enumify_select: enumerate a GrB_select problem
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Only user-defined GrB_IndexUnaryOps are enumified.  The operator itself is
+// described by its definition, which is not part of the scode.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+void GB_enumify_select      // enumerate a GrB_select problem
+(
+    // output:
+    uint64_t *scode,        // unique encoding of the entire problem
+    // input:
+    GB_Operator op,         // user-defined index unary operator
+    bool flipij,            // if true, the op is f(x,j,i,y)
+    GrB_Matrix A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the types of the operator and A
+    //--------------------------------------------------------------------------
+
+    int zcode = op->ztype->code ;   // 0 to 14
+    int xcode = op->xtype->code ;   // 0 to 14
+    int ycode = op->ytype->code ;   // 0 to 14
+    int acode = A->type->code ;     // 0 to 14
+
+    //--------------------------------------------------------------------------
+    // enumify the sparsity structure of A
+    //--------------------------------------------------------------------------
+
+    int A_sparsity = GB_sparsity (A) ;
+    int asparsity ;
+    GB_enumify_sparsity (&asparsity, A_sparsity) ;
+
+    //--------------------------------------------------------------------------
+    // construct the select scode
+    //--------------------------------------------------------------------------
+
+    // total scode bits: 19
+
+    (*scode) =
+                                               // range        bits
+                // operator
+                GB_LSHIFT (flipij     , 18) |  // 0 to 1       1
+                GB_LSHIFT (zcode      , 14) |  // 0 to 14      4
+                GB_LSHIFT (xcode      , 10) |  // 0 to 14      4
+                GB_LSHIFT (ycode      ,  6) |  // 0 to 14      4
+
+                // type of A
+                GB_LSHIFT (acode      ,  2) |  // 0 to 14      4
+
+                // sparsity structure of A
+                GB_LSHIFT (asparsity  ,  0) ;  // 0 to 3       2
+}
@@ -32,6 +32,24 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     GB_Context Context
 ) ;
 
+GrB_Info GB_bitmap_packed_ewise     // C<M> = accum (C, A.*B or A+B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const bool Mask_comp_in,        // if true, complement the mask M
+    const bool Mask_struct_in,      // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_BinaryOp op,          // defines '+' for C=A+B, or .* for A.*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const bool eWiseAdd,            // if true, do set union (like A+B),
+                                    // otherwise do intersection (like A.*B)
+    GB_Context Context
+) ;
+
 void GB_ewise_generic       // generic ewise
 (
     // input/output:
@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+// GB_ewise_jit.h: definitions for the CPU JIT kernels for eWiseAdd/Mult/Union
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// These methods are used when no pre-compiled kernel in Generated2/ applies.
+// Each returns GrB_NO_VALUE if the JIT cannot handle the problem (the JIT is
+// disabled, typecasting is required, a user-defined type or operator has no
+// definition, or the kernel fails to compile), in which case the caller uses
+// GB_ewise_generic or its own generic method.
+
+#ifndef GB_EWISE_JIT_H
+#define GB_EWISE_JIT_H
+#include "GB_ewise.h"
+#include "GB_jitifyer.h"
+
+bool GB_ewise_jit_enumify   // enumify an ewise problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const bool flipxy,
+    const bool is_eWiseAdd, // if true, entries of A and B are copied into C
+    const GrB_Matrix A,
+    const GrB_Matrix B
+) ;
+
+GrB_Info GB_add_jit         // C=A+B, C<#M>=A+B, eWiseAdd or eWiseUnion
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar,    // of type op->xtype
+    const GB_void *beta_scalar,     // of type op->ytype
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_emult_jit       // C<#M>=A.*B, C sparse/hyper
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_emult_02_jit    // C<#M>=A.*B, A sparse/hyper, B bitmap/full
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool flipxy,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_emult_04_jit    // C<M>=A.*B, M sparse/hyper, A and B bitmap/full
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+
+GrB_Info GB_emult_bitmap_jit    // C<#M>=A.*B, C bitmap
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+#endif
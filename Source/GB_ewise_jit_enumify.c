@@ -0,0 +1,95 @@
+//------------------------------------------------------------------------------
+// GB_ewise_jit_enumify: enumify an eWiseAdd/Mult/Union problem for the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if the JIT can handle the ewise problem, and the scode of the
+// problem.  The parts of the scode that the JIT kernels handle at run time
+// (the sparsity structures of C, M, A, and B, the mask, and the iso properties
+// of A and B) are cleared, so that one kernel handles all of these cases.
+
+#include "GB_ewise_jit.h"
+
+bool GB_ewise_jit_enumify   // enumify an ewise problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_BinaryOp op,
+    const bool flipxy,
+    const bool is_eWiseAdd, // if true, entries of A and B are copied into C
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the JIT can handle this operator
+    //--------------------------------------------------------------------------
+
+    if (!GB_jitifyer_control_get ( ) || C->iso || op == NULL)
+    { 
+        return (false) ;
+    }
+
+    GB_Opcode opcode = op->opcode ;
+    if (GB_OPCODE_IS_POSITIONAL (opcode) || C->type != op->ztype
+        || !GB_JIT_OP_OK (op) || !GB_JIT_TYPE_OK (op->xtype)
+        || !GB_JIT_TYPE_OK (op->ytype) || !GB_JIT_TYPE_OK (op->ztype)
+        || !GB_JIT_TYPE_OK (A->type) || !GB_JIT_TYPE_OK (B->type))
+    { 
+        return (false) ;
+    }
+
+    // FIRST, SECOND, and PAIR are unflipped by the caller
+    if (flipxy && (opcode == GB_FIRST_binop_code ||
+        opcode == GB_SECOND_binop_code || opcode == GB_PAIR_binop_code))
+    { 
+        return (false) ;
+    }
+
+    // entries in A but not B (or B but not A) are copied into C by eWiseAdd
+    if (is_eWiseAdd && (A->type != C->type || B->type != C->type))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the problem
+    //--------------------------------------------------------------------------
+
+    GB_enumify_ewise (scode, false, C_sparsity, C->type, M, Mask_struct,
+        Mask_comp, op, flipxy, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // A and B must not be typecasted, unless their values are not accessed
+    //--------------------------------------------------------------------------
+
+    bool A_is_pattern = (GB_RSHIFT ((*scode), 12, 4) == 0) ;
+    bool B_is_pattern = (GB_RSHIFT ((*scode),  8, 4) == 0) ;
+    GrB_Type a2type = flipxy ? op->ytype : op->xtype ;
+    GrB_Type b2type = flipxy ? op->xtype : op->ytype ;
+    if ((!A_is_pattern && A->type != a2type) ||
+        (!B_is_pattern && B->type != b2type))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // clear the parts of the scode handled at run time
+    //--------------------------------------------------------------------------
+
+    (*scode) &= ~(GB_LSHIFT (0x3, 45)       // A_iso and B_iso
+                | GB_LSHIFT (0xF, 20)       // mask
+                | GB_LSHIFT (0xFF, 0)) ;    // sparsity of C, M, A, and B
+    return (true) ;
+}
@@ -16,23 +16,32 @@
 //
 //      C<M> = accum (C, A(Rows,Cols) )
 //      C<M> = accum (C, A(Cols,Rows)')
-
-#define GB_FREE_ALL GrB_Matrix_free (&T) ;
+//
+// If AT = A' is needed and the transpose of A has been cached (see
+// GB_transpose_cache_get), then AT(Rows,Cols) is extracted from A->T.
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GrB_Matrix_free (&T) ;                  \
+    GB_PACKED_VIEW_FREE (M, M_in) ;         \
+    GB_PACKED_VIEW_FREE (A_view, A_in) ;    \
+}
 
 #include "GB_extract.h"
 #include "GB_subref.h"
 #include "GB_accum_mask.h"
+#include "GB_transpose.h"
 
 GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // C matrix descriptor
-    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
     const bool Mask_comp,           // mask descriptor
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
-    const GrB_Matrix A,             // input matrix
-    const bool A_transpose,         // A matrix descriptor
+    const GrB_Matrix A_in,          // input matrix
+    const bool A_transpose_in,      // A matrix descriptor
     const GrB_Index *Rows,          // row indices
     const GrB_Index nRows_in,       // number of row indices
     const GrB_Index *Cols,          // column indices
@@ -50,14 +59,18 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     GrB_Info info ;
     struct GB_Matrix_opaque T_header ;
     GrB_Matrix T = NULL ;
+    GrB_Matrix M = M_in ;
+    GrB_Matrix A_view = A_in ;
+    GrB_Matrix A = A_in ;
+    bool A_transpose = A_transpose_in ;
     GB_RETURN_IF_NULL (Rows) ;
     GB_RETURN_IF_NULL (Cols) ;
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
 
+    // C is about to be modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack (C, Context)) ;
     ASSERT_MATRIX_OK (C, "C input for GB_Matrix_extract", GB0) ;
-    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_Matrix_extract", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_Matrix_extract", GB0) ;
-    ASSERT_MATRIX_OK (A, "A input for GB_Matrix_extract", GB0) ;
 
     // check domains and dimensions for C<M> = accum (C,T)
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type,
@@ -95,10 +108,31 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    // get unpacked copies of any packed inputs
+    GB_OK (GB_packed_view (&M, M_in, Context)) ;
+    GB_OK (GB_packed_view (&A_view, A_in, Context)) ;
+    A = A_view ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_Matrix_extract", GB0) ;
+    ASSERT_MATRIX_OK (A, "A input for GB_Matrix_extract", GB0) ;
+
     // delete any lingering zombies and assemble any pending tuples
     GB_MATRIX_WAIT (M) ;        // cannot be jumbled
     GB_MATRIX_WAIT (A) ;        // cannot be jumbled
 
+    // use the cached transpose of A, if available
+    if (A_transpose)
+    {
+        GrB_Matrix AT = NULL ;
+        GB_OK (GB_transpose_cache_get (&AT, A, Context)) ;
+        if (AT != NULL)
+        { 
+            // T = AT (Rows,Cols), where AT = A'
+            GBURBLE ("(cached transpose) ") ;
+            A = AT ;
+            A_transpose = false ;
+        }
+    }
+
     GB_BURBLE_DENSE (C, "(C %s) ") ;
     GB_BURBLE_DENSE (M, "(M %s) ") ;
     GB_BURBLE_DENSE (A, "(A %s) ") ;
@@ -171,7 +205,9 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // C<M> = accum (C,T): accumulate the results into C via the mask M
     //--------------------------------------------------------------------------
 
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
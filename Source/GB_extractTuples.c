@@ -24,6 +24,7 @@
 {                                               \
     GB_FREE_WORK (&Ap, Ap_size) ;               \
     GB_FREE_WORK (&X_bitmap, X_bitmap_size) ;   \
+    GB_PACKED_VIEW_FREE (A, A_in) ;             \
 }
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
@@ -33,7 +34,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     void *X,                    // array for returning values of tuples
     GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
     const GB_Type_code xcode,   // type of array X
-    const GrB_Matrix A,         // matrix to extract tuples from
+    const GrB_Matrix A_in,      // matrix to extract tuples from
     GB_Context Context
 )
 {
@@ -45,9 +46,12 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     GrB_Info info ;
     GB_void *restrict X_bitmap = NULL ; size_t X_bitmap_size = 0 ;
     int64_t *restrict Ap       = NULL ; size_t Ap_size = 0 ;
+    ASSERT (p_nvals != NULL) ;
 
+    // get an unpacked copy of A, if it is packed
+    GrB_Matrix A = A_in ;
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
     ASSERT_MATRIX_OK (A, "A to extract", GB0) ;
-    ASSERT (p_nvals != NULL) ;
 
     // delete any lingering zombies and assemble any pending tuples;
     // allow A to remain jumbled
@@ -61,6 +65,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     // xcode and A must be compatible
     if (!GB_code_compatible (xcode, acode))
     { 
+        GB_FREE_ALL ;
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
@@ -69,6 +74,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     { 
         // no work to do
         (*p_nvals) = 0 ;
+        GB_FREE_ALL ;
         return (GrB_SUCCESS) ;
     }
 
@@ -76,6 +82,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     if (nvals < anz && (I_out != NULL || J_out != NULL || X != NULL))
     { 
         // output arrays are not big enough
+        GB_FREE_ALL ;
         return (GrB_INSUFFICIENT_SPACE) ;
     }
 
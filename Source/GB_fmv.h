@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GB_fmv.h: multiversioning of the factory kernels in Source/Generated2
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GraphBLAS is compiled with -DGBFMV=1 (see CMakeLists.txt), each file in
+// Source/Generated2 is compiled three times: for the baseline x86_64 target,
+// with -mavx2 and -DGB_FMV_TARGET=1, and with -mavx512f and -DGB_FMV_TARGET=2.
+// When compiling the AVX2 and AVX512F variants, GB(x) appends the suffix
+// _avx2 or _avx512f to the name of each kernel, so that all three variants
+// of each kernel are linked into the library.
+
+// The switch factories select the variant at run time with GB_FMV (x) instead
+// of GB (x), with the CPU features found by GrB_init (see
+// GB_Global_cpu_features_avx2 and GB_Global_cpu_features_avx512f).  The
+// prototypes of all three variants are declared by GB_fmv_include.h.
+
+// This allows a single library to be compiled for any x86_64 CPU, while
+// still exploiting AVX2 and AVX512F for all of the factory kernels, not just
+// the few with explicit AVX2 or AVX512F code (such as GB_AxB_saxpy5).  It is
+// not used for the JIT kernels, which are compiled for the host CPU.
+
+#ifndef GB_FMV_H
+#define GB_FMV_H
+
+#if defined ( GBFMV ) && GBFMV && GBX86 && !defined ( GBCUDA_DEV ) \
+    && GB_COMPILER_SUPPORTS_AVX2 && GB_COMPILER_SUPPORTS_AVX512F
+#define GB_FMV_ENABLED 1
+#else
+#define GB_FMV_ENABLED 0
+#endif
+
+// name of a kernel variant, with the same prefix as GB(x)
+#define GB_FMV_CAT3(x,y,z) x ## y ## z
+#define GB_FMV_EVAL3(x,y,z) GB_FMV_CAT3 (x,y,z)
+#ifdef GBRENAME
+#define GB_FMV_NAME(x,suffix) GB_FMV_EVAL3 (GM_, x, suffix)
+#else
+#define GB_FMV_NAME(x,suffix) GB_FMV_EVAL3 (GB_, x, suffix)
+#endif
+
+#if GB_FMV_ENABLED
+
+    // select the variant of a kernel for this CPU
+    #define GB_FMV(x)                                                   \
+    (                                                                   \
+        GB_Global_cpu_features_avx512f ( ) ? GB_FMV_NAME (x, _avx512f) : \
+        GB_Global_cpu_features_avx2    ( ) ? GB_FMV_NAME (x, _avx2)    : \
+        GB (x)                                                          \
+    )
+
+    // rename the kernels when compiling the AVX2 or AVX512F variants
+    #if defined ( GB_FMV_TARGET ) && ( GB_FMV_TARGET == 1 )
+        #undef  GB
+        #define GB(x) GB_FMV_NAME (x, _avx2)
+    #elif defined ( GB_FMV_TARGET ) && ( GB_FMV_TARGET == 2 )
+        #undef  GB
+        #define GB(x) GB_FMV_NAME (x, _avx512f)
+    #endif
+
+#else
+
+    // only the baseline kernels are available
+    #define GB_FMV(x) GB (x)
+
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GB_fmv_include.h: declare all variants of the factory kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The caller defines GB_FMV_HEADER as the name of one of the headers in
+// Source/Generated2 (such as "GB_AxB__include2.h"), which declares the
+// prototypes of the baseline kernels.  If the kernels are multiversioned (see
+// GB_fmv.h), the header is included again for the AVX2 and AVX512F variants,
+// with GB(x) renamed.  This file has no #include guard, since it is included
+// once for each header.
+
+#include GB_FMV_HEADER
+
+#if GB_FMV_ENABLED && !defined ( GB_FMV_TARGET )
+
+    // declare the AVX2 variants
+    #undef  GB
+    #define GB(x) GB_FMV_NAME (x, _avx2)
+    #include GB_FMV_HEADER
+
+    // declare the AVX512F variants
+    #undef  GB
+    #define GB(x) GB_FMV_NAME (x, _avx512f)
+    #include GB_FMV_HEADER
+
+    // restore GB(x) for the baseline kernels
+    #undef  GB
+    #define GB(x) GB_FMV_NAME (x, )
+
+#endif
+
+#undef GB_FMV_HEADER
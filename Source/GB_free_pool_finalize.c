@@ -12,6 +12,12 @@
 void GB_free_pool_finalize (void)
 {
 
+    //--------------------------------------------------------------------------
+    // return the per-thread magazines to the free_pool
+    //--------------------------------------------------------------------------
+
+    GB_Global_free_pool_flush ( ) ;
+
     //--------------------------------------------------------------------------
     // free all memory pools
     //--------------------------------------------------------------------------
@@ -51,6 +51,15 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y = NULL ;
     C->Y_shallow = false ;
 
+    // C never has a cached transpose or a saxpy3 plan
+    C->T = NULL ;
+    C->transpose_cache = false ;
+    C->dual_format = false ;
+    C->bitmap_packed = false ;
+    C->index32 = false ;
+    C->keep_plan = false ;
+    C->saxpy3_plan = NULL ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
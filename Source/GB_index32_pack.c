@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+// GB_index32_pack: narrow A->p, A->h, and A->i to 32-bit integers
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The arrays A->p, A->h, and A->i of a sparse or hypersparse matrix A are
+// replaced with int32_t arrays holding the same values, which takes half the
+// memory.  The matrix must have no pending work, and its dimensions and
+// number of entries must all be less than 2^31 (see GB_INDEX32_OK).  A->x and
+// the hyper_hash A->Y are not modified.  The int32_t arrays are held in A->p,
+// A->h, and A->i, and A->p_size, A->h_size, and A->i_size are their sizes in
+// bytes.
+
+// A->magic is set to GB_MAGIC_PACKED.  A user-callable method that uses A as
+// an input works on a widened copy (see GB_packed_view), and one that modifies
+// A widens it back to int64_t in place (see GB_index32_unpack).
+
+#include "GB.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Ap32, Ap32_size) ;        \
+    GB_FREE (&Ah32, Ah32_size) ;        \
+    GB_FREE (&Ai32, Ai32_size) ;        \
+}
+
+GrB_Info GB_index32_pack        // narrow A->p, A->h, and A->i to int32_t
+(
+    GrB_Matrix A,               // sparse or hypersparse matrix to pack
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A to narrow to 32-bit", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_INDEX32_OK (A)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new arrays
+    //--------------------------------------------------------------------------
+
+    const int64_t plen = A->plen ;
+    const int64_t anz = GB_nnz (A) ;
+    const bool A_is_hyper = (A->h != NULL) ;
+    int32_t *restrict Ap32 = NULL ; size_t Ap32_size = 0 ;
+    int32_t *restrict Ah32 = NULL ; size_t Ah32_size = 0 ;
+    int32_t *restrict Ai32 = NULL ; size_t Ai32_size = 0 ;
+    Ap32 = GB_MALLOC (plen+1, int32_t, &Ap32_size) ;
+    Ai32 = GB_MALLOC (GB_IMAX (anz, 1), int32_t, &Ai32_size) ;
+    if (A_is_hyper)
+    {
+        Ah32 = GB_MALLOC (GB_IMAX (plen, 1), int32_t, &Ah32_size) ;
+    }
+    if (Ap32 == NULL || Ai32 == NULL || (A_is_hyper && Ah32 == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy A->p, A->h, and A->i into the new arrays
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + plen, chunk, nthreads_max) ;
+    GB_BURBLE_N (anz, "(index32 pack) ") ;
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Ai = A->i ;
+    int64_t k, p ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= plen ; k++)
+    {
+        Ap32 [k] = (int32_t) Ap [k] ;
+    }
+
+    if (A_is_hyper)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < plen ; k++)
+        {
+            Ah32 [k] = (int32_t) Ah [k] ;
+        }
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        Ai32 [p] = (int32_t) Ai [p] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace A->p, A->h, and A->i with the new arrays
+    //--------------------------------------------------------------------------
+
+    if (!A->p_shallow)
+    {
+        GB_FREE (&(A->p), A->p_size) ;
+    }
+    if (!A->h_shallow)
+    {
+        GB_FREE (&(A->h), A->h_size) ;
+    }
+    if (!A->i_shallow)
+    {
+        GB_FREE (&(A->i), A->i_size) ;
+    }
+    A->p = (int64_t *) Ap32 ; A->p_size = Ap32_size ; A->p_shallow = false ;
+    A->h = (int64_t *) Ah32 ; A->h_size = Ah32_size ; A->h_shallow = false ;
+    A->i = (int64_t *) Ai32 ; A->i_size = Ai32_size ; A->i_shallow = false ;
+    A->nvals = anz ;
+    A->magic = GB_MAGIC_PACKED ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+// GB_index32_unpack: widen A->p, A->h, and A->i back to 64-bit integers
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A->p, A->h, and A->i have been narrowed to int32_t by GB_index32_pack
+// (or imported as int32_t arrays by GB_import), they are widened here back to
+// int64_t, and A->magic is set back to GB_MAGIC.  If A is NULL or is not held
+// with 32-bit indices, nothing is done.  If out of memory, A is left
+// unchanged, with its 32-bit indices.  Any of the 32-bit arrays that are
+// shallow (see GB_packed_view) are not freed.
+
+// The A->index32 setting is not changed, so A is narrowed again by
+// GrB_Matrix_wait, if it still fits (see GB_INDEX32_OK).  If the matrix has
+// grown too large for 32-bit indices in the meantime, it is left as-is.
+
+#include "GB.h"
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE (&Ap, Ap_size) ;            \
+    GB_FREE (&Ah, Ah_size) ;            \
+    GB_FREE (&Ai, Ai_size) ;            \
+}
+
+GrB_Info GB_index32_unpack      // widen A->p, A->h, and A->i to int64_t
+(
+    GrB_Matrix A,               // matrix to unpack, if held in 32 bits
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || A->magic != GB_MAGIC_PACKED || A->p == NULL)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the new arrays
+    //--------------------------------------------------------------------------
+
+    const int64_t plen = A->plen ;
+    const int64_t anz = A->nvals ;
+    const bool A_is_hyper = (A->h != NULL) ;
+    int64_t *restrict Ap = NULL ; size_t Ap_size = 0 ;
+    int64_t *restrict Ah = NULL ; size_t Ah_size = 0 ;
+    int64_t *restrict Ai = NULL ; size_t Ai_size = 0 ;
+    Ap = GB_MALLOC (plen+1, int64_t, &Ap_size) ;
+    Ai = GB_MALLOC (GB_IMAX (anz, 1), int64_t, &Ai_size) ;
+    if (A_is_hyper)
+    {
+        Ah = GB_MALLOC (GB_IMAX (plen, 1), int64_t, &Ah_size) ;
+    }
+    if (Ap == NULL || Ai == NULL || (A_is_hyper && Ah == NULL))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the 32-bit arrays into the new arrays
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + plen, chunk, nthreads_max) ;
+    GB_BURBLE_N (anz, "(index32 unpack) ") ;
+
+    const int32_t *restrict Ap32 = (int32_t *) A->p ;
+    const int32_t *restrict Ah32 = (int32_t *) A->h ;
+    const int32_t *restrict Ai32 = (int32_t *) A->i ;
+    int64_t k, p ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= plen ; k++)
+    {
+        Ap [k] = (int64_t) Ap32 [k] ;
+    }
+
+    if (A_is_hyper)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < plen ; k++)
+        {
+            Ah [k] = (int64_t) Ah32 [k] ;
+        }
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        Ai [p] = (int64_t) Ai32 [p] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the 32-bit arrays with the new arrays
+    //--------------------------------------------------------------------------
+
+    if (!A->p_shallow)
+    { 
+        GB_FREE (&(A->p), A->p_size) ;
+    }
+    if (!A->h_shallow)
+    { 
+        GB_FREE (&(A->h), A->h_size) ;
+    }
+    if (!A->i_shallow)
+    { 
+        GB_FREE (&(A->i), A->i_size) ;
+    }
+    A->p = Ap ; A->p_size = Ap_size ; A->p_shallow = false ;
+    A->h = Ah ; A->h_size = Ah_size ; A->h_shallow = false ;
+    A->i = Ai ; A->i_size = Ai_size ; A->i_shallow = false ;
+    A->magic = GB_MAGIC ;
+    ASSERT_MATRIX_OK (A, "A widened from 32-bit", GB0) ;
+    return (GrB_SUCCESS) ;
+}
@@ -31,6 +31,7 @@
 // NULL, it is not used, and malloc/memcpy/free are used instead.
 
 #include "GB.h"
+#include "GB_jitifyer.h"
 
 //------------------------------------------------------------------------------
 // GB_init
@@ -102,6 +103,7 @@ GrB_Info GB_init            // start up GraphBLAS
 
     GB_Global_nthreads_max_set (GB_Global_omp_get_max_threads ( )) ;
     GB_Global_chunk_set (GB_CHUNK_DEFAULT) ;
+    GB_Global_memory_budget_set (GxB_DEFAULT) ;
 
     //--------------------------------------------------------------------------
     // initialize the blocking/nonblocking mode
@@ -144,6 +146,12 @@ GrB_Info GB_init            // start up GraphBLAS
 
     GB_Global_timing_clear_all ( ) ;
 
+    //--------------------------------------------------------------------------
+    // CPU JIT
+    //--------------------------------------------------------------------------
+
+    GB_jitifyer_init ( ) ;
+
     //--------------------------------------------------------------------------
     // CUDA initializations
     //--------------------------------------------------------------------------
@@ -0,0 +1,1092 @@
+//------------------------------------------------------------------------------
+// GB_jitifyer.c: CPU JIT: compile, load, and cache kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each JIT kernel is identified by its name, GB_jit_KNAME_SCODE_HASH, where
+// KNAME is the kind of kernel (AxB_dot3, for example), SCODE is the enumified
+// problem (in hex), and HASH is a hash of the names and definitions of any
+// user-defined types and operators (0 if none).  The name is used for the
+// source file of the kernel, the shared library it is compiled into, and the
+// key of the in-process hash table of loaded kernels.
+
+// Kernels are kept in the cache folder, GxB_JIT_CACHE_PATH, in a subfolder
+// for this version of GraphBLAS and this build of its kernels
+// (GraphBLAS_v7.3.0_HASH, for example), so a library compiled by one version
+// is never loaded by another.  HASH is a hash of the compiler, its flags, and
+// the contents of the header and template files the kernels are compiled
+// with, so a change to the layout of an internal struct (GB_matrix.h, for
+// example) or to the compiler flags selects a new subfolder, and kernels
+// compiled for the old layout are not loaded.  If a kernel is not in
+// the hash table but its shared library is already in the cache folder (from
+// a prior run, or another process), the library is loaded without compiling
+// it.  A new library is compiled under a temporary name and then renamed, so
+// that concurrent processes sharing the same cache folder never load a
+// partially written library.  Stale subfolders are not removed.
+
+// The hash table and its contents persist until GrB_finalize.  They are
+// allocated with the ANSI C malloc/free, not with the memory manager passed
+// to GxB_init, since they are not user-visible objects.
+
+#include "GB.h"
+#include "GB_jitifyer.h"
+
+#if defined ( GBJIT )
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+extern char **environ ;
+#endif
+
+// defaults, normally defined by CMakeLists.txt
+#ifndef GB_JIT_C_COMPILER
+#define GB_JIT_C_COMPILER "cc"
+#endif
+
+#ifndef GB_JIT_C_FLAGS
+#define GB_JIT_C_FLAGS "-O3 -fopenmp"
+#endif
+
+#ifndef GB_JIT_SOURCE_PATH
+#define GB_JIT_SOURCE_PATH ""
+#endif
+
+//------------------------------------------------------------------------------
+// JIT state
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint64_t hash ;         // hash of the kernel name; 0 if entry is empty
+    char *name ;            // kernel name
+    void *dl_handle ;       // handle from dlopen; NULL if compile failed
+    void *dl_function ;     // kernel function; NULL if compile failed
+}
+GB_jit_entry ;
+
+static GB_jit_entry *GB_jit_table = NULL ;
+static int64_t GB_jit_table_size = 0 ;      // always a power of 2
+static int64_t GB_jit_table_populated = 0 ;
+
+static bool  GB_jit_control = false ;
+static char *GB_jit_C_compiler = NULL ;
+static char *GB_jit_C_flags = NULL ;
+static char *GB_jit_cache_path = NULL ;
+static bool  GB_jit_cache_path_is_temp = false ;
+static char *GB_jit_kernel_path = NULL ;    // folder of the kernels
+static uint64_t GB_jit_build_hash = 0 ;     // hash of the JIT headers
+
+// statistics
+static int64_t GB_jit_cache_hits = 0 ;      // # kernels loaded from the cache
+static int64_t GB_jit_cache_misses = 0 ;    // # kernels compiled
+static double  GB_jit_compile_time = 0 ;    // total time to compile kernels
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_strdup: copy a string
+//------------------------------------------------------------------------------
+
+static char *GB_jitifyer_strdup (const char *s)
+{
+    if (s == NULL) return (NULL) ;
+    size_t len = strlen (s) ;
+    char *t = malloc (len + 1) ;
+    if (t != NULL)
+    {
+        memcpy (t, s, len + 1) ;
+    }
+    return (t) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_hash: FNV-1a hash of a string
+//------------------------------------------------------------------------------
+
+static uint64_t GB_jitifyer_hash (uint64_t hash, const char *s)
+{
+    if (s == NULL) return (hash) ;
+    for ( ; (*s) != '\0' ; s++)
+    {
+        hash ^= (uint8_t) (*s) ;
+        hash *= ((uint64_t) 0x100000001B3) ;
+    }
+    return (hash) ;
+}
+
+#define GB_JIT_HASH_INIT ((uint64_t) 0xCBF29CE484222325)
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_hash_folder: hash the contents of the files in a folder
+//------------------------------------------------------------------------------
+
+// Each file whose name ends with one of the suffixes is hashed, with its name.
+// The per-file hashes are summed, so the result does not depend on the order
+// in which readdir returns the files.
+
+#if defined ( GBJIT )
+static uint64_t GB_jitifyer_hash_folder
+(
+    uint64_t hash,
+    const char *path,       // folder to hash
+    const char *suffix1,    // hash files ending in suffix1 or suffix2
+    const char *suffix2
+)
+{
+    DIR *dir = opendir (path) ;
+    if (dir == NULL) return (hash) ;
+    size_t len = strlen (path) + 512 ;
+    char *filename = malloc (len) ;
+    uint8_t *buf = malloc (8192) ;
+    uint64_t sum = 0 ;
+    struct dirent *d ;
+    while (filename != NULL && buf != NULL && (d = readdir (dir)) != NULL)
+    {
+        size_t n = strlen (d->d_name) ;
+        size_t n1 = strlen (suffix1), n2 = strlen (suffix2) ;
+        if (!((n > n1 && strcmp (d->d_name + n - n1, suffix1) == 0) ||
+              (n > n2 && strcmp (d->d_name + n - n2, suffix2) == 0)))
+        {
+            continue ;
+        }
+        snprintf (filename, len, "%s/%s", path, d->d_name) ;
+        FILE *f = fopen (filename, "rb") ;
+        if (f == NULL) continue ;
+        uint64_t h = GB_jitifyer_hash (GB_JIT_HASH_INIT, d->d_name) ;
+        size_t nread ;
+        while ((nread = fread (buf, 1, 8192, f)) > 0)
+        {
+            for (size_t k = 0 ; k < nread ; k++)
+            {
+                h ^= buf [k] ;
+                h *= ((uint64_t) 0x100000001B3) ;
+            }
+        }
+        fclose (f) ;
+        sum += h ;
+    }
+    free (buf) ;
+    free (filename) ;
+    closedir (dir) ;
+    // fold the sum into the hash
+    for (int k = 0 ; k < 8 ; k++)
+    {
+        hash ^= (uint8_t) (sum >> (8*k)) ;
+        hash *= ((uint64_t) 0x100000001B3) ;
+    }
+    return (hash) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_hash_type/op/monoid: hash a user-defined type, op, or monoid
+//------------------------------------------------------------------------------
+
+// Built-in types and operators are fully described by the scode, and are
+// not hashed.
+
+static uint64_t GB_jitifyer_hash_type
+(
+    uint64_t hash,
+    GrB_Type type,
+    bool *has_defn
+)
+{
+    if (type == NULL || type->code != GB_UDT_code) return (hash) ;
+    (*has_defn) = true ;
+    hash = GB_jitifyer_hash (hash, type->name) ;
+    return (GB_jitifyer_hash (hash, type->defn)) ;
+}
+
+static uint64_t GB_jitifyer_hash_op
+(
+    uint64_t hash,
+    GB_Operator op,
+    bool *has_defn
+)
+{
+    if (op == NULL) return (hash) ;
+    hash = GB_jitifyer_hash_type (hash, op->xtype, has_defn) ;
+    hash = GB_jitifyer_hash_type (hash, op->ytype, has_defn) ;
+    hash = GB_jitifyer_hash_type (hash, op->ztype, has_defn) ;
+    if (op->defn == NULL) return (hash) ;
+    (*has_defn) = true ;
+    hash = GB_jitifyer_hash (hash, op->name) ;
+    return (GB_jitifyer_hash (hash, op->defn)) ;
+}
+
+static uint64_t GB_jitifyer_hash_monoid
+(
+    uint64_t hash,
+    GrB_Monoid monoid,
+    bool *has_defn
+)
+{
+    if (monoid == NULL) return (hash) ;
+    hash = GB_jitifyer_hash_op (hash, (GB_Operator) monoid->op, has_defn) ;
+    if (monoid->op->opcode == GB_USER_binop_code)
+    {
+        // the identity and terminal values of a user-defined monoid are part
+        // of the kernel
+        size_t zsize = monoid->op->ztype->size ;
+        for (int k = 0 ; k < 2 ; k++)
+        {
+            const uint8_t *value = (k == 0) ?
+                (uint8_t *) monoid->identity :
+                (uint8_t *) monoid->terminal ;
+            if (value == NULL) continue ;
+            for (size_t b = 0 ; b < zsize ; b++)
+            {
+                hash ^= value [b] ;
+                hash *= ((uint64_t) 0x100000001B3) ;
+            }
+        }
+    }
+    return (hash) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_init: initialize the JIT, called by GrB_init
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_init (void)
+{
+    GB_jitifyer_finalize ( ) ;
+    GB_jit_C_compiler = GB_jitifyer_strdup (GB_JIT_C_COMPILER) ;
+    GB_jit_C_flags = GB_jitifyer_strdup (GB_JIT_C_FLAGS) ;
+    #if defined ( GBJIT )
+    // The JIT is enabled only if the GraphBLAS source tree it was compiled
+    // from is still present, since the kernels include its headers.  An
+    // installed library whose build tree has been removed starts with the
+    // JIT disabled, rather than failing to compile each kernel it needs.
+    GB_jit_control = false ;
+    const char *src = GB_JIT_SOURCE_PATH ;
+    if (strlen (src) > 0)
+    {
+        size_t len = strlen (src) + 64 ;
+        char *header = malloc (len) ;
+        if (header != NULL)
+        {
+            snprintf (header, len, "%s/Source/Template/GB_jit_kernel.h", src) ;
+            GB_jit_control = (access (header, R_OK) == 0) ;
+            free (header) ;
+        }
+    }
+    // the cache folder can be set by the environment, so that an application
+    // can use a persistent cache without modifying its source code
+    GB_jit_cache_path = GB_jitifyer_strdup
+        (getenv ("GRAPHBLAS_JIT_CACHE_PATH")) ;
+    #else
+    GB_jit_control = false ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_remove_files: remove the files of a kernel from a temp cache
+//------------------------------------------------------------------------------
+
+#if defined ( GBJIT )
+static void GB_jitifyer_remove_files (const char *name)
+{
+    const char *suffix [3] = { ".c", ".so", ".log" } ;
+    size_t len = strlen (GB_jit_kernel_path) + strlen (name) + 16 ;
+    char *filename = malloc (len) ;
+    if (filename == NULL) return ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        snprintf (filename, len, "%s/%s%s%s", GB_jit_kernel_path,
+            (k == 1) ? "lib" : "", name, suffix [k]) ;
+        unlink (filename) ;
+    }
+    free (filename) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_finalize: unload all kernels and free the JIT state
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_finalize (void)
+{
+    if (GB_jit_table != NULL)
+    {
+        for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->name == NULL) continue ;
+            #if defined ( GBJIT )
+            if (e->dl_handle != NULL)
+            {
+                dlclose (e->dl_handle) ;
+            }
+            if (GB_jit_cache_path_is_temp && GB_jit_kernel_path != NULL)
+            {
+                GB_jitifyer_remove_files (e->name) ;
+            }
+            #endif
+            free (e->name) ;
+        }
+        free (GB_jit_table) ;
+    }
+    #if defined ( GBJIT )
+    if (GB_jit_cache_path_is_temp && GB_jit_cache_path != NULL)
+    {
+        rmdir (GB_jit_cache_path) ;
+    }
+    #endif
+    GB_jit_table = NULL ;
+    GB_jit_table_size = 0 ;
+    GB_jit_table_populated = 0 ;
+    free (GB_jit_C_compiler ) ; GB_jit_C_compiler  = NULL ;
+    free (GB_jit_C_flags    ) ; GB_jit_C_flags     = NULL ;
+    free (GB_jit_cache_path ) ; GB_jit_cache_path  = NULL ;
+    free (GB_jit_kernel_path) ; GB_jit_kernel_path = NULL ;
+    GB_jit_build_hash = 0 ;
+    GB_jit_cache_path_is_temp = false ;
+    GB_jit_control = false ;
+    GB_jit_cache_hits = 0 ;
+    GB_jit_cache_misses = 0 ;
+    GB_jit_compile_time = 0 ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_control_get/set: enable/disable the JIT
+//------------------------------------------------------------------------------
+
+bool GB_jitifyer_control_get (void)
+{
+    return (GB_jit_control) ;
+}
+
+void GB_jitifyer_control_set (bool jit_control)
+{
+    #if defined ( GBJIT )
+    GB_jit_control = jit_control ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_path_reset: select a new kernel folder for the next kernel
+//------------------------------------------------------------------------------
+
+// The kernel folder of a persistent cache depends on the compiler and its
+// flags, so it is found again when the next kernel is loaded.  A temporary
+// folder is private to this process and is kept.
+
+static void GB_jitifyer_kernel_path_reset (void)
+{
+    if (!GB_jit_cache_path_is_temp)
+    {
+        free (GB_jit_kernel_path) ;
+        GB_jit_kernel_path = NULL ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_compiler_get/set: C compiler used by the JIT
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_compiler_get (void)
+{
+    return (GB_jit_C_compiler) ;
+}
+
+GrB_Info GB_jitifyer_compiler_set (const char *compiler)
+{
+    if (compiler == NULL) return (GrB_NULL_POINTER) ;
+    char *s = GB_jitifyer_strdup (compiler) ;
+    if (s == NULL) return (GrB_OUT_OF_MEMORY) ;
+    free (GB_jit_C_compiler) ;
+    GB_jit_C_compiler = s ;
+    GB_jitifyer_kernel_path_reset ( ) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_flags_get/set: C compiler flags used by the JIT
+//------------------------------------------------------------------------------
+
+const char *GB_jitifyer_flags_get (void)
+{
+    return (GB_jit_C_flags) ;
+}
+
+GrB_Info GB_jitifyer_flags_set (const char *flags)
+{
+    if (flags == NULL) return (GrB_NULL_POINTER) ;
+    char *s = GB_jitifyer_strdup (flags) ;
+    if (s == NULL) return (GrB_OUT_OF_MEMORY) ;
+    free (GB_jit_C_flags) ;
+    GB_jit_C_flags = s ;
+    GB_jitifyer_kernel_path_reset ( ) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_cache_path_get/set: folder for kernel sources and libraries
+//------------------------------------------------------------------------------
+
+// If the cache path is not set, a temporary folder is created the first time
+// a kernel is compiled, and removed (with its kernels) by GrB_finalize.
+// Otherwise, the kernels are kept in a subfolder of the cache path for this
+// version of GraphBLAS, which is created if it does not exist.
+
+const char *GB_jitifyer_cache_path_get (void)
+{
+    return (GB_jit_cache_path) ;
+}
+
+GrB_Info GB_jitifyer_cache_path_set (const char *cache_path)
+{
+    if (cache_path == NULL) return (GrB_NULL_POINTER) ;
+    if (GB_jit_cache_path_is_temp && GB_jit_table_populated > 0)
+    {
+        // kernels already compiled in the temporary folder must stay there
+        return (GrB_INVALID_VALUE) ;
+    }
+    char *s = GB_jitifyer_strdup (cache_path) ;
+    if (s == NULL) return (GrB_OUT_OF_MEMORY) ;
+    #if defined ( GBJIT )
+    if (GB_jit_cache_path_is_temp)
+    {
+        rmdir (GB_jit_cache_path) ;
+    }
+    #endif
+    free (GB_jit_cache_path) ;
+    GB_jit_cache_path = s ;
+    GB_jit_cache_path_is_temp = false ;
+    // the kernel folder is found when the next kernel is loaded
+    free (GB_jit_kernel_path) ;
+    GB_jit_kernel_path = NULL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_stats_get: JIT cache statistics
+//------------------------------------------------------------------------------
+
+// hits is the number of kernels loaded from the cache folder without
+// compiling them, and misses is the number of kernels compiled (successfully
+// or not).  A kernel already loaded by this process is not counted again.
+
+void GB_jitifyer_stats_get
+(
+    int64_t *hits,
+    int64_t *misses,
+    double *compile_time
+)
+{
+    if (hits         != NULL) (*hits)         = GB_jit_cache_hits ;
+    if (misses       != NULL) (*misses)       = GB_jit_cache_misses ;
+    if (compile_time != NULL) (*compile_time) = GB_jit_compile_time ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_cache_bytes: total size of the files in the kernel folder
+//------------------------------------------------------------------------------
+
+int64_t GB_jitifyer_cache_bytes (void)
+{
+    int64_t bytes = 0 ;
+    #if defined ( GBJIT )
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        const char *path = GB_jit_kernel_path ;
+        DIR *dir = (path == NULL) ? NULL : opendir (path) ;
+        if (dir != NULL)
+        {
+            size_t len = strlen (path) + 512 ;
+            char *filename = malloc (len) ;
+            struct dirent *d ;
+            while (filename != NULL && (d = readdir (dir)) != NULL)
+            {
+                struct stat st ;
+                snprintf (filename, len, "%s/%s", path, d->d_name) ;
+                if (stat (filename, &st) == 0 && S_ISREG (st.st_mode))
+                {
+                    bytes += (int64_t) st.st_size ;
+                }
+            }
+            free (filename) ;
+            closedir (dir) ;
+        }
+    }
+    #endif
+    return (bytes) ;
+}
+
+#if defined ( GBJIT )
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_mkdir: create a folder and its parents, if they do not exist
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_mkdir (char *path)
+{
+    // create each parent of the path in turn, then the path itself
+    for (char *p = path + 1 ; ; p++)
+    {
+        if ((*p) == '/' || (*p) == '\0')
+        {
+            char c = (*p) ;
+            (*p) = '\0' ;
+            bool ok = (mkdir (path, S_IRWXU | S_IRWXG | S_IRWXO) == 0)
+                || (errno == EEXIST) ;
+            (*p) = c ;
+            if (!ok) return (false) ;
+            if (c == '\0') return (true) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_kernel_path: find or create the folder for the kernels
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_kernel_path (void)
+{
+    if (GB_jit_kernel_path != NULL)
+    {
+        // the folder already exists
+        return (true) ;
+    }
+
+    char *path = NULL ;
+    if (GB_jit_cache_path == NULL)
+    {
+        // create a temporary folder, removed by GrB_finalize
+        const char *tmpdir = getenv ("TMPDIR") ;
+        if (tmpdir == NULL) tmpdir = "/tmp" ;
+        size_t len = strlen (tmpdir) + 32 ;
+        path = malloc (len) ;
+        if (path == NULL) return (false) ;
+        snprintf (path, len, "%s/GB_jit_XXXXXX", tmpdir) ;
+        if (mkdtemp (path) == NULL)
+        {
+            free (path) ;
+            return (false) ;
+        }
+        GB_jit_cache_path = GB_jitifyer_strdup (path) ;
+        if (GB_jit_cache_path == NULL)
+        {
+            rmdir (path) ;
+            free (path) ;
+            return (false) ;
+        }
+        GB_jit_cache_path_is_temp = true ;
+    }
+    else
+    {
+        // use the subfolder of the cache path for this version of GraphBLAS,
+        // this compiler and its flags, and the headers and templates that
+        // the kernels are compiled with
+        if (GB_jit_build_hash == 0)
+        {
+            const char *src = GB_JIT_SOURCE_PATH ;
+            size_t slen = strlen (src) + 64 ;
+            char *folder = malloc (slen) ;
+            if (folder == NULL) return (false) ;
+            uint64_t hash = GB_JIT_HASH_INIT ;
+            snprintf (folder, slen, "%s/Include", src) ;
+            hash = GB_jitifyer_hash_folder (hash, folder, ".h", ".h") ;
+            snprintf (folder, slen, "%s/Source", src) ;
+            hash = GB_jitifyer_hash_folder (hash, folder, ".h", ".h") ;
+            snprintf (folder, slen, "%s/Source/Template", src) ;
+            hash = GB_jitifyer_hash_folder (hash, folder, ".h", ".c") ;
+            free (folder) ;
+            GB_jit_build_hash = hash ;
+        }
+        uint64_t hash = GB_jit_build_hash ;
+        hash = GB_jitifyer_hash (hash, GB_jit_C_compiler) ;
+        hash = GB_jitifyer_hash (hash, "\n") ;
+        hash = GB_jitifyer_hash (hash, GB_jit_C_flags) ;
+        size_t len = strlen (GB_jit_cache_path) + 64 ;
+        path = malloc (len) ;
+        if (path == NULL) return (false) ;
+        snprintf (path, len, "%s/GraphBLAS_v%d.%d.%d_%016" PRIx64,
+            GB_jit_cache_path, GxB_IMPLEMENTATION_MAJOR,
+            GxB_IMPLEMENTATION_MINOR, GxB_IMPLEMENTATION_SUB, hash) ;
+        if (!GB_jitifyer_mkdir (path))
+        {
+            GBURBLE ("(jit: unable to create %s) ", path) ;
+            free (path) ;
+            return (false) ;
+        }
+    }
+    GB_jit_kernel_path = path ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_dlopen: load a kernel from its shared library
+//------------------------------------------------------------------------------
+
+static void *GB_jitifyer_dlopen (const char *libname, void **dl_function)
+{
+    void *dl_handle = dlopen (libname, RTLD_LAZY) ;
+    (*dl_function) = NULL ;
+    if (dl_handle != NULL)
+    {
+        (*dl_function) = dlsym (dl_handle, "GB_jit_kernel") ;
+        if ((*dl_function) == NULL)
+        {
+            dlclose (dl_handle) ;
+            dl_handle = NULL ;
+        }
+    }
+    return (dl_handle) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_lookup: find a kernel in the hash table
+//------------------------------------------------------------------------------
+
+static GB_jit_entry *GB_jitifyer_lookup (const char *name, uint64_t hash)
+{
+    if (GB_jit_table == NULL) return (NULL) ;
+    uint64_t mask = GB_jit_table_size - 1 ;
+    for (uint64_t k = hash & mask ; ; k = (k + 1) & mask)
+    {
+        GB_jit_entry *e = &(GB_jit_table [k]) ;
+        if (e->name == NULL)
+        {
+            // empty slot: the kernel is not in the table
+            return (NULL) ;
+        }
+        if (e->hash == hash && strcmp (e->name, name) == 0)
+        {
+            // found it
+            return (e) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_insert: add a kernel to the hash table
+//------------------------------------------------------------------------------
+
+// The name is owned by the table on success.
+
+static bool GB_jitifyer_insert
+(
+    char *name, uint64_t hash, void *dl_handle, void *dl_function
+)
+{
+
+    //--------------------------------------------------------------------------
+    // ensure the table is at most half full
+    //--------------------------------------------------------------------------
+
+    if (GB_jit_table == NULL || 2 * (GB_jit_table_populated + 1) >
+        GB_jit_table_size)
+    {
+        int64_t newsize = GB_IMAX (256, 2 * GB_jit_table_size) ;
+        GB_jit_entry *newtable = calloc (newsize, sizeof (GB_jit_entry)) ;
+        if (newtable == NULL) return (false) ;
+        uint64_t newmask = newsize - 1 ;
+        for (int64_t k = 0 ; k < GB_jit_table_size ; k++)
+        {
+            GB_jit_entry *e = &(GB_jit_table [k]) ;
+            if (e->name == NULL) continue ;
+            uint64_t i = e->hash & newmask ;
+            while (newtable [i].name != NULL)
+            {
+                i = (i + 1) & newmask ;
+            }
+            newtable [i] = (*e) ;
+        }
+        free (GB_jit_table) ;
+        GB_jit_table = newtable ;
+        GB_jit_table_size = newsize ;
+    }
+
+    //--------------------------------------------------------------------------
+    // insert the new kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t mask = GB_jit_table_size - 1 ;
+    uint64_t k = hash & mask ;
+    while (GB_jit_table [k].name != NULL)
+    {
+        k = (k + 1) & mask ;
+    }
+    GB_jit_entry *e = &(GB_jit_table [k]) ;
+    e->hash = hash ;
+    e->name = name ;
+    e->dl_handle = dl_handle ;
+    e->dl_function = dl_function ;
+    GB_jit_table_populated++ ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_macrofy: write the source file of a kernel
+//------------------------------------------------------------------------------
+
+static bool GB_jitifyer_macrofy
+(
+    const char *filename,
+    const char *name,
+    GB_jit_family family,
+    const char *kname,
+    uint64_t scode,
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GrB_Type ctype,
+    GrB_Type atype,
+    GrB_Type btype
+)
+{
+    FILE *fp = fopen (filename, "w") ;
+    if (fp == NULL) return (false) ;
+    fprintf (fp,
+        "//--------------------------------------"
+        "----------------------------------------\n"
+        "// %s.c: JIT kernel for SuiteSparse:GraphBLAS v%d.%d.%d\n"
+        "//--------------------------------------"
+        "----------------------------------------\n"
+        "// created by GB_jitifyer; do not edit\n\n"
+        "#include \"GB_jit_kernel.h\"\n\n",
+        name, GxB_IMPLEMENTATION_MAJOR, GxB_IMPLEMENTATION_MINOR,
+        GxB_IMPLEMENTATION_SUB) ;
+    switch (family)
+    {
+        case GB_jit_mxm_family :
+            GB_macrofy_mxm (fp, scode, semiring, ctype, atype, btype) ;
+            break ;
+        case GB_jit_ewise_family :
+            GB_macrofy_ewise (fp, scode, (GrB_BinaryOp) op, ctype, atype,
+                btype) ;
+            break ;
+        case GB_jit_reduce_family :
+            GB_macrofy_reduce (fp, scode, monoid, atype) ;
+            break ;
+        case GB_jit_select_family :
+            GB_macrofy_select (fp, scode, op, atype) ;
+            break ;
+        default : ;
+            break ;
+    }
+    fprintf (fp, "\n#include \"GB_jit_kernel_%s.c\"\n", kname) ;
+    fclose (fp) ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_compile: compile a kernel into a shared library
+//------------------------------------------------------------------------------
+
+// The compiler is run directly with posix_spawnp, not through a shell, so
+// that no part of the compiler name, its flags, or the folder names is
+// interpreted by a shell.  The compiler name is a single program name or path
+// (which may contain spaces), and the flags are split into separate arguments
+// at each space or tab.  The output of the compiler is written to logfile.
+// Returns true if the compiler ran and succeeded.
+
+static bool GB_jitifyer_compile
+(
+    const char *src,            // GraphBLAS source tree
+    const char *libfile,        // shared library to create
+    const char *cfile,          // source file of the kernel
+    const char *logfile         // compiler output
+)
+{
+
+    //--------------------------------------------------------------------------
+    // copy the flags and split them into words
+    //--------------------------------------------------------------------------
+
+    char *flags = GB_jitifyer_strdup (GB_jit_C_flags) ;
+    if (flags == NULL) return (false) ;
+    int nflags = 0 ;
+    for (char *p = flags ; (*p) != '\0' ; p++)
+    {
+        bool start = ((*p) != ' ' && (*p) != '\t') &&
+            (p == flags || p [-1] == ' ' || p [-1] == '\t') ;
+        if (start) nflags++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the argument list
+    //--------------------------------------------------------------------------
+
+    size_t len = strlen (src) + 32 ;
+    char *inc [3] ;
+    inc [0] = malloc (len) ;
+    inc [1] = malloc (len) ;
+    inc [2] = malloc (len) ;
+    char **argv = calloc (nflags + 16, sizeof (char *)) ;
+    bool ok = (inc [0] != NULL && inc [1] != NULL && inc [2] != NULL &&
+        argv != NULL) ;
+
+    if (ok)
+    {
+        snprintf (inc [0], len, "-I%s/Include", src) ;
+        snprintf (inc [1], len, "-I%s/Source", src) ;
+        snprintf (inc [2], len, "-I%s/Source/Template", src) ;
+        int argc = 0 ;
+        argv [argc++] = GB_jit_C_compiler ;
+        for (char *p = flags ; (*p) != '\0' ; )
+        {
+            // skip leading white space, then take the next word
+            while ((*p) == ' ' || (*p) == '\t') (*p++) = '\0' ;
+            if ((*p) == '\0') break ;
+            argv [argc++] = p ;
+            while ((*p) != '\0' && (*p) != ' ' && (*p) != '\t') p++ ;
+        }
+        argv [argc++] = "-fPIC" ;
+        argv [argc++] = "-shared" ;
+        argv [argc++] = inc [0] ;
+        argv [argc++] = inc [1] ;
+        argv [argc++] = inc [2] ;
+        argv [argc++] = "-o" ;
+        argv [argc++] = (char *) libfile ;
+        argv [argc++] = (char *) cfile ;
+        argv [argc] = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // run the compiler, with its output sent to the log file
+    //--------------------------------------------------------------------------
+
+    if (ok)
+    {
+        posix_spawn_file_actions_t actions ;
+        ok = (posix_spawn_file_actions_init (&actions) == 0) ;
+        if (ok)
+        {
+            pid_t pid ;
+            int status = 0 ;
+            ok = (posix_spawn_file_actions_addopen (&actions, 1, logfile,
+                    O_WRONLY | O_CREAT | O_TRUNC, 0644) == 0)
+              && (posix_spawn_file_actions_adddup2 (&actions, 1, 2) == 0)
+              && (posix_spawnp (&pid, GB_jit_C_compiler, &actions, NULL,
+                    argv, environ) == 0) ;
+            if (ok)
+            {
+                while (waitpid (pid, &status, 0) < 0 && errno == EINTR) ;
+                ok = WIFEXITED (status) && (WEXITSTATUS (status) == 0) ;
+            }
+            posix_spawn_file_actions_destroy (&actions) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    free (argv) ;
+    free (inc [0]) ;
+    free (inc [1]) ;
+    free (inc [2]) ;
+    free (flags) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_worker: find, or compile and load, a kernel
+//------------------------------------------------------------------------------
+
+// This method is called inside a critical section.
+
+static GrB_Info GB_jitifyer_worker
+(
+    // output:
+    void **dl_function,
+    // input:
+    GB_jit_family family,
+    const char *kname,
+    uint64_t scode,
+    GrB_Semiring semiring,
+    GrB_Monoid monoid,
+    GB_Operator op,
+    GrB_Type ctype,
+    GrB_Type atype,
+    GrB_Type btype
+)
+{
+
+    //--------------------------------------------------------------------------
+    // hash the user-defined types and operators
+    //--------------------------------------------------------------------------
+
+    uint64_t defn_hash = GB_JIT_HASH_INIT ;
+    bool has_defn = false ;
+    GrB_Type types [3] = { ctype, atype, btype } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        defn_hash = GB_jitifyer_hash_type (defn_hash, types [k], &has_defn) ;
+    }
+    if (semiring != NULL)
+    {
+        defn_hash = GB_jitifyer_hash_monoid (defn_hash, semiring->add,
+            &has_defn) ;
+        defn_hash = GB_jitifyer_hash_op (defn_hash,
+            (GB_Operator) semiring->multiply, &has_defn) ;
+    }
+    defn_hash = GB_jitifyer_hash_monoid (defn_hash, monoid, &has_defn) ;
+    defn_hash = GB_jitifyer_hash_op (defn_hash, op, &has_defn) ;
+    if (!has_defn) defn_hash = 0 ;
+
+    //--------------------------------------------------------------------------
+    // construct the kernel name and look it up in the hash table
+    //--------------------------------------------------------------------------
+
+    char name [256] ;
+    snprintf (name, 256, "GB_jit_%s_%016" PRIx64 "_%016" PRIx64,
+        kname, scode, defn_hash) ;
+    uint64_t hash = GB_jitifyer_hash (GB_JIT_HASH_INIT, name) ;
+    if (hash == 0) hash = 1 ;
+
+    GB_jit_entry *e = GB_jitifyer_lookup (name, hash) ;
+    if (e != NULL)
+    {
+        // the kernel has already been loaded, or it failed to compile
+        (*dl_function) = e->dl_function ;
+        return ((e->dl_function == NULL) ? GrB_NO_VALUE : GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find or create the folder for the kernels
+    //--------------------------------------------------------------------------
+
+    if (!GB_jitifyer_kernel_path ( ))
+    {
+        // unable to create the folder; disable the JIT
+        GB_jit_control = false ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // load the kernel from the cache folder, or compile it
+    //--------------------------------------------------------------------------
+
+    const char *path = GB_jit_kernel_path ;
+    size_t len = strlen (path) + strlen (name) + 64 ;
+    char *filename = malloc (len) ;
+    char *tmpfile  = malloc (len) ;
+    char *logfile  = malloc (len) ;
+    char *libname  = malloc (len) ;
+    char *tmplib   = malloc (len) ;
+    char *kernel_name = GB_jitifyer_strdup (name) ;
+    void *dl_handle = NULL ;
+    (*dl_function) = NULL ;
+
+    if (filename != NULL && tmpfile != NULL && logfile != NULL &&
+        libname != NULL && tmplib != NULL && kernel_name != NULL)
+    {
+        snprintf (libname, len, "%s/lib%s.so", path, name) ;
+        dl_handle = GB_jitifyer_dlopen (libname, dl_function) ;
+        if (dl_handle != NULL)
+        {
+            // the kernel is already in the cache folder
+            GBURBLE ("(jit load: %s) ", name) ;
+            GB_jit_cache_hits++ ;
+        }
+        else
+        {
+            // write the source to a file and compile it, using temporary
+            // names unique to this process, then rename them
+            int pid = (int) getpid ( ) ;
+            snprintf (filename, len, "%s/%s.c", path, name) ;
+            snprintf (tmpfile, len, "%s/%s_%d.c", path, name, pid) ;
+            snprintf (tmplib,  len, "%s/lib%s_%d.so", path, name, pid) ;
+            snprintf (logfile, len, "%s/%s.log", path, name) ;
+            GB_jit_cache_misses++ ;
+            if (GB_jitifyer_macrofy (tmpfile, name, family, kname, scode,
+                semiring, monoid, op, ctype, atype, btype))
+            {
+                GBURBLE ("(jit compile: %s) ", name) ;
+                double t = GB_OPENMP_GET_WTIME ;
+                bool ok = GB_jitifyer_compile (GB_JIT_SOURCE_PATH, tmplib,
+                    tmpfile, logfile) ;
+                t = GB_OPENMP_GET_WTIME - t ;
+                GB_jit_compile_time += t ;
+                GBURBLE ("(%.3g sec) ", t) ;
+                rename (tmpfile, filename) ;
+                if (ok && rename (tmplib, libname) == 0)
+                {
+                    dl_handle = GB_jitifyer_dlopen (libname, dl_function) ;
+                }
+                if (dl_handle == NULL)
+                {
+                    unlink (tmplib) ;
+                    GBURBLE ("(jit failed: see %s) ", logfile) ;
+                }
+            }
+        }
+    }
+
+    free (filename) ;
+    free (tmpfile) ;
+    free (logfile) ;
+    free (libname) ;
+    free (tmplib) ;
+
+    //--------------------------------------------------------------------------
+    // add the kernel to the hash table, even if it failed to compile
+    //--------------------------------------------------------------------------
+
+    if (kernel_name == NULL ||
+        !GB_jitifyer_insert (kernel_name, hash, dl_handle, (*dl_function)))
+    {
+        // out of memory
+        free (kernel_name) ;
+        if (dl_handle != NULL) dlclose (dl_handle) ;
+        (*dl_function) = NULL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    return (((*dl_function) == NULL) ? GrB_NO_VALUE : GrB_SUCCESS) ;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_load: return a JIT kernel, compiling it if needed
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_load
+(
+    // output:
+    void **dl_function,         // pointer to the kernel function
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kernel name, e.g. "AxB_dot3"
+    uint64_t scode,             // enumified problem
+    GrB_Semiring semiring,      // semiring, for the mxm family
+    GrB_Monoid monoid,          // monoid, for the reduce family
+    GB_Operator op,             // operator, for the ewise and select families
+    GrB_Type ctype,
+    GrB_Type atype,
+    GrB_Type btype
+)
+{
+
+    (*dl_function) = NULL ;
+    if (!GB_jit_control)
+    {
+        // the JIT is disabled
+        return (GrB_NO_VALUE) ;
+    }
+
+    #if defined ( GBJIT )
+    GrB_Info info ;
+    #pragma omp critical (GB_jitifyer_worker)
+    {
+        info = GB_jitifyer_worker (dl_function, family, kname, scode,
+            semiring, monoid, op, ctype, atype, btype) ;
+    }
+    return (info) ;
+    #else
+    return (GrB_NO_VALUE) ;
+    #endif
+}
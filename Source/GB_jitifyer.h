@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// GB_jitifyer.h: definitions for the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The CPU JIT constructs a kernel for a problem that is not handled by the
+// pre-compiled kernels in Generated2/ (user-defined types and operators, or
+// built-in semirings disabled via GB_control.h).  The problem is first
+// enumified into a 64-bit code, and then macrofied into a set of macros that
+// are #include'd by the same templates used for the pre-compiled kernels.
+// The kernel is compiled with the C compiler into a shared library, which is
+// loaded with dlopen.  Loaded kernels are kept in a hash table, so each
+// kernel is compiled and loaded at most once.
+
+// The CPU JIT requires dlopen/dlsym.  It is enabled only if GBJIT is defined
+// at compile time (see CMakeLists.txt).  If a kernel cannot be compiled or
+// loaded, the JIT returns GrB_NO_VALUE and the caller uses its generic method.
+
+#ifndef GB_JITIFYER_H
+#define GB_JITIFYER_H
+
+#include "GB_stringify.h"
+
+//------------------------------------------------------------------------------
+// kernel families
+//------------------------------------------------------------------------------
+
+typedef enum
+{
+    GB_jit_mxm_family = 0,      // C<M>=A*B: dot2, dot3, saxpy3, saxbit
+    GB_jit_ewise_family = 1,    // C<M>=A+B, A.*B: add, emult
+    GB_jit_reduce_family = 2,   // s = reduce (A)
+    GB_jit_select_family = 3    // C = select (A,y), user-defined idxunop
+}
+GB_jit_family ;
+
+//------------------------------------------------------------------------------
+// JIT eligibility
+//------------------------------------------------------------------------------
+
+// true if a type can be used in a JIT kernel
+#define GB_JIT_TYPE_OK(type)                                            \
+    ((type) == NULL || (type)->code != GB_UDT_code || (type)->defn != NULL)
+
+// true if an operator can be used in a JIT kernel
+#define GB_JIT_OP_OK(op)                                                \
+    ((op)->defn != NULL || !(                                           \
+        (op)->opcode == GB_USER_unop_code    ||                         \
+        (op)->opcode == GB_USER_idxunop_code ||                         \
+        (op)->opcode == GB_USER_binop_code   ||                         \
+        (op)->opcode == GB_USER_selop_code))
+
+//------------------------------------------------------------------------------
+// GB_jitifyer_load: return a JIT kernel, compiling it if needed
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jitifyer_load
+(
+    // output:
+    void **dl_function,         // pointer to the kernel function
+    // input:
+    GB_jit_family family,       // kernel family
+    const char *kname,          // kernel name, e.g. "AxB_dot3"
+    uint64_t scode,             // enumified problem
+    GrB_Semiring semiring,      // semiring, for the mxm family
+    GrB_Monoid monoid,          // monoid, for the reduce family
+    GB_Operator op,             // operator, for the ewise and select families
+    GrB_Type ctype,
+    GrB_Type atype,
+    GrB_Type btype
+) ;
+
+//------------------------------------------------------------------------------
+// JIT control
+//------------------------------------------------------------------------------
+
+void GB_jitifyer_init (void) ;              // called by GrB_init
+void GB_jitifyer_finalize (void) ;          // called by GrB_finalize
+
+bool GB_jitifyer_control_get (void) ;
+void GB_jitifyer_control_set (bool jit_control) ;
+
+const char *GB_jitifyer_compiler_get (void) ;
+GrB_Info GB_jitifyer_compiler_set (const char *compiler) ;
+
+const char *GB_jitifyer_flags_get (void) ;
+GrB_Info GB_jitifyer_flags_set (const char *flags) ;
+
+const char *GB_jitifyer_cache_path_get (void) ;
+GrB_Info GB_jitifyer_cache_path_set (const char *cache_path) ;
+
+void GB_jitifyer_stats_get
+(
+    int64_t *hits,              // # of kernels loaded from the cache folder
+    int64_t *misses,            // # of kernels compiled
+    double *compile_time        // total time spent compiling kernels
+) ;
+
+int64_t GB_jitifyer_cache_bytes (void) ;    // size of the kernel folder
+
+#endif
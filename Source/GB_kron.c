@@ -11,16 +11,19 @@
 
 // The input matrices A and B are optionally transposed.
 
-#define GB_FREE_WORKSPACE   \
-{                           \
-    GB_Matrix_free (&AT) ;  \
-    GB_Matrix_free (&BT) ;  \
+#define GB_FREE_WORKSPACE               \
+{                                       \
+    GB_Matrix_free (&AT) ;              \
+    GB_Matrix_free (&BT) ;              \
+    GB_PACKED_VIEW_FREE (A, A_in) ;     \
+    GB_PACKED_VIEW_FREE (B, B_in) ;     \
 }
 
-#define GB_FREE_ALL         \
-{                           \
-    GB_FREE_WORKSPACE ;     \
-    GB_Matrix_free (&T) ;   \
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_FREE_WORKSPACE ;                 \
+    GB_Matrix_free (&T) ;               \
+    GB_PACKED_VIEW_FREE (M, M_in) ;     \
 }
 
 #include "GB_kron.h"
@@ -32,14 +35,14 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
 (
     GrB_Matrix C,                   // input/output matrix for results
     const bool C_replace,           // if true, clear C before writing to it
-    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
     const bool Mask_comp,           // if true, use !M
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GrB_BinaryOp op_in,       // defines '*' for kron(A,B)
-    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix A_in,          // input matrix
     bool A_transpose,               // if true, use A' instead of A
-    const GrB_Matrix B,             // input matrix
+    const GrB_Matrix B_in,          // input matrix
     bool B_transpose,               // if true, use B' instead of B
     GB_Context Context
 )
@@ -55,6 +58,7 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     struct GB_Matrix_opaque T_header, AT_header, BT_header ;
     GrB_Matrix T = NULL, AT = NULL, BT = NULL ;
     GrB_BinaryOp op = op_in ;
+    GrB_Matrix M = M_in, A = A_in, B = B_in ;
 
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
@@ -63,6 +67,12 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     GB_RETURN_IF_NULL_OR_FAULTY (op) ;
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
 
+    // unpack C, and get unpacked copies of any packed inputs
+    GB_OK (GB_packed_unpack (C, Context)) ;
+    GB_OK (GB_packed_view (&M, M_in, Context)) ;
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
+    GB_OK (GB_packed_view (&B, B_in, Context)) ;
+
     ASSERT_MATRIX_OK (C, "C input for GB_kron", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_kron", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_kron", GB0) ;
@@ -89,24 +99,32 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
     int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
     int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    int64_t anz = GB_nnz (A) ;
+    int64_t bnz = GB_nnz (B) ;
     GrB_Index cnrows, cncols, cnz = 0 ;
     bool ok = GB_int64_multiply (&cnrows, anrows,  bnrows) ;
     ok = ok && GB_int64_multiply (&cncols, ancols,  bncols) ;
-    ok = ok && GB_int64_multiply (&cnz, GB_nnz (A), GB_nnz (B)) ;
+    ok = ok && GB_int64_multiply (&cnz, anz, bnz) ;
     if (!ok || GB_NROWS (C) != cnrows || GB_NCOLS (C) != cncols)
     { 
+        GB_FREE_ALL ;
         GB_ERROR (GrB_DIMENSION_MISMATCH, "%s:\n"
             "output is " GBd "-by-" GBd "; must be " GBu "-by-" GBu "\n"
             "first input is " GBd "-by-" GBd "%s with " GBd " entries\n"
             "second input is " GBd "-by-" GBd "%s with " GBd " entries",
             ok ? "Dimensions not compatible:" : "Problem too large:",
             GB_NROWS (C), GB_NCOLS (C), cnrows, cncols,
-            anrows, ancols, A_transpose ? " (transposed)" : "", GB_nnz (A),
-            bnrows, bncols, B_transpose ? " (transposed)" : "", GB_nnz (B)) ;
+            anrows, ancols, A_transpose ? " (transposed)" : "", anz,
+            bnrows, bncols, B_transpose ? " (transposed)" : "", bnz) ;
     }
 
     // quick return if an empty mask is complemented
-    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+    if (Mask_comp && (M == NULL || (GB_IS_FULL (M) && Mask_struct)))
+    { 
+        // C<!NULL>=NULL since result does not depend on computing Z
+        GB_FREE_ALL ;
+        return (C_replace ? GB_clear (C, Context) : GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // transpose A and B if requested
@@ -171,7 +189,9 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     // C<M> = accum (C,T): accumulate the results into C via the mask
     //--------------------------------------------------------------------------
 
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
@@ -111,8 +111,9 @@ void GB_macrofy_ewise           // construct all macros for GrB_eWise
     // construct macros for the multiply
     //--------------------------------------------------------------------------
 
+    // GB_EWISEOP(z,x,y,i,k,j) computes z = op (x,y), or op(y,x) if flipped
     fprintf (fp, "\n// binary operator:\n") ;
-    GB_macrofy_binop (fp, "GB_BINOP", flipxy, false, binop_ecode, binaryop,
+    GB_macrofy_binop (fp, "GB_EWISEOP", flipxy, false, binop_ecode, binaryop,
         false) ;
     fprintf (fp, "#define GB_FLIPXY %d\n\n", flipxy ? 1 : 0) ;
 
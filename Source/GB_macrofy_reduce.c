@@ -28,7 +28,9 @@ void GB_macrofy_reduce      // construct all macros for GrB_reduce to scalar
     int red_ecode   = GB_RSHIFT (rcode, 20, 5) ;
     int id_ecode    = GB_RSHIFT (rcode, 15, 5) ;
     int term_ecode  = GB_RSHIFT (rcode, 10, 5) ;
-    bool is_term    = (term_ecode < 30) ;
+    bool is_term    = (term_ecode < 30) ||
+                      (term_ecode == 30 && monoid->terminal != NULL) ;
+    bool is_any     = (term_ecode == 18) ;
 
     // type of the monoid
     int zcode       = GB_RSHIFT (rcode, 6, 4) ;
@@ -66,6 +68,19 @@ void GB_macrofy_reduce      // construct all macros for GrB_reduce to scalar
 
     fprintf (fp, "\n// reduction monoid:\n") ;
     GB_macrofy_monoid (fp, red_ecode, id_ecode, term_ecode, monoid, false) ;
+    fprintf (fp, "#define GB_MONOID_IS_TERMINAL %d\n", is_term) ;
+    fprintf (fp, "#define GB_IS_ANY_MONOID %d\n", is_any) ;
+
+    // panel size for the reduction (no panel for user-defined types, since
+    // the panel method compares its entries with the terminal value)
+    if (zcode == GB_UDT_code)
+    { 
+        fprintf (fp, "#define GB_PANEL 1\n") ;
+    }
+    else
+    { 
+        fprintf (fp, "#define GB_PANEL 16\n") ;
+    }
 
     //--------------------------------------------------------------------------
     // construct the macros for A
@@ -0,0 +1,82 @@
+//------------------------------------------------------------------------------
+// GB_macrofy_select: construct all macros for GrB_select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+void GB_macrofy_select      // construct all macros for GrB_select
+(
+    // output:
+    FILE *fp,               // target file to write, already open
+    // input:
+    uint64_t scode,
+    GB_Operator op,         // index unary operator to macrofy
+    GrB_Type atype
+)
+{
+
+    //--------------------------------------------------------------------------
+    // extract the select scode
+    //--------------------------------------------------------------------------
+
+    // operator
+    bool flipij     = GB_RSHIFT (scode, 18, 1) ;
+
+    // format of A
+    int asparsity   = GB_RSHIFT (scode, 0, 2) ;
+
+    //--------------------------------------------------------------------------
+    // describe the problem
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "// GB_select_%016" PRIX64 ".h (%s%s, A: %s)\n", scode,
+        op->name, flipij ? " (flipped)" : "", atype->name) ;
+
+    //--------------------------------------------------------------------------
+    // construct the typedefs
+    //--------------------------------------------------------------------------
+
+    GB_macrofy_types (fp, NULL, atype->defn, NULL,
+        op->xtype->defn, op->ytype->defn, op->ztype->defn) ;
+
+    //--------------------------------------------------------------------------
+    // construct the macros for the type names
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "// thunk type:\n") ;
+    fprintf (fp, "#define GB_Y_TYPENAME %s\n", op->ytype->name) ;
+
+    //--------------------------------------------------------------------------
+    // construct the macro for the index unary operator
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// index unary operator:\n") ;
+    if (flipij)
+    { 
+        fprintf (fp, "#define GB_IDXUNOP(z,x,i,j,y) %s (&(z), &(x), j, i, "
+            "&(y))\n", op->name) ;
+    }
+    else
+    { 
+        fprintf (fp, "#define GB_IDXUNOP(z,x,i,j,y) %s (&(z), &(x), i, j, "
+            "&(y))\n", op->name) ;
+    }
+    if (op->defn != NULL)
+    { 
+        fprintf (fp, "%s\n", op->defn) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the macros for A
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// A matrix:\n") ;
+    GB_macrofy_sparsity (fp, "A", asparsity) ;
+    fprintf (fp, "#define GB_A_TYPENAME %s\n", atype->name) ;
+}
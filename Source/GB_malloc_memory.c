@@ -47,6 +47,9 @@ static inline void *GB_malloc_helper
         #ifdef GB_MEMDUMP
         printf ("hard malloc %p %ld\n", p, *size) ;
         #endif
+
+        // place a large block on the NUMA nodes and/or use huge pages
+        GB_memory_placement (p, *size, false) ;
     }
     #ifdef GB_MEMDUMP
     GB_Global_free_pool_dump (2) ; GB_Global_memtable_dump ( ) ;
@@ -105,6 +105,29 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         return (GrB_NULL_POINTER) ;
     }
 
+    if (A->magic == GB_MAGIC_PACKED)
+    {
+        // A is a packed bitmap, or is held with 32-bit indices (see
+        // GB_packed_unpack).  Only its header is checked here; its content is
+        // checked when it is unpacked.
+        GBPR0 (", %s %s\n", (A->b != NULL) ? "packed bitmap" :
+            "packed with 32-bit indices", A->is_csc ? "by col" : "by row") ;
+        info = GB_Type_check (A->type, "", pr_developer, f) ;
+        if (info != GrB_SUCCESS || A->vlen < 0 || A->vdim < 0
+            || GB_ANY_PENDING_WORK (A))
+        {
+            GBPR0 ("  invalid packed %s\n", kind) ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+        GBPR0 ("  ") ;
+        if (name != NULL && strlen (name) > 0)
+        {
+            GBPR0 ("%s, ", name) ;
+        }
+        GBPR0 (GBd " entries\n", A->nvals) ;
+        return (GrB_SUCCESS) ;
+    }
+
     GB_CHECK_MAGIC (A) ;
 
     //--------------------------------------------------------------------------
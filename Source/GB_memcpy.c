@@ -13,6 +13,27 @@
 
 #define GB_MEM_CHUNK (1024*1024)
 
+// arguments for GB_memcpy_task
+typedef struct
+{
+    GB_void *pdest ;
+    const GB_void *psrc ;
+    size_t n ;
+}
+GB_memcpy_args ;
+
+// copy one chunk of the block
+static void GB_memcpy_task (void *arg, int64_t k)
+{
+    GB_memcpy_args *args = (GB_memcpy_args *) arg ;
+    size_t start = k * GB_MEM_CHUNK ;
+    if (start < args->n)
+    { 
+        size_t chunk = GB_IMIN (args->n - start, GB_MEM_CHUNK) ;
+        memcpy (args->pdest + start, args->psrc + start, chunk) ;
+    }
+}
+
 void GB_memcpy                  // parallel memcpy
 (
     void *dest,                 // destination
@@ -43,20 +64,11 @@ void GB_memcpy                  // parallel memcpy
         { 
             nthreads = (int) nchunks ;
         }
-        GB_void *pdest = (GB_void *) dest ;
-        const GB_void *psrc = (GB_void *) src ;
-
-        int64_t k ;
-        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
-        for (k = 0 ; k < nchunks ; k++)
-        {
-            size_t start = k * GB_MEM_CHUNK ;
-            if (start < n)
-            { 
-                size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
-                memcpy (pdest + start, psrc + start, chunk) ;
-            }
-        }
+        GB_memcpy_args args ;
+        args.pdest = (GB_void *) dest ;
+        args.psrc = (const GB_void *) src ;
+        args.n = n ;
+        GB_parallel_for (GB_memcpy_task, &args, nchunks, nthreads) ;
     }
 }
 
@@ -76,6 +76,15 @@ void GB_dealloc_memory      // free memory, return to free_pool or free it
 GB_PUBLIC
 void GB_free_pool_finalize (void) ;
 
+bool GB_memory_placement    // place a newly allocated block of memory
+(
+    // input/output
+    void *p,                // block of memory to place
+    // input
+    size_t size,            // size of the block, in bytes
+    bool do_clear           // if true, the block must be set to zero
+) ;
+
 void *GB_xalloc_memory      // return the newly-allocated space
 (
     // input
@@ -7,7 +7,7 @@
 
 //------------------------------------------------------------------------------
 
-#include "GB.h"
+#include "GB_AxB_saxpy3.h"
 
 void GB_memoryUsage         // count # allocated blocks and their sizes
 (
@@ -31,7 +31,7 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
     //--------------------------------------------------------------------------
 
     // a matrix contains 0 to 10 dynamically malloc'd blocks, not including
-    // A->Y
+    // A->Y, A->T, and A->saxpy3_plan
     (*nallocs) = 0 ;
     (*mem_deep) = 0 ;
     (*mem_shallow) = 0 ;
@@ -159,6 +159,36 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         }
     }
 
+    if (A->T != NULL)
+    { 
+        // the cached transpose A->T is never shallow
+        int64_t T_nallocs = 0 ;
+        size_t T_mem_deep = 0 ;
+        size_t T_mem_shallow = 0 ;
+        GB_memoryUsage (&T_nallocs, &T_mem_deep, &T_mem_shallow, A->T) ;
+        (*nallocs) += T_nallocs ;
+        (*mem_deep) += T_mem_deep ;
+        (*mem_shallow) += T_mem_shallow ;
+    }
+
+    if (A->saxpy3_plan != NULL)
+    {
+        // the saxpy3 plan is never shallow
+        GB_saxpy3_plan_struct *plan = A->saxpy3_plan ;
+        GB_saxpy3_pattern *patterns [2] = { &(plan->A_pattern),
+            &(plan->B_pattern) } ;
+        (*nallocs) += 3 ;
+        (*mem_deep) += plan->header_size + plan->SaxpyTasks_size
+            + plan->Cp_size ;
+        for (int k = 0 ; k < 2 ; k++)
+        { 
+            GB_saxpy3_pattern *X = patterns [k] ;
+            (*nallocs) += (X->p != NULL) + (X->h != NULL) + (X->i != NULL)
+                + (X->b != NULL) ;
+            (*mem_deep) += X->p_size + X->h_size + X->i_size + X->b_size ;
+        }
+    }
+
     #pragma omp flush
     return ;
 }
@@ -0,0 +1,183 @@
+//------------------------------------------------------------------------------
+// GB_memory_placement: place a newly allocated block of memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A large block of memory newly allocated by GB_malloc_memory or
+// GB_calloc_memory is placed according to the GxB_MEMORY_POLICY and
+// GxB_HUGE_PAGE_THRESHOLD global settings, before any of its pages are
+// touched.
+
+// GxB_MEMORY_POLICY_INTERLEAVE: the pages of the block are interleaved across
+// all NUMA nodes that the process may use (with mbind).
+
+// GxB_MEMORY_POLICY_FIRST_TOUCH: the block is partitioned into nthreads equal
+// contiguous parts, and each thread touches the pages of its part (or clears
+// them, if do_clear is true), so that each page is placed on the NUMA node of
+// the thread that touches it first.  This is the same partition used by
+// GB_ek_slice and GB_PARTITION for the parallel methods that use the block.
+
+// If the block is at least GxB_HUGE_PAGE_THRESHOLD bytes in size, the
+// operating system is asked to use transparent huge pages (with madvise).
+
+// These are hints.  Any errors are ignored, and nothing is done if the block
+// is small, or if the system does not support them (currently only Linux is
+// supported).  Returns true if the block has been cleared, in which case the
+// caller need not clear it with GB_memset.
+
+#include "GB.h"
+
+#if defined ( __linux__ )
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined ( SYS_mbind ) && defined ( SYS_get_mempolicy )
+#define GB_HAS_MEMORY_PLACEMENT 1
+#endif
+#endif
+
+#ifndef GB_HAS_MEMORY_PLACEMENT
+#define GB_HAS_MEMORY_PLACEMENT 0
+#endif
+
+// smaller blocks are left to the operating system
+#define GB_MEMORY_PLACEMENT_MIN (256*1024)
+
+#if GB_HAS_MEMORY_PLACEMENT
+
+// from <linux/mempolicy.h>, which may not be available
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+#ifndef MPOL_F_MEMS_ALLOWED
+#define MPOL_F_MEMS_ALLOWED (1 << 2)
+#endif
+
+// size of the NUMA node mask, in unsigned longs (up to 1024 nodes)
+#define GB_NODEMASK_LEN (1024 / (8 * sizeof (unsigned long)))
+
+#endif
+
+bool GB_memory_placement    // place a newly allocated block of memory
+(
+    // input/output
+    void *p,                // block of memory to place
+    // input
+    size_t size,            // size of the block, in bytes
+    bool do_clear           // if true, the block must be set to zero
+)
+{
+
+    #if GB_HAS_MEMORY_PLACEMENT
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    int memory_policy = GB_Global_memory_policy_get ( ) ;
+    int64_t huge_page_threshold = GB_Global_huge_page_threshold_get ( ) ;
+    bool use_huge_pages = (huge_page_threshold > 0 &&
+        size >= (size_t) huge_page_threshold) ;
+    if (p == NULL || size < GB_MEMORY_PLACEMENT_MIN ||
+        (memory_policy == GxB_MEMORY_POLICY_DEFAULT && !use_huge_pages))
+    {
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find the pages that lie entirely inside the block
+    //--------------------------------------------------------------------------
+
+    long pagesize = sysconf (_SC_PAGESIZE) ;
+    if (pagesize <= 0) pagesize = 4096 ;
+    uintptr_t page_mask = ~((uintptr_t) (pagesize - 1)) ;
+    uintptr_t first = ((uintptr_t) p + pagesize - 1) & page_mask ;
+    uintptr_t last  = ((uintptr_t) p + size) & page_mask ;
+
+    if (first < last)
+    {
+
+        //----------------------------------------------------------------------
+        // use transparent huge pages
+        //----------------------------------------------------------------------
+
+        #ifdef MADV_HUGEPAGE
+        if (use_huge_pages)
+        {
+            madvise ((void *) first, last - first, MADV_HUGEPAGE) ;
+        }
+        #endif
+
+        //----------------------------------------------------------------------
+        // interleave the pages across the NUMA nodes
+        //----------------------------------------------------------------------
+
+        if (memory_policy == GxB_MEMORY_POLICY_INTERLEAVE)
+        {
+            unsigned long nodemask [GB_NODEMASK_LEN] ;
+            memset (nodemask, 0, sizeof (nodemask)) ;
+            unsigned long maxnode = 8 * sizeof (nodemask) ;
+            if (syscall (SYS_get_mempolicy, NULL, nodemask, maxnode, NULL,
+                MPOL_F_MEMS_ALLOWED) == 0)
+            {
+                syscall (SYS_mbind, (void *) first, last - first,
+                    MPOL_INTERLEAVE, nodemask, maxnode, 0) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // first touch: each thread touches (or clears) its part of the block
+    //--------------------------------------------------------------------------
+
+    if (memory_policy != GxB_MEMORY_POLICY_FIRST_TOUCH)
+    {
+        // the caller must clear the block, if needed
+        return (false) ;
+    }
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads ((double) size / sizeof (int64_t), chunk,
+        nthreads_max) ;
+    GB_void *restrict pbyte = (GB_void *) p ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        size_t pstart, pend ;
+        GB_PARTITION (pstart, pend, size, tid, nthreads) ;
+        if (pstart >= pend) continue ;
+        if (do_clear)
+        {
+            memset (pbyte + pstart, 0, pend - pstart) ;
+        }
+        else
+        {
+            // the contents of the block are undefined, so writing a zero to
+            // one byte of each page is safe
+            volatile GB_void *pv = (volatile GB_void *) pbyte ;
+            pv [pstart] = 0 ;
+            uintptr_t q = ((uintptr_t) (pbyte + pstart) + pagesize - 1)
+                & page_mask ;
+            for ( ; q < (uintptr_t) (pbyte + pend) ; q += pagesize)
+            {
+                pv [q - (uintptr_t) pbyte] = 0 ;
+            }
+        }
+    }
+
+    return (do_clear) ;
+
+    #else
+
+    // memory placement is not supported on this system
+    return (false) ;
+
+    #endif
+}
@@ -13,6 +13,27 @@
 
 #define GB_MEM_CHUNK (1024*1024)
 
+// arguments for GB_memset_task
+typedef struct
+{
+    GB_void *pdest ;
+    int c ;
+    size_t n ;
+}
+GB_memset_args ;
+
+// set one chunk of the block
+static void GB_memset_task (void *arg, int64_t k)
+{
+    GB_memset_args *args = (GB_memset_args *) arg ;
+    size_t start = k * GB_MEM_CHUNK ;
+    if (start < args->n)
+    { 
+        size_t chunk = GB_IMIN (args->n - start, GB_MEM_CHUNK) ;
+        memset (args->pdest + start, args->c, chunk) ;
+    }
+}
+
 void GB_memset                  // parallel memset
 (
     void *dest,                 // destination
@@ -43,19 +64,11 @@ void GB_memset                  // parallel memset
         { 
             nthreads = (int) nchunks ;
         }
-        GB_void *pdest = (GB_void *) dest ;
-
-        int64_t k ;
-        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
-        for (k = 0 ; k < nchunks ; k++)
-        {
-            size_t start = k * GB_MEM_CHUNK ;
-            if (start < n)
-            { 
-                size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
-                memset (pdest + start, c, chunk) ;
-            }
-        }
+        GB_memset_args args ;
+        args.pdest = (GB_void *) dest ;
+        args.c = c ;
+        args.n = n ;
+        GB_parallel_for (GB_memset_task, &args, nchunks, nthreads) ;
     }
 }
 
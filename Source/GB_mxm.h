@@ -33,6 +33,38 @@ GrB_Info GB_mxm                     // C<M> = A*B
     GB_Context Context
 ) ;
 
+GrB_Info GB_mxm_reduce              // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M,             // mask for C (required)
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    GB_Context Context
+) ;
+
+GrB_Info GB_mxm_batch               // C=A*B, passed to f one block at a time
+(
+    GxB_batch_function f,           // function to receive each block of C
+    void *user_data,                // passed to f, may be NULL
+    double batch_size,              // max bytes for each block of C
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Context Context
+) ;
+
 GrB_Info GB_AxB_dot                 // dot product (multiple methods)
 (
     GrB_Matrix C,                   // output matrix, static header
@@ -176,6 +208,23 @@ GrB_Info GB_AxB_dot3_one_slice
     GB_Context Context
 ) ;
 
+GrB_Info GB_AxB_dot3_reduce         // s = reduce (C<M>=A*B), without C
+(
+    // output:
+    GB_void *s,                     // result, of type monoid->op->ztype
+    bool *s_exists,                 // true if C has at least one entry
+    // input:
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M,             // mask matrix
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    GB_Context Context
+) ;
+
 GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
 (
     GrB_Matrix C,                   // input/output matrix, must be dense
@@ -239,6 +288,36 @@ static inline bool GB_AxB_dot3_control
         (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M))) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_AxB_msa_control: determine if the saxpy3 MSA method should be used
+//------------------------------------------------------------------------------
+
+// C<M>=A*B where M is sparse or hypersparse, not complemented, and sparse
+// enough that C is computed in the pattern of M with a masked sparse
+// accumulator (MSA), with no symbolic phase.  M must have at most
+// 1/GB_MSA_DENSITY of the entries of a full cvlen-by-cvdim matrix, and no
+// fewer entries than the Gustavson workspace of a single MSA task.
+
+// internal AxB_method for GB_AxB_saxpy3, selected only by GB_AxB_meta
+#define GB_AxB_MSA ((GrB_Desc_Value) 1099)
+
+#define GB_MSA_DENSITY 16
+
+static inline bool GB_AxB_msa_control
+(
+    const GrB_Matrix M,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+    if (!GB_AxB_dot3_control (M, Mask_comp)) return (false) ;
+    double mnz = (double) GB_nnz (M) ;
+    double cvlen = (double) A->vlen ;
+    double cvdim = (double) B->vdim ;
+    return (mnz * GB_MSA_DENSITY <= cvlen * cvdim && cvlen <= mnz) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot2_control: determine if the dot2 method should be used
 //------------------------------------------------------------------------------
@@ -300,5 +379,27 @@ void GB_AxB_meta_adotb_control
 #define GB_USE_DOT      2
 #define GB_USE_SAXPY    3
 
+//------------------------------------------------------------------------------
+// GB_AxB_meta_pushpull: select push (saxpy) or pull (dot) for C=A*b or A'*b
+//------------------------------------------------------------------------------
+
+int GB_AxB_meta_pushpull        // return GB_USE_SAXPY, GB_USE_DOT, or zero
+(
+    const GrB_Matrix M,         // mask for C, or NULL
+    const bool Mask_comp,       // if true, use !M
+    const GrB_Matrix A,         // input matrix
+    const bool atrans,          // if true, C=A'*B, otherwise C=A*B
+    const GrB_Matrix B,         // input matrix, a single vector
+    const GrB_Semiring semiring,    // semiring that defines C=A*B
+    GB_Context Context
+) ;
+
+// the work of a pull (dot) with a terminal monoid is reduced by this factor,
+// since each dot product can exit early (Beamer et al., SC'12)
+#define GB_PUSHPULL_ALPHA 14
+
+// the work to transpose A, per entry, relative to the work of push or pull
+#define GB_PUSHPULL_TRANSPOSE 2
+
 #endif
 
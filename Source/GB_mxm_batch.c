@@ -0,0 +1,308 @@
+//------------------------------------------------------------------------------
+// GB_mxm_batch: matrix-matrix multiply, one block of the result at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B, where C is computed one block of vectors at a time, and each block is
+// passed to the user function f.  This function is not user-callable.  It does
+// the work for GxB_mxm_batch.
+
+// The blocks of C are held in the default CSR/CSC format.  All of the work is
+// done on the internal vectors, so the description here assumes that format is
+// CSC, where each block is C(:,j1:j2-1) = X*Y(:,j1:j2-1) with X=op(A) and
+// Y=op(B).  If the default format is CSR, each block is C(j1:j2-1,:), and X
+// and Y are op(B) and op(A), both held by row, which are the same data
+// structures as op(B)' and op(A)' held by column.
+
+// X and Y are shallow copies of A and B when op(A) and op(B) are already in
+// the format of C.  Otherwise, the cached transpose is used if it exists, or a
+// transpose is computed.  The flop count of each vector of C is computed by
+// GB_AxB_saxpy3_flopcount, and the blocks are sliced from its cumulative sum
+// so that the flop count of each block, which bounds its number of entries,
+// fits in the batch size.  Each block is then computed by GB_mxm from X and
+// the vectors of Y for that block, and passed to f.
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Bflops, Bflops_size) ;   \
+    GB_Matrix_free (&Yblock) ;              \
+    GB_Matrix_free (&C) ;                   \
+    GB_Matrix_free (&X) ;                   \
+    GB_Matrix_free (&Y) ;                   \
+}
+
+#include "GB_mxm.h"
+#include "GB_AxB_saxpy3.h"
+#include "GB_transpose.h"
+#include "GB_subref.h"
+
+//------------------------------------------------------------------------------
+// GB_mxm_batch_view: C = op(A), held in a given CSR/CSC format
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_mxm_batch_view
+(
+    GrB_Matrix C,                   // output matrix, static header
+    const bool C_is_csc,            // desired CSR/CSC format of C
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, C = A', else C = A
+    GB_Context Context
+)
+{
+
+    GrB_Info info ;
+
+    // a shallow copy of A with the format of C is A' if the formats differ
+    if ((A->is_csc != C_is_csc) == A_transpose)
+    {
+        return (GB_shallow_copy (C, C_is_csc, A, Context)) ;
+    }
+
+    // use the cached transpose of A, if it exists
+    GrB_Matrix AT = NULL ;
+    info = GB_transpose_cache_get (&AT, A, Context) ;
+    if (info != GrB_SUCCESS || AT != NULL)
+    {
+        return ((info != GrB_SUCCESS) ? info :
+            GB_shallow_copy (C, C_is_csc, AT, Context)) ;
+    }
+
+    // C = S', where S is a shallow copy of A with the format of C
+    struct GB_Matrix_opaque S_header ;
+    GrB_Matrix S = NULL ;
+    GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+    info = GB_shallow_copy (S, C_is_csc, A, Context) ;
+    if (info == GrB_SUCCESS)
+    {
+        info = GB_transpose_cast (C, A->type, C_is_csc, S, false, Context) ;
+    }
+    GB_Matrix_free (&S) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mxm_batch
+//------------------------------------------------------------------------------
+
+GrB_Info GB_mxm_batch               // C=A*B, passed to f one block at a time
+(
+    GxB_batch_function f,           // function to receive each block of C
+    void *user_data,                // passed to f, may be NULL
+    double batch_size,              // max bytes for each block of C
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    const int do_sort,              // if nonzero, try to return C unjumbled
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    struct GB_Matrix_opaque X_header, Y_header, Yblock_header ;
+    GrB_Matrix X = NULL, Y = NULL, Yblock = NULL, C = NULL ;
+    int64_t *restrict Bflops = NULL ; size_t Bflops_size = 0 ;
+
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+
+    ASSERT (f != NULL) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm_batch", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_batch", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_batch", GB0) ;
+
+    // C=A*B via semiring: A and B must be compatible with semiring->multiply
+    GB_OK (GB_BinaryOp_compatible (semiring->multiply,
+            NULL, A->type, B->type, GB_ignore_code, Context)) ;
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // get X and Y, in the format of C
+    //--------------------------------------------------------------------------
+
+    // C_internal = X_internal * Y_internal, for either format of C
+    const bool C_is_csc = GB_Global_is_csc_get ( ) ;
+    GB_CLEAR_STATIC_HEADER (X, &X_header) ;
+    GB_CLEAR_STATIC_HEADER (Y, &Y_header) ;
+    if (C_is_csc)
+    {
+        // C = op(A)*op(B), held by column
+        GB_OK (GB_mxm_batch_view (X, true, A, A_transpose, Context)) ;
+        GB_OK (GB_mxm_batch_view (Y, true, B, B_transpose, Context)) ;
+    }
+    else
+    {
+        // C = op(A)*op(B), held by row, is C' = op(B)'*op(A)' by column
+        GB_OK (GB_mxm_batch_view (X, false, B, B_transpose, Context)) ;
+        GB_OK (GB_mxm_batch_view (Y, false, A, A_transpose, Context)) ;
+    }
+    ASSERT (X->vdim == Y->vlen) ;
+    const int64_t cvlen = X->vlen ;
+    const int64_t cvdim = Y->vdim ;
+    const int64_t ynvec = Y->nvec ;
+    const int64_t *restrict Yh = Y->h ;
+
+    //--------------------------------------------------------------------------
+    // determine the max flop count of each block
+    //--------------------------------------------------------------------------
+
+    GrB_Type ctype = semiring->add->op->ztype ;
+    if (batch_size <= 0)
+    {
+        GB_GET_MEMORY_BUDGET (memory_budget, Context) ;
+        batch_size = memory_budget / 2 ;
+    }
+    double max_flops = batch_size / (sizeof (int64_t) + ctype->size) ;
+    if (batch_size <= 0 || GB_OP_IS_POSITIONAL (semiring->multiply)
+        || max_flops >= (double) INT64_MAX)
+    {
+        // C is computed as a single block if there is no limit, or if the
+        // multiply operator depends on the position of the entries in Y
+        max_flops = (double) INT64_MAX ;
+    }
+    const int64_t block_flops = GB_IMAX ((int64_t) max_flops, 1) ;
+
+    //--------------------------------------------------------------------------
+    // compute the flop count of each vector of C, if needed
+    //--------------------------------------------------------------------------
+
+    if (block_flops < INT64_MAX)
+    {
+        GB_OK (GB_hyper_hash_build (X, Context)) ;
+        Bflops = GB_MALLOC_WORK (ynvec + 1, int64_t, &Bflops_size) ;
+        if (Bflops == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int64_t Mwork = 0 ;
+        GB_OK (GB_AxB_saxpy3_flopcount (&Mwork, Bflops, NULL, false, X, Y,
+            Context)) ;
+        GBURBLE ("(batch: " GBd " flops, " GBd " per block) ",
+            Bflops [ynvec], block_flops) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compute C one block at a time
+    //--------------------------------------------------------------------------
+
+    int64_t k1 = 0, j1 = 0 ;
+    while (j1 < cvdim)
+    {
+
+        //----------------------------------------------------------------------
+        // find the vectors Y(:,k1:k2-1) for the block C(:,j1:j2-1)
+        //----------------------------------------------------------------------
+
+        int64_t k2 = ynvec ;
+        if (Bflops != NULL && k1 < ynvec)
+        {
+            // find the largest k2 with flops (C(:,k1:k2-1)) <= block_flops,
+            // with at least one vector in the block
+            int64_t pleft = k1 + 1, pright = ynvec ;
+            while (pleft < pright)
+            {
+                int64_t pmiddle = (pleft + pright + 1) / 2 ;
+                if (Bflops [pmiddle] - Bflops [k1] <= block_flops)
+                {
+                    pleft = pmiddle ;
+                }
+                else
+                {
+                    pright = pmiddle - 1 ;
+                }
+            }
+            k2 = pleft ;
+        }
+        int64_t j2 = (k2 == ynvec) ? cvdim : GBH (Yh, k2) ;
+        ASSERT (j1 < j2 && j2 <= cvdim) ;
+
+        //----------------------------------------------------------------------
+        // C = X*Y(:,j1:j2-1)
+        //----------------------------------------------------------------------
+
+        GrB_Matrix Y_j = Y ;
+        if (j1 > 0 || j2 < cvdim)
+        {
+            GrB_Index J [2] ;
+            J [GxB_BEGIN] = j1 ;
+            J [GxB_END  ] = j2 - 1 ;
+            GB_CLEAR_STATIC_HEADER (Yblock, &Yblock_header) ;
+            GB_OK (GB_subref (Yblock, false, C_is_csc, Y, GrB_ALL, Y->vlen,
+                J, GxB_RANGE, false, Context)) ;
+            Y_j = Yblock ;
+        }
+
+        GB_OK (GB_new (&C, // auto sparsity, new header
+            ctype, cvlen, j2 - j1, GB_Ap_calloc, C_is_csc, GxB_AUTO_SPARSITY,
+            GB_Global_hyper_switch_get ( ), 1, Context)) ;
+        if (C_is_csc)
+        {
+            // C(:,j1:j2-1) = op(A) * op(B)(:,j1:j2-1)
+            GB_OK (GB_mxm (C, false, NULL, false, false, NULL, semiring,
+                X, false, Y_j, false, false, AxB_method, do_sort, Context)) ;
+        }
+        else
+        {
+            // C(j1:j2-1,:) = op(A)(j1:j2-1,:) * op(B)
+            GB_OK (GB_mxm (C, false, NULL, false, false, NULL, semiring,
+                Y_j, false, X, false, false, AxB_method, do_sort, Context)) ;
+        }
+        GB_Matrix_free (&Yblock) ;
+
+        //----------------------------------------------------------------------
+        // pass the block to the user function, and free it
+        //----------------------------------------------------------------------
+
+        info = f (&C, (GrB_Index) j1, user_data) ;
+        GB_Matrix_free (&C) ;
+        if (info != GrB_SUCCESS)
+        {
+            // the user function has stopped the computation
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+
+        k1 = k2 ;
+        j1 = j2 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+// GB_mxm_reduce: reduce the result of a masked matrix-matrix multiply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C)) where C<M>=A*B, and variations.
+
+// This function is not user-callable.  It does the work for GxB_mxm_reduce.
+
+// If possible, the entries of C are computed with the masked dot product
+// method, and each entry is reduced into the result as soon as it has been
+// computed, so that C is never constructed (see GB_AxB_dot3_reduce).
+// Otherwise, C<M>=A*B is computed with GB_mxm and then reduced to the scalar.
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_Matrix_free (&T) ;   \
+}
+
+#include "GB_mxm.h"
+#include "GB_reduce.h"
+#include "GB_scalar.h"
+
+GrB_Info GB_mxm_reduce              // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M,             // mask for C (required)
+    const bool Mask_comp,           // if true, use !M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, use A' instead of A
+    const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, use B' instead of B
+    const GrB_Desc_Value AxB_method,// for auto vs user selection of methods
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // M is NULL only if the user's mask is iso and all zero (see GB_get_mask)
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL ;
+
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+
+    ASSERT_SCALAR_OK (s, "s input for GB_mxm_reduce", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_mxm_reduce", GB0) ;
+    ASSERT_MONOID_OK (monoid, "monoid for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_mxm_reduce", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_mxm_reduce", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_mxm_reduce", GB0) ;
+
+    // check domains for s = accum (s, reduce (C))
+    GrB_Type ztype = monoid->op->ztype ;
+    GrB_Type ctype = semiring->add->op->ztype ;
+    GB_OK (GB_compatible (s->type, NULL, NULL, false, accum, ztype, Context)) ;
+    if (!GB_Type_compatible (ctype, ztype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH, "Result of the semiring of type [%s]\n"
+            "cannot be typecast to the monoid of type [%s]",
+            ctype->name, ztype->name) ;
+    }
+
+    // C=A*B via semiring: A and B must be compatible with semiring->multiply
+    GB_OK (GB_BinaryOp_compatible (semiring->multiply,
+            NULL, A->type, B->type, GB_ignore_code, Context)) ;
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    if (ancols != bnrows || (M != NULL &&
+        (GB_NROWS (M) != anrows || GB_NCOLS (M) != bncols)))
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "mask is " GBd "-by-" GBd "\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            (M == NULL) ? anrows : GB_NROWS (M),
+            (M == NULL) ? bncols : GB_NCOLS (M),
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (M) ;
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // t = reduce (C<M>=A*B), without constructing C, if possible
+    //--------------------------------------------------------------------------
+
+    if (M != NULL && !Mask_comp)
+    {
+        size_t zsize = ztype->size ;
+        GB_void t [GB_VLA(zsize)] ;
+        bool t_exists = false ;
+        info = GB_AxB_dot3_reduce (t, &t_exists, monoid, M, Mask_struct,
+            A, A_transpose, B, B_transpose, semiring, Context) ;
+        if (info == GrB_SUCCESS)
+        {
+            if (!t_exists)
+            {
+                // C has no entries; clear s if there is no accum operator
+                if (accum == NULL)
+                {
+                    GB_OK (GB_clear ((GrB_Matrix) s, Context)) ;
+                }
+                return (GrB_SUCCESS) ;
+            }
+            // s = accum (s, t)
+            struct GB_Scalar_opaque t_header ;
+            GrB_Scalar t_scalar = GB_Scalar_wrap (&t_header, ztype, t) ;
+            return (GB_Scalar_reduce (s, accum, monoid, (GrB_Matrix) t_scalar,
+                Context)) ;
+        }
+        else if (info != GrB_NO_VALUE)
+        {
+            // out of memory
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // T<M> = A*B, and then s = accum (s, reduce (T))
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_new (&T, // auto sparsity, new header
+        ctype, anrows, bncols, GB_Ap_calloc, true, GxB_AUTO_SPARSITY,
+        GB_Global_hyper_switch_get ( ), 1, Context)) ;
+    GB_OK (GB_mxm (T, false, M, Mask_comp, Mask_struct, NULL, semiring,
+        A, A_transpose, B, B_transpose, false, AxB_method, 0, Context)) ;
+    GB_OK (GB_Scalar_reduce (s, accum, monoid, T, Context)) ;
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
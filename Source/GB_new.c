@@ -76,12 +76,21 @@ GrB_Info GB_new                 // create matrix, except for indices & values
         allocated_header = true ;
         (*Ahandle)->static_header = false ;  // header of A has been malloc'd
         (*Ahandle)->header_size = header_size ;
+        (*Ahandle)->transpose_cache = false ;
+        (*Ahandle)->dual_format = false ;
+        (*Ahandle)->bitmap_packed = false ;
+        (*Ahandle)->index32 = GB_Global_index32_get ( ) ;
+        (*Ahandle)->keep_plan = false ;
+        (*Ahandle)->saxpy3_plan = NULL ;
     }
 //  else
 //  { 
 //      // the header of A has been provided on input.  It may already be
 //      // malloc'd, or it might be statically allocated in the caller. 
-//      // (*Ahandle)->static_header is not modified.
+//      // (*Ahandle)->static_header is not modified, nor are the
+//      // (*Ahandle)->transpose_cache, (*Ahandle)->bitmap_packed,
+//      // (*Ahandle)->index32, and (*Ahandle)->keep_plan settings of an
+//      // existing user matrix, nor its (*Ahandle)->saxpy3_plan.
 //  }
 
     GrB_Matrix A = *Ahandle ;
@@ -159,6 +168,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->p = NULL ; A->p_shallow = false ; A->p_size = 0 ;
     A->h = NULL ; A->h_shallow = false ; A->h_size = 0 ;
     A->Y = NULL ; A->Y_shallow = false ;
+    A->T = NULL ;
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
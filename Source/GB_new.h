@@ -108,6 +108,16 @@ void GB_phybix_free             // free all content of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_transpose_cache_free    // free the cached transpose A->T of a matrix
+(
+    GrB_Matrix A                // matrix with cached transpose to free
+) ;
+
+void GB_AxB_saxpy3_plan_free    // free the saxpy3 plan of a matrix
+(
+    GrB_Matrix A                // matrix with the plan to free
+) ;
+
 void GB_Matrix_free             // free a matrix
 (
     GrB_Matrix *Ahandle         // handle of matrix to free
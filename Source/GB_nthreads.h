@@ -25,7 +25,9 @@
 // Some GrB_Matrix and GrB_Vector methods do not take a descriptor, however
 // (GrB_*_dup, _build, _exportTuples, _clear, _nvals, _wait, and GxB_*_resize).
 // For those methods the default rule is always used (nthreads_max =
-// GxB_DEFAULT), which then relies on the global nthreads_max.
+// GxB_DEFAULT), which then relies on the GxB_Context engaged by the calling
+// user thread, if any, or the global nthreads_max otherwise.  A descriptor
+// that also relies on the default rule does the same.
 
 //------------------------------------------------------------------------------
 // GB_GET_NTHREADS_MAX:  determine max # of threads for OpenMP parallelism.
@@ -43,12 +45,12 @@
     int nthreads_max = (Context == NULL) ? 1 : Context->nthreads_max ;      \
     if (nthreads_max <= GxB_DEFAULT)                                        \
     {                                                                       \
-        nthreads_max = GB_Global_nthreads_max_get ( ) ;                     \
+        nthreads_max = GB_Context_nthreads_max ( ) ;                        \
     }                                                                       \
     double chunk = (Context == NULL) ? GxB_DEFAULT : Context->chunk ;       \
     if (chunk <= GxB_DEFAULT)                                               \
     {                                                                       \
-        chunk = GB_Global_chunk_get ( ) ;                                   \
+        chunk = GB_Context_chunk ( ) ;                                      \
     }
 
 //------------------------------------------------------------------------------
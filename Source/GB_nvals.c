@@ -25,6 +25,14 @@ GrB_Info GB_nvals           // get the number of entries in a matrix
 
     GB_RETURN_IF_NULL (nvals) ;
 
+    if (A->magic == GB_MAGIC_PACKED)
+    { 
+        // A is a packed bitmap, or is held with 32-bit indices, and has no
+        // pending work; A->nvals is its number of entries
+        (*nvals) = A->nvals ;
+        return (GrB_SUCCESS) ;
+    }
+
     // leave zombies alone, and leave jumbled, but assemble any pending tuples
     GB_MATRIX_WAIT_IF_PENDING (A) ;
 
@@ -36,9 +36,13 @@
         return (GrB_NULL_POINTER) ;                                     \
     }
 
-// arg may be NULL, but if non-NULL then it must be initialized
+// arg may be NULL, but if non-NULL then it must be initialized.  A packed
+// matrix (see GB_bitmap_pack and GB_index32_pack) is valid.  It is not
+// modified here; a method that needs its content uses an unpacked copy
+// instead (see GB_packed_view).
 #define GB_RETURN_IF_FAULTY(arg)                                        \
-    if ((arg) != NULL && (arg)->magic != GB_MAGIC)                      \
+    if ((arg) != NULL && (arg)->magic != GB_MAGIC                       \
+        && (arg)->magic != GB_MAGIC_PACKED)                             \
     {                                                                   \
         if ((arg)->magic == GB_MAGIC2)                                  \
         {                                                               \
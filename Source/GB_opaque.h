@@ -383,6 +383,15 @@ GB_PUBLIC GrB_IndexUnaryOp GxB_FLIPDIAGINDEX_INT32, GxB_FLIPDIAGINDEX_INT64 ;
 // when A->p array is allocated but not initialized.
 #define GB_MAGIC2 0x7265745f786f62ULL
 
+// The value is set to GB_MAGIC_PACKED when a bitmap matrix has its bitmap A->b
+// packed into bits (see GB_bitmap_pack), or when a sparse or hypersparse
+// matrix has its A->p, A->h, and A->i arrays held as int32_t (see
+// GB_index32_pack).  The matrix is valid, but its content cannot be used by
+// internal methods.  A user-callable method uses an unpacked copy of a packed
+// input matrix (see GB_packed_view), and unpacks a packed output matrix that
+// it modifies (see GB_packed_unpack).
+#define GB_MAGIC_PACKED 0x7265746b786f62ULL
+
 struct GB_Type_opaque       // content of GrB_Type
 {
     int64_t magic ;         // for detecting uninitialized objects
@@ -460,6 +469,20 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     int compression ;       // compression method for GxB_Matrix_serialize
     bool do_sort ;          // if nonzero, do the sort in GrB_mxm
     int import ;            // if zero (default), trust input data
+    double memory_budget ;  // max bytes for C=A*B (global budget if <= 0)
+} ;
+
+//------------------------------------------------------------------------------
+// GxB_Context: thread control for a user thread
+//------------------------------------------------------------------------------
+
+struct GB_Context_opaque    // content of GxB_Context
+{
+    int64_t magic ;         // for detecting uninitialized objects
+    size_t header_size ;    // size of the malloc'd block for this struct, or 0
+    // specific to the Context struct:
+    double chunk ;          // chunk size for # of threads for small problems
+    int nthreads_max ;      // max # threads to use
 } ;
 
 //------------------------------------------------------------------------------
@@ -78,7 +78,8 @@ GB_TYPEDEF (GxB, FC64  , GxB_FC64_t, "GxB_FC64_t" ) ;
         o, o,                   /* default: axb, #threads */            \
         0,                      /* default compression */               \
         0,                      /* no sort */                           \
-        0                       /* import */                            \
+        0,                      /* import */                            \
+        (double) GxB_DEFAULT    /* memory budget */                     \
     } ;                                                                 \
     GrB_Descriptor GRB (DESC_ ## name) = & GB_OPAQUE (desc_ ## name) ;
 
@@ -0,0 +1,101 @@
+//------------------------------------------------------------------------------
+// GB_packed_find: find A(i,j) in a packed matrix, without unpacking it
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A is a packed bitmap, or a sparse or hypersparse matrix held with 32-bit
+// indices (A->magic == GB_MAGIC_PACKED, see GB_packed_unpack), and it has no
+// pending work.  If the entry A(i,j) is present, its position in A->x is
+// returned as *pA, and the result is true.  The indices i and j must be in
+// range.  A is not modified, so this method is used by GrB_*_extractElement
+// and GxB_*_isStoredElement to look up a single entry in O(log(nnz(A(:,j))))
+// time, instead of creating an unpacked copy of A with GB_packed_view.
+
+#include "GB.h"
+
+bool GB_packed_find         // find A(i,j) in a packed matrix
+(
+    int64_t *pA,            // position of A(i,j) in A->x, if found
+    const GrB_Matrix A,     // packed matrix to search; not modified
+    const int64_t i,        // index of A(i,j) in its vector
+    const int64_t j         // vector of A(i,j)
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL && A->magic == GB_MAGIC_PACKED) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (i >= 0 && i < A->vlen && j >= 0 && j < A->vdim) ;
+
+    if (A->b != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // A is a packed bitmap: A(i,j) is present if its bit is set
+        //----------------------------------------------------------------------
+
+        const uint64_t *restrict Aw = (const uint64_t *) A->b ;
+        const int64_t p = i + j * A->vlen ;
+        (*pA) = p ;
+        return (((Aw [p / 64] >> (p % 64)) & 1) != 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // A is sparse or hypersparse, with 32-bit indices
+    //--------------------------------------------------------------------------
+
+    const int32_t *restrict Ap = (const int32_t *) A->p ;
+    const int32_t *restrict Ah = (const int32_t *) A->h ;
+    const int32_t *restrict Ai = (const int32_t *) A->i ;
+
+    int64_t k = j ;
+    if (Ah != NULL)
+    {
+        // binary search for j in the hyperlist Ah [0 ... A->nvec-1]
+        int64_t kleft = 0, kright = A->nvec - 1 ;
+        while (kleft < kright)
+        {
+            int64_t kmid = (kleft + kright) / 2 ;
+            if (Ah [kmid] < j)
+            {
+                kleft = kmid + 1 ;
+            }
+            else
+            {
+                kright = kmid ;
+            }
+        }
+        if (kleft > kright || Ah [kleft] != j)
+        {
+            // vector j is empty
+            return (false) ;
+        }
+        k = kleft ;
+    }
+
+    // binary search for i in A(:,j), which is Ai [Ap [k] ... Ap [k+1]-1]
+    int64_t pleft = Ap [k] ;
+    int64_t pright = Ap [k+1] - 1 ;
+    while (pleft < pright)
+    {
+        int64_t pmid = (pleft + pright) / 2 ;
+        if (Ai [pmid] < i)
+        {
+            pleft = pmid + 1 ;
+        }
+        else
+        {
+            pright = pmid ;
+        }
+    }
+    (*pA) = pleft ;
+    return (pleft == pright && Ai [pleft] == i) ;
+}
+
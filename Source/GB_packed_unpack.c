@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// GB_packed_unpack: unpack a packed matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix with A->magic == GB_MAGIC_PACKED is either a bitmap matrix with its
+// bitmap packed into bits (see GB_bitmap_pack), or a sparse or hypersparse
+// matrix with its A->p, A->h, and A->i arrays held as int32_t (see
+// GB_index32_pack).  The two cases are distinguished by A->b.  If A is NULL
+// or is not packed, nothing is done.  A is unpacked in place, so this method
+// is used only for a matrix that is about to be modified or exported; an input
+// matrix is left packed, and an unpacked copy is used instead (see
+// GB_packed_view).
+
+#include "GB.h"
+
+GrB_Info GB_packed_unpack       // unpack a packed matrix, of any kind
+(
+    GrB_Matrix A,               // matrix to unpack, if packed
+    GB_Context Context
+)
+{
+
+    if (A == NULL || A->magic != GB_MAGIC_PACKED)
+    { 
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+    else if (A->b != NULL)
+    { 
+        // A is bitmap, with its bitmap packed into bits
+        return (GB_bitmap_unpack (A, Context)) ;
+    }
+    else
+    { 
+        // A is sparse or hypersparse, with 32-bit indices
+        return (GB_index32_unpack (A, Context)) ;
+    }
+}
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+// GB_packed_view: unpacked copy of a packed matrix, leaving it unchanged
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If A is packed (A->magic == GB_MAGIC_PACKED, see GB_packed_unpack), V is
+// returned as an unpacked copy of A, and A itself is not modified.  V is
+// shallow, except for the arrays that are unpacked: V->b for a packed bitmap,
+// or V->p, V->h, and V->i for a matrix with 32-bit indices.  V has a
+// dynamically allocated header, and must be freed by the caller with
+// GB_Matrix_free (&V) when it is no longer needed.  V is never returned to the
+// user application.
+
+// This method is used by user-callable methods for each packed input matrix,
+// so that a packed matrix can be used as an input by many user threads at the
+// same time, while remaining packed.  If A is NULL or is not packed, V is
+// returned as A itself.  If out of memory, V is returned as A, and A is not
+// modified.
+
+#include "GB.h"
+
+GrB_Info GB_packed_view         // unpacked copy of a packed matrix
+(
+    GrB_Matrix *Vhandle,        // V: A itself, or an unpacked copy of A
+    const GrB_Matrix A,         // input matrix, not modified
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Vhandle != NULL) ;
+    (*Vhandle) = A ;
+    if (A == NULL || A->magic != GB_MAGIC_PACKED)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct V as a purely shallow copy of A
+    //--------------------------------------------------------------------------
+
+    size_t header_size ;
+    GrB_Matrix V = GB_MALLOC (1, struct GB_Matrix_opaque, &header_size) ;
+    if (V == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // copy the header
+    memcpy (V, A, sizeof (struct GB_Matrix_opaque)) ;
+    V->static_header = false ;
+    V->header_size = header_size ;
+
+    // V has no error logger, cached transpose, or saxpy3 plan of its own
+    V->logger = NULL ;
+    V->logger_size = 0 ;
+    V->T = NULL ;
+    V->transpose_cache = false ;
+    V->dual_format = false ;
+    V->bitmap_packed = false ;
+    V->index32 = false ;
+    V->keep_plan = false ;
+    V->saxpy3_plan = NULL ;
+
+    // flag all content of V as shallow
+    V->p_shallow = (A->p != NULL) ;
+    V->h_shallow = (A->h != NULL) ;
+    V->b_shallow = (A->b != NULL) ;
+    V->i_shallow = (A->i != NULL) ;
+    V->x_shallow = (A->x != NULL) ;
+    V->Y_shallow = (A->Y != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // unpack V, which replaces its shallow packed arrays with new ones
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GB_packed_unpack (V, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory; V is still purely shallow
+        GB_Matrix_free (&V) ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (V, "V unpacked view", GB0) ;
+    (*Vhandle) = V ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GB_parallel_for: run a list of parallel tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The tasks are scheduled by OpenMP.  If the caller is not inside an OpenMP
+// parallel region, a parallel region of nthreads threads is started, and each
+// thread takes the next task from the list as soon as it finishes its current
+// one.
+
+// If the caller is already inside an OpenMP parallel region (of the
+// application), a nested parallel region would either oversubscribe the cores
+// or (the OpenMP default) be run by a single thread.  Instead, the tasks are
+// created as OpenMP tasks that are run by the threads of the parallel region
+// that is already running, as they become idle.  This requires OpenMP 4.5
+// (for the taskloop construct); the tasks are run by the calling thread
+// otherwise.
+
+// In all cases, if there is only one task or one thread, the tasks are run by
+// the calling thread.
+
+#include "GB.h"
+
+#if defined ( _OPENMP ) && ( _OPENMP >= 201511 ) && !GB_COMPILER_MSC
+#define GB_HAS_TASKLOOP 1
+#else
+#define GB_HAS_TASKLOOP 0
+#endif
+
+void GB_parallel_for            // run a list of parallel tasks
+(
+    GB_task_function task,     // task (arg, taskid) to run for each task
+    void *arg,                  // arguments of the parallel loop
+    int64_t ntasks,             // # of tasks to run
+    int nthreads                // max # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // quick return if the tasks can only be run by a single thread
+    //--------------------------------------------------------------------------
+
+    int64_t taskid ;
+    nthreads = (int) GB_IMIN (nthreads, ntasks) ;
+    if (nthreads <= 1)
+    { 
+        for (taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+            task (arg, taskid) ;
+        }
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use OpenMP
+    //--------------------------------------------------------------------------
+
+    #if defined ( _OPENMP )
+    if (omp_in_parallel ( ))
+    { 
+
+        //----------------------------------------------------------------------
+        // share the threads of the parallel region already running
+        //----------------------------------------------------------------------
+
+        #if GB_HAS_TASKLOOP
+        #pragma omp taskloop grainsize(1)
+        #endif
+        for (taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+            task (arg, taskid) ;
+        }
+        return ;
+    }
+    #endif
+
+    //--------------------------------------------------------------------------
+    // start a new parallel region
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
+    { 
+        task (arg, taskid) ;
+    }
+}
+
@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+// GB_parallel_for.h: run a list of parallel tasks
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#ifndef GB_PARALLEL_FOR_H
+#define GB_PARALLEL_FOR_H
+
+// GB_parallel_for (task, arg, ntasks, nthreads) runs task (arg, taskid) for
+// each taskid in the range 0 to ntasks-1.  It is equivalent to the following
+// loop, which is used throughout GraphBLAS, except that it does not start a
+// nested parallel region when called from inside one:
+//
+//      #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+//      for (taskid = 0 ; taskid < ntasks ; taskid++)
+//      {
+//          task (arg, taskid) ;
+//      }
+//
+// The body of the loop is a function, and its inputs and outputs are passed
+// in a struct pointed to by arg.  Tasks may not call GraphBLAS, allocate
+// memory, or wait on each other.  Only a few loops use GB_parallel_for (the
+// parallel memset and memcpy, and the fine tasks of saxpy3 phase3); there is
+// no user-visible hook to replace its scheduler.
+
+typedef void (*GB_task_function)    // one task of a parallel loop
+(
+    void *arg,                  // arguments of the parallel loop
+    int64_t taskid              // task to run, in the range 0 to ntasks-1
+) ;
+
+void GB_parallel_for            // run a list of parallel tasks
+(
+    GB_task_function task,     // task (arg, taskid) to run for each task
+    void *arg,                  // arguments of the parallel loop
+    int64_t ntasks,             // # of tasks to run
+    int nthreads                // max # of threads to use
+) ;
+
+#endif
+
@@ -7,9 +7,9 @@
 
 //------------------------------------------------------------------------------
 
-// Free the A->p, A->h, and A->Y content of a matrix.  The matrix becomes
-// invalid, and would generate a GrB_INVALID_OBJECT error if passed to a
-// user-callable GraphBLAS function.
+// Free the A->p, A->h, and A->Y content of a matrix, and its cached transpose
+// A->T.  The matrix becomes invalid, and would generate a GrB_INVALID_OBJECT
+// error if passed to a user-callable GraphBLAS function.
 
 #include "GB.h"
 
@@ -57,6 +57,7 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
     A->nvec_nonempty = 0 ;
 
     GB_hyper_hash_free (A) ;
+    GB_transpose_cache_free (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
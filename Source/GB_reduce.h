@@ -21,6 +21,19 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     GB_Context Context
 ) ;
 
+GrB_Info GB_reduce_to_scalar_jit    // s = reduce_to_scalar (A) via the JIT
+(
+    // output:
+    GB_void *restrict s,            // result scalar, of type monoid->op->ztype
+    // input:
+    const GrB_Monoid monoid,        // monoid to do the reduction
+    const GrB_Matrix A,             // matrix to reduce
+    GB_void *restrict W,            // workspace of size ntasks * zsize
+    bool *restrict F,               // workspace of size ntasks
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
 (
     GrB_Matrix C,                   // input/output for results, size n-by-1
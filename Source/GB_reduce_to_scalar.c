@@ -27,13 +27,15 @@
 #include "GB_atomics.h"
 #include "GB_stringify.h"
 #ifndef GBCUDA_DEV
-#include "GB_red__include.h"
+#define GB_FMV_HEADER "GB_red__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 #define GB_FREE_ALL                 \
 {                                   \
     GB_WERK_POP (F, bool) ;         \
     GB_WERK_POP (W, GB_void) ;      \
+    GB_PACKED_VIEW_FREE (A, A_in) ; \
 }
 
 GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
@@ -42,7 +44,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     const GrB_Type ctype,       // the type of scalar, c
     const GrB_BinaryOp accum,   // for c = accum(c,s)
     const GrB_Monoid reduce,    // monoid to do the reduction
-    const GrB_Matrix A,         // matrix to reduce
+    const GrB_Matrix A_in,      // matrix to reduce
     GB_Context Context
 )
 {
@@ -52,6 +54,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GrB_Matrix A = A_in ;
     GB_RETURN_IF_NULL_OR_FAULTY (reduce) ;
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
     GB_RETURN_IF_NULL (c) ;
@@ -61,7 +64,6 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     ASSERT_TYPE_OK (ctype, "type of scalar c", GB0) ;
     ASSERT_MONOID_OK (reduce, "reduce for reduce_to_scalar", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for reduce_to_scalar", GB0) ;
-    ASSERT_MATRIX_OK (A, "A for reduce_to_scalar", GB0) ;
 
     // check domains and dimensions for c = accum (c,s)
     GrB_Type ztype = reduce->op->ztype ;
@@ -73,6 +75,13 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
         return (GrB_DOMAIN_MISMATCH) ;
     }
 
+    //--------------------------------------------------------------------------
+    // get an unpacked copy of A, if it is packed
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
+    ASSERT_MATRIX_OK (A, "A for reduce_to_scalar", GB0) ;
+
     //--------------------------------------------------------------------------
     // assemble any pending tuples; zombies are OK
     //--------------------------------------------------------------------------
@@ -188,7 +197,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
                 //--------------------------------------------------------------
 
                 #define GB_red(opname,aname) \
-                    GB (_red_scalar_ ## opname ## aname)
+                    GB_FMV (_red_scalar_ ## opname ## aname)
 
                 #define GB_RED_WORKER(opname,aname,atype)                   \
                 {                                                           \
@@ -211,6 +220,22 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 
             #endif
 
+            //------------------------------------------------------------------
+            // via the JIT kernel
+            //------------------------------------------------------------------
+
+            if (!done)
+            { 
+                info = GB_reduce_to_scalar_jit (s, reduce, A, W, F, ntasks,
+                    nthreads) ;
+                done = (info != GrB_NO_VALUE) ;
+                if (done)
+                { 
+                    GB_BURBLE_MATRIX (A, "(jit reduce to scalar: %s) ",
+                        reduce->op->name) ;
+                }
+            }
+
             //------------------------------------------------------------------
             // generic worker: sum up the entries, no typecasting
             //------------------------------------------------------------------
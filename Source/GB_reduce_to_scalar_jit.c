@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// GB_reduce_to_scalar_jit: s = reduce_to_scalar (A) via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The monoid is inlined into the reduction loop of the kernel, so a
+// user-defined monoid is not called through its function pointer.  A must
+// not be iso, and its type must match the monoid type.  Returns GrB_NO_VALUE
+// if the JIT cannot handle the problem.
+
+#include "GB_reduce.h"
+#include "GB_jitifyer.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    GB_void *result,
+    const GrB_Matrix A,
+    GB_void *restrict W_space,
+    bool *restrict F,
+    int ntasks,
+    int nthreads
+) ;
+
+GrB_Info GB_reduce_to_scalar_jit    // s = reduce_to_scalar (A) via the JIT
+(
+    // output:
+    GB_void *restrict s,            // result scalar, of type monoid->op->ztype
+    // input:
+    const GrB_Monoid monoid,        // monoid to do the reduction
+    const GrB_Matrix A,             // matrix to reduce
+    GB_void *restrict W,            // workspace of size ntasks * zsize
+    bool *restrict F,               // workspace of size ntasks
+    int ntasks,
+    int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the JIT can handle this problem
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp op = monoid->op ;
+    if (!GB_jitifyer_control_get ( ) || A->iso || A->type != op->ztype
+        || !GB_JIT_OP_OK (op) || !GB_JIT_TYPE_OK (op->ztype))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t rcode ;
+    GB_enumify_reduce (&rcode, monoid, A) ;
+
+    // the kernel handles any sparsity structure of A at run time
+    rcode &= ~((uint64_t) 0x3) ;
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_reduce_family,
+        "reduce", rcode, NULL, monoid, NULL, NULL, A->type, NULL) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (s, A, W, F, ntasks, nthreads)) ;
+}
@@ -98,6 +98,9 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
         }
     }
 
+    // C is about to be modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack (C, Context)) ;
+
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
@@ -151,13 +154,25 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     ASSERT (info == GrB_SUCCESS) ;
     ASSERT_SEMIRING_OK (semiring, "semiring for reduce-to-vector", GB0) ;
 
+    //--------------------------------------------------------------------------
+    // get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // reduce the matrix to a vector via C<M> = accum (C, A*B)
     //--------------------------------------------------------------------------
 
-    info = GB_mxm (C, C_replace, M, Mask_comp, Mask_struct, accum,
-        semiring, A, A_transpose, B, false, false, GxB_DEFAULT, do_sort,
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_mxm (C, C_replace, M_view, Mask_comp, Mask_struct, accum,
+            semiring, A_view, A_transpose, B, false, false, GxB_DEFAULT,
+            do_sort, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
     GB_FREE_ALL ;
     return (info) ;
 }
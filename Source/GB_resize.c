@@ -36,6 +36,12 @@ GrB_Info GB_resize              // change the size of a matrix
     GrB_Info info ;
     GB_void *restrict Ax_new = NULL ; size_t Ax_new_size = 0 ;
     int8_t  *restrict Ab_new = NULL ; size_t Ab_new_size = 0 ;
+    info = GB_packed_unpack (A, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory; A is unchanged
+        return (info) ;
+    }
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+// GB_select_bitmap_jit: C=select(A,y), C bitmap, via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_select_jit.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    int8_t *Cb,
+    GB_void *restrict Cx,
+    int64_t *cnvals_handle,
+    GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int nthreads
+) ;
+
+GrB_Info GB_select_bitmap_jit   // C=select(A,y), A bitmap or full, C bitmap
+(
+    int8_t *Cb,
+    GB_void *restrict Cx,
+    int64_t *cnvals_handle,
+    GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GB_Operator op,
+    const int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_select_jit_enumify (&scode, op, flipij, A))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_select_family,
+        "select_bitmap", scode, NULL, NULL, op, NULL, A->type, NULL) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (Cb, Cx, cnvals_handle, A, ythunk, nthreads)) ;
+}
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// GB_select_jit.h: definitions for the CPU JIT kernels for GrB_select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// These methods are used for user-defined GrB_IndexUnaryOps, in place of the
+// GB_sel__idxunop_any workers in Generated1/, which call the operator through
+// its function pointer.  Each returns GrB_NO_VALUE if the JIT cannot handle
+// the problem (the JIT is disabled, A is iso, typecasting is required, the
+// operator or a user-defined type has no definition, or the kernel fails to
+// compile), in which case the caller uses the switch factory instead.
+
+#ifndef GB_SELECT_JIT_H
+#define GB_SELECT_JIT_H
+#include "GB_select.h"
+#include "GB_jitifyer.h"
+
+bool GB_select_jit_enumify  // enumify a select problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GB_Operator op,
+    const bool flipij,
+    const GrB_Matrix A
+) ;
+
+GrB_Info GB_select_phase1_jit   // count entries in each vector of C
+(
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GB_Operator op,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_select_phase2_jit   // select the entries of C
+(
+    int64_t *restrict Ci,
+    GB_void *restrict Cx,
+    const int64_t *restrict Cp,
+    const int64_t *restrict Cp_kfirst,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GB_Operator op,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_select_bitmap_jit   // C=select(A,y), A bitmap or full, C bitmap
+(
+    int8_t *Cb,
+    GB_void *restrict Cx,
+    int64_t *cnvals_handle,
+    GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GB_Operator op,
+    const int nthreads
+) ;
+
+#endif
@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GB_select_jit_enumify: enumify a GrB_select problem for the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Returns true if the JIT can handle the select problem, and the scode of the
+// problem.  The sparsity structure of A is handled by the kernels at run time,
+// and is cleared from the scode.
+
+#include "GB_select_jit.h"
+
+bool GB_select_jit_enumify  // enumify a select problem for the JIT
+(
+    // output:
+    uint64_t *scode,        // enumified problem, with run-time parts cleared
+    // input:
+    const GB_Operator op,
+    const bool flipij,
+    const GrB_Matrix A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check if the JIT can handle this operator
+    //--------------------------------------------------------------------------
+
+    // Only user-defined index unary operators are handled.  The result of
+    // the operator must be bool, and A must not be typecasted.
+
+    if (!GB_jitifyer_control_get ( ) || op == NULL
+        || op->opcode != GB_USER_idxunop_code || A->iso
+        || op->ztype != GrB_BOOL || op->xtype != A->type
+        || !GB_JIT_OP_OK (op) || !GB_JIT_TYPE_OK (op->xtype)
+        || !GB_JIT_TYPE_OK (op->ytype))
+    { 
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the problem
+    //--------------------------------------------------------------------------
+
+    GB_enumify_select (scode, op, flipij, A) ;
+
+    // the kernels handle any sparsity structure of A at run time
+    (*scode) &= ~((uint64_t) 0x3) ;
+    return (true) ;
+}
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// GB_select_phase1_jit: count entries for C=select(A,y) via the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB_select_jit.h"
+
+typedef GrB_Info (*GB_jit_dl_function)
+(
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_select_phase1_jit   // count entries in each vector of C
+(
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const bool flipij,
+    const GB_void *restrict ythunk,
+    const GB_Operator op,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the problem and find its kernel
+    //--------------------------------------------------------------------------
+
+    uint64_t scode ;
+    if (!GB_select_jit_enumify (&scode, op, flipij, A))
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function, GB_jit_select_family,
+        "select_phase1", scode, NULL, NULL, op, NULL, A->type, NULL) ;
+    if (info != GrB_SUCCESS)
+    { 
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // call the kernel
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (Cp, Wfirst, Wlast, A, ythunk, A_ek_slicing,
+        A_ntasks, A_nthreads)) ;
+}
@@ -19,6 +19,7 @@
 #include "GB_select.h"
 #include "GB_ek_slice.h"
 #include "GB_sel__include.h"
+#include "GB_select_jit.h"
 #include "GB_scalar.h"
 #include "GB_transpose.h"
 
@@ -675,9 +676,21 @@ GrB_Info GB_selector
     }                                                                       \
     break ;
 
+    // try the JIT first, for a user-defined index unary operator
+    info = GB_select_phase1_jit (Cp, Wfirst, Wlast, A, flipij, ythunk, op,
+        A_ek_slicing, A_ntasks, A_nthreads) ;
+    bool use_jit = (info != GrB_NO_VALUE) ;
+    if (use_jit)
+    { 
+        GB_BURBLE_MATRIX (A, "(jit select: %s) ", op->name) ;
+    }
+
     // launch the switch factory
     const GB_Type_code typecode = (A_iso) ? GB_ignore_code : acode ;
-    #include "GB_select_factory.c"
+    if (!use_jit)
+    {
+        #include "GB_select_factory.c"
+    }
 
     #undef  GB_SELECT_PHASE1
     #undef  GB_SEL_WORKER
@@ -732,8 +745,19 @@ GrB_Info GB_selector
     }                                                                       \
     break ;
 
+    // use the JIT kernel if phase1 used it
+    if (use_jit)
+    { 
+        info = GB_select_phase2_jit (Ci, Cx, Cp, Cp_kfirst, A, flipij, ythunk,
+            op, A_ek_slicing, A_ntasks, A_nthreads) ;
+        use_jit = (info != GrB_NO_VALUE) ;
+    }
+
     // launch the switch factory
-    #include "GB_select_factory.c"
+    if (!use_jit)
+    {
+        #include "GB_select_factory.c"
+    }
 
     //--------------------------------------------------------------------------
     // create the result
@@ -28,6 +28,7 @@
     GB_serialize_free_blocks (&Ab_Blocks, Ab_Blocks_size, Ab_nblocks, Context);\
     GB_serialize_free_blocks (&Ai_Blocks, Ai_Blocks_size, Ai_nblocks, Context);\
     GB_serialize_free_blocks (&Ax_Blocks, Ax_Blocks_size, Ax_nblocks, Context);\
+    GB_PACKED_VIEW_FREE (A, A_in) ;                                            \
 }
 
 #define GB_FREE_ALL                             \
@@ -48,7 +49,7 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
                                     // GrB_Matrix_serialize_size.
     size_t *blob_size_handle,       // size of the blob
     // input:
-    const GrB_Matrix A,             // matrix to serialize
+    const GrB_Matrix A_in,          // matrix to serialize
     int32_t method,                 // method to use
     GB_Context Context
 )
@@ -59,8 +60,8 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GrB_Matrix A = A_in ;
     ASSERT (blob_size_handle != NULL) ;
-    ASSERT_MATRIX_OK (A, "A for serialize", GB0) ;
 
     //--------------------------------------------------------------------------
     // determine what serialization to do
@@ -109,6 +110,13 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
     int32_t Ai_nblocks = 0      ; size_t Ai_compressed_size = 0 ;
     int32_t Ax_nblocks = 0      ; size_t Ax_compressed_size = 0 ;
 
+    //--------------------------------------------------------------------------
+    // get an unpacked copy of A, if it is packed
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
+    ASSERT_MATRIX_OK (A, "A for serialize", GB0) ;
+
     //--------------------------------------------------------------------------
     // ensure all pending work is finished
     //--------------------------------------------------------------------------
@@ -252,6 +260,7 @@ GrB_Info GB_serialize               // serialize a matrix into a blob
         // GrB_Matrix_serializeSize: this is an upper bound on the required
         // size of the blob, not the actual size.
         (*blob_size_handle) = s ;
+        GB_PACKED_VIEW_FREE (A, A_in) ;
         return (GrB_SUCCESS) ;
     }
 
@@ -89,6 +89,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
             Context)) ;
     }
 
+    // C is modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack (C, Context)) ;
+
     // pending tuples and zombies are expected, and C might be jumbled too
     ASSERT (GB_JUMBLED_OK (C)) ;
     ASSERT (GB_PENDING_OK (C)) ;
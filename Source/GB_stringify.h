@@ -129,6 +129,30 @@ void GB_macrofy_mxm        // construct all macros for GrB_mxm
     GrB_Type btype
 ) ;
 
+//------------------------------------------------------------------------------
+// GrB_select with a user-defined GrB_IndexUnaryOp
+//------------------------------------------------------------------------------
+
+void GB_enumify_select      // enumerate a GrB_select problem
+(
+    // output:
+    uint64_t *scode,        // unique encoding of the entire problem
+    // input:
+    GB_Operator op,         // user-defined index unary operator
+    bool flipij,            // if true, the op is f(x,j,i,y)
+    GrB_Matrix A
+) ;
+
+void GB_macrofy_select      // construct all macros for GrB_select
+(
+    // output:
+    FILE *fp,               // target file to write, already open
+    // input:
+    uint64_t scode,
+    GB_Operator op,         // index unary operator to macrofy
+    GrB_Type atype
+) ;
+
 //------------------------------------------------------------------------------
 // enumify and macrofy the mask matrix M
 //------------------------------------------------------------------------------
@@ -23,13 +23,15 @@
 #include "GB_subassign.h"
 #include "GB_bitmap_assign.h"
 
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_Matrix_free (&C2) ;          \
-    GB_Matrix_free (&M2) ;          \
-    GB_Matrix_free (&A2) ;          \
-    GB_FREE_WORK (&I2, I2_size) ;   \
-    GB_FREE_WORK (&J2, J2_size) ;   \
+#define GB_FREE_ALL                      \
+{                                        \
+    GB_Matrix_free (&C2) ;               \
+    GB_Matrix_free (&M2) ;               \
+    GB_Matrix_free (&A2) ;               \
+    GB_FREE_WORK (&I2, I2_size) ;        \
+    GB_FREE_WORK (&J2, J2_size) ;        \
+    GB_PACKED_VIEW_FREE (M_view, M_in) ; \
+    GB_PACKED_VIEW_FREE (A_view, A_in) ; \
 }
 
 GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
@@ -80,13 +82,19 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     int assign_kind = GB_SUBASSIGN ;
     int subassign_method ;
 
+    // unpack C, and get unpacked copies of any packed inputs
+    GrB_Matrix M_view = M_in, A_view = A_in ;
+    GB_OK (GB_packed_unpack (C_in, Context)) ;
+    GB_OK (GB_packed_view (&M_view, M_in, Context)) ;
+    GB_OK (GB_packed_view (&A_view, A_in, Context)) ;
+
     GB_OK (GB_assign_prep (&C, &M, &A, &subassign_method, &C2, &M2, &A2,
         &C2_header, &M2_header, &A2_header, &MT_header, &AT_header,
         &I, &I2, &I2_size, &ni, &nI, &Ikind, Icolon,
         &J, &J2, &J2_size, &nj, &nJ, &Jkind, Jcolon,
         &atype, C_in, &C_replace, &assign_kind,
-        M_in, Mask_comp, Mask_struct, M_transpose, accum,
-        A_in, A_transpose, Rows, nRows_in, Cols, nCols_in,
+        M_view, Mask_comp, Mask_struct, M_transpose, accum,
+        A_view, A_transpose, Rows, nRows_in, Cols, nCols_in,
         scalar_expansion, scalar, scalar_code, Context)) ;
 
     // GxB_Row_subassign, GxB_Col_subassign, GxB_Matrix_subassign and
@@ -98,6 +106,7 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
         // GB_assign_prep has handled the entire assignment itself
         ASSERT (C == C_in) ;
         ASSERT_MATRIX_OK (C_in, "Final C for subassign", GB0) ;
+        GB_FREE_ALL ;
         return (GrB_SUCCESS) ;
     }
 
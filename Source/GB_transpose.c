@@ -219,6 +219,30 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
 
     size_t csize = ctype->size ;
 
+    //--------------------------------------------------------------------------
+    // C = A->T, if the transpose of A has been cached
+    //--------------------------------------------------------------------------
+
+    if (!in_place && save_op == NULL && ctype == atype)
+    {
+        GrB_Matrix AT = NULL ;
+        GB_OK (GB_transpose_cache_get (&AT, A, Context)) ;
+        if (AT != NULL)
+        { 
+            // C = AT, as a deep copy with the CSR/CSC format of C
+            GBURBLE ("(cached transpose) ") ;
+            GB_phybix_free (C) ;
+            GB_OK (GB_dup_worker (&C, AT->iso, AT, true, NULL, Context)) ;
+            C->is_csc = C_is_csc ;
+            C->hyper_switch = A_hyper_switch ;
+            C->bitmap_switch = A_bitmap_switch ;
+            C->sparsity_control = A_sparsity_control ;
+            ASSERT_MATRIX_OK (C, "C = cached transpose of A", GB0) ;
+            GB_OK (GB_conform (C, Context)) ;
+            return (GrB_SUCCESS) ;
+        }
+    }
+
     ASSERT (GB_IMPLIES (avlen == 0 || avdim == 0, anz == 0)) ;
     GB_iso_code C_code_iso = GB_iso_unop_code (A, op, binop_bind1st) ;
     bool C_iso = (C_code_iso != GB_NON_ISO) ;
@@ -53,6 +53,13 @@ GrB_Info GB_transpose_cast      // C= (ctype) A' or one (A'), not in-place
     GB_Context Context
 ) ;
 
+GrB_Info GB_transpose_cache_get // get the cached transpose of a matrix
+(
+    GrB_Matrix *AT_handle,      // AT = A->T, or NULL if not available
+    GrB_Matrix A,               // matrix to query
+    GB_Context Context
+) ;
+
 GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 (
     GrB_Matrix C,               // output matrix (static header)
@@ -0,0 +1,31 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_free: free the cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Free the cached transpose A->T of a matrix.  This is done whenever A is
+// modified.  The matrix A remains valid, and A->transpose_cache is unchanged,
+// so A->T is reconstructed by GB_transpose_cache_get when A' is next needed.
+
+#include "GB.h"
+
+void GB_transpose_cache_free    // free the cached transpose A->T of a matrix
+(
+    GrB_Matrix A                // matrix with cached transpose to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free A->T
+    //--------------------------------------------------------------------------
+
+    if (A != NULL && A->T != NULL)
+    { 
+        GB_Matrix_free (&(A->T)) ;
+    }
+}
+
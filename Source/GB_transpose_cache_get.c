@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_get: get the cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the user application has enabled the transpose cache of A, with
+// GxB_set (A, GxB_TRANSPOSE_CACHE, true), then A->T = A' is returned as AT,
+// constructing it first if it does not yet exist.  Otherwise, AT is returned
+// as NULL, and the caller must compute A' itself.
+
+// A->T has the same type and the same CSR/CSC format as A, so it is the
+// transpose of A both in the mathematical sense and in its data structure
+// (A->T->vlen is A->vdim and A->T->vdim is A->vlen).  It is never shallow,
+// and it is returned with no pending work and with its A->T->Y hyper_hash
+// built if it is hypersparse.  The caller must not modify AT; it may use AT
+// directly or make a shallow copy of it.
+
+// The cached transpose is not used (or constructed) if A has pending work, or
+// if A is the output of the current user-callable method, since it would
+// become stale as soon as A is modified.  A->T is freed whenever A is
+// modified (see GB_transpose_cache_free).
+
+// If A is held in both formats (GxB_DUAL_FORMAT), A->T is not freed by
+// GrB_Matrix_setElement and GrB_Matrix_removeElement, but updated along with
+// A, so it can have pending work of its own (see GB_dual_setElement).  This
+// work is normally finished by GB_wait (A), but not if A itself has no pending
+// work (if A is bitmap, for example), so it is finished here if needed.
+
+// A->T is constructed as a separate matrix T, from a shallow copy of A (which
+// has no transpose cache of its own, so GB_transpose does not recurse back
+// here), and only then published as A->T, in a critical section.  The options
+// of A are not modified, and A->T is never seen partially constructed.  If
+// two user threads use A as an input at the same time and both construct T,
+// only the first one is kept and the other is freed.  Finishing the pending
+// work of the second format of a dual-format matrix modifies A->T in place,
+// however, so a dual-format matrix that is to be used as an input by multiple
+// user threads at the same time must first be completed with
+// GrB_Matrix_wait (A, GrB_MATERIALIZE), as for any matrix with pending work.
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&T) ;           \
+    GB_Matrix_free (&T2) ;          \
+    GB_Matrix_free (&S) ;           \
+}
+
+#include "GB_transpose.h"
+
+GrB_Info GB_transpose_cache_get // get the cached transpose of a matrix
+(
+    GrB_Matrix *AT_handle,      // AT = A->T, or NULL if not available
+    GrB_Matrix A,               // matrix to query
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL, T2 = NULL ;
+    struct GB_Matrix_opaque S_header ;
+    GrB_Matrix S = NULL ;
+    ASSERT (AT_handle != NULL) ;
+    (*AT_handle) = NULL ;
+
+    if (A == NULL || !A->transpose_cache || Context == NULL
+        || Context->output == A || GB_ANY_PENDING_WORK (A))
+    {
+        // the cached transpose is not available
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A for transpose cache", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // check the existing A->T
+    //--------------------------------------------------------------------------
+
+    #pragma omp critical (GB_transpose_cache)
+    T = A->T ;
+    if (T != NULL && (T->type != A->type || T->is_csc != A->is_csc
+        || T->vlen != A->vdim || T->vdim != A->vlen))
+    {
+        // A->T does not match A; discard it and construct it again
+        GB_Matrix_free (&(A->T)) ;
+    }
+    T = NULL ;
+
+    //--------------------------------------------------------------------------
+    // construct A->T = A', if it does not yet exist
+    //--------------------------------------------------------------------------
+
+    if (A->T == NULL)
+    {
+
+        // allocate the header of T
+        GB_OK (GB_new (&T, // auto sparsity, new header
+            A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc,
+            GxB_AUTO_SPARSITY, A->hyper_switch, 0, Context)) ;
+
+        // T = S', with no typecast, where S is a shallow copy of A.  S has no
+        // transpose cache, so GB_transpose does not recurse.
+        GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+        GB_OK (GB_shallow_copy (S, A->is_csc, A, Context)) ;
+        S->hyper_switch = A->hyper_switch ;
+        S->bitmap_switch = A->bitmap_switch ;
+        S->sparsity_control = A->sparsity_control ;
+        GB_OK (GB_transpose_cast (T, A->type, A->is_csc, S, false, Context)) ;
+        GB_Matrix_free (&S) ;
+
+        // T may be jumbled, or have shallow content if A is a vector
+        if (GB_ANY_PENDING_WORK (T))
+        {
+            GB_OK (GB_wait (T, "T", Context)) ;
+        }
+        if (GB_is_shallow (T))
+        {
+            GB_OK (GB_dup_worker (&T2, T->iso, T, true, NULL, Context)) ;
+            GB_Matrix_free (&T) ;
+            T = T2 ;
+            T2 = NULL ;
+        }
+
+        // construct the hyper_hash of T now, so that T is not modified later
+        GB_OK (GB_hyper_hash_build (T, Context)) ;
+
+        ASSERT_MATRIX_OK (T, "T = A' for transpose cache", GB0) ;
+        ASSERT (!GB_ANY_PENDING_WORK (T)) ;
+        ASSERT (!GB_is_shallow (T)) ;
+
+        // publish T as A->T, unless another thread has already done so
+        #pragma omp critical (GB_transpose_cache)
+        {
+            if (A->T == NULL)
+            { 
+                A->T = T ;
+                T = NULL ;
+            }
+        }
+        GB_Matrix_free (&T) ;
+    }
+    else if (GB_ANY_PENDING_WORK (A->T) || GB_NEED_HYPER_HASH (A->T))
+    {
+        // the second format of a dual-format matrix has been updated
+        ASSERT (A->dual_format) ;
+        info = GB_wait (A->T, "T", Context) ;
+        if (info == GrB_SUCCESS)
+        { 
+            info = GB_hyper_hash_build (A->T, Context) ;
+        }
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_Matrix_free (&(A->T)) ;
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*AT_handle) = A->T ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -27,7 +27,8 @@
 
 #include "GB_transpose.h"
 #ifndef GBCUDA_DEV
-#include "GB_unop__include.h"
+#define GB_FMV_HEADER "GB_unop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 void GB_transpose_ix            // transpose the pattern and values of a matrix
@@ -90,7 +91,7 @@ void GB_transpose_ix            // transpose the pattern and values of a matrix
             //------------------------------------------------------------------
 
             #define GB_unop_tran(zname,aname)                               \
-                GB (_unop_tran__identity ## zname ## aname)
+                GB_FMV (_unop_tran__identity ## zname ## aname)
 
             #define GB_WORKER(ignore1,zname,ztype,aname,atype)              \
             {                                                               \
@@ -36,8 +36,10 @@
 #include "GB_transpose.h"
 #include "GB_binop.h"
 #ifndef GBCUDA_DEV
-#include "GB_unop__include.h"
-#include "GB_binop__include.h"
+#define GB_FMV_HEADER "GB_unop__include.h"
+#include "GB_fmv_include.h"
+#define GB_FMV_HEADER "GB_binop__include.h"
+#include "GB_fmv_include.h"
 #endif
 
 void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
@@ -123,7 +125,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
             //------------------------------------------------------------------
 
             #define GB_unop_tran(opname,zname,aname) \
-                GB (_unop_tran_ ## opname ## zname ## aname)
+                GB_FMV (_unop_tran_ ## opname ## zname ## aname)
 
             #define GB_WORKER(opname,zname,ztype,aname,atype)               \
             {                                                               \
@@ -250,7 +252,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
                 //--------------------------------------------------------------
 
                 #define GB_bind1st_tran(op,xname) \
-                    GB (_bind1st_tran_ ## op ## xname)
+                    GB_FMV (_bind1st_tran_ ## op ## xname)
 
                 #define GB_BINOP_WORKER(op,xname)                           \
                 {                                                           \
@@ -286,7 +288,7 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
                 //--------------------------------------------------------------
 
                 #define GB_bind2nd_tran(op,xname) \
-                    GB (_bind2nd_tran_ ## op ## xname)
+                    GB_FMV (_bind2nd_tran_ ## op ## xname)
                 #undef  GB_BINOP_WORKER
                 #define GB_BINOP_WORKER(op,xname)                           \
                 {                                                           \
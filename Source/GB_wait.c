@@ -35,6 +35,9 @@
 
 // If the method is successful, it does an OpenMP flush just before returning.
 
+// If A is held in both formats (see GxB_DUAL_FORMAT), the work in its second
+// format A->T is finished as well.
+
 #define GB_FREE_WORKSPACE               \
 {                                       \
     GB_Matrix_free (&Y) ;               \
@@ -75,6 +78,33 @@ GrB_Info GB_wait                // finish all pending computations
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_FLIP (GB0)) ;
 
+    //--------------------------------------------------------------------------
+    // finish the work in both formats of a dual-format matrix
+    //--------------------------------------------------------------------------
+
+    if (A->T != NULL)
+    {
+        // A->T is the second format of A (see GxB_DUAL_FORMAT), and may have
+        // its own pending work.  It is removed from A, so that it is not freed
+        // if the content of A is transplanted below, and then put back.
+        GrB_Matrix AT = A->T ;
+        A->T = NULL ;
+        info = GB_wait (A, name, Context) ;
+        if (info == GrB_SUCCESS && GB_ANY_PENDING_WORK (AT))
+        { 
+            info = GB_wait (AT, name, Context) ;
+        }
+        if (info == GrB_SUCCESS && A->T == NULL)
+        { 
+            A->T = AT ;
+        }
+        else
+        { 
+            GB_Matrix_free (&AT) ;
+        }
+        return (info) ;
+    }
+
     if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
     { 
         // full and bitmap matrices never have any pending work
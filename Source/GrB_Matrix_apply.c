@@ -30,7 +30,7 @@ GrB_Info GrB_Matrix_apply           // C<M> = accum (C, op(A)) or op(A')
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (C, "GrB_Matrix_apply (C, M, accum, op, A, desc)") ;
+    GB_WHERE_NO_FLUSH (C, "GrB_Matrix_apply (C, M, accum, op, A, desc)") ;
     GB_BURBLE_START ("GrB_apply (unary op)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_FAULTY (M_in) ;
@@ -43,17 +43,30 @@ GrB_Info GrB_Matrix_apply           // C<M> = accum (C, op(A)) or op(A')
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        C, C_replace,               // C and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(C,T)
-        (GB_Operator) op, NULL, false, // operator op(.) to apply to the entries
-        A, A_transpose,             // A and its descriptor
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            C, C_replace,               // C and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(C,T)
+            (GB_Operator) op, NULL, false, // operator op(.)
+            A_view, A_transpose,        // A and its descriptor
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -93,17 +106,30 @@ static inline GrB_Info GB_1st       // C<M>=accum(C,op(x,A))
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        C, C_replace,               // C and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(C,T)
-        (GB_Operator) op, x, true,  // operator op(x,.) to apply to the entries
-        A, A_transpose,             // A and its descriptor
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            C, C_replace,               // C and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(C,T)
+            (GB_Operator) op, x, true,  // operator op(x,.)
+            A_view, A_transpose,        // A and its descriptor
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -143,17 +169,30 @@ static inline GrB_Info GB_2nd       // C<M>=accum(C,op(A,y))
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // apply the operator and optionally transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        C, C_replace,               // C and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(C,T)
-        op, y, false,               // operator op(.,y) to apply to the entries
-        A, A_transpose,             // A and its descriptor
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            C, C_replace,               // C and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(C,T)
+            op, y, false,               // operator op(.,y)
+            A_view, A_transpose,        // A and its descriptor
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -34,10 +34,12 @@ GrB_Info GrB_Matrix_diag        // construct a diagonal matrix from a vector
 
     GrB_Index n = v->vlen + GB_IABS (k) ;
     GrB_Info info = GB_Matrix_new (C, v->type, n, n, Context) ;
+    GB_PACKED_VIEW (v_view, v) ;
     if (info == GrB_SUCCESS)
     { 
-        info = GB_Matrix_diag (*C, (GrB_Matrix) v, k, Context) ;
+        info = GB_Matrix_diag (*C, v_view, k, Context) ;
     }
+    GB_PACKED_VIEW_FREE (v_view, v) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -32,6 +32,15 @@ GrB_Info GrB_Matrix_dup     // make an exact copy of a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info = GB_dup (C, A, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        // C inherits the settings of A, but not A->T or A->saxpy3_plan
+        (*C)->transpose_cache = A->transpose_cache ;
+        (*C)->dual_format = A->dual_format ;
+        (*C)->bitmap_packed = A->bitmap_packed ;
+        (*C)->index32 = A->index32 ;
+        (*C)->keep_plan = A->keep_plan ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -13,27 +13,45 @@
 #include "GB_get_mask.h"
 
 #define GB_EWISE(op)                                                        \
-    /* check inputs */                                                      \
-    GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
-    GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                       \
-    GB_RETURN_IF_NULL_OR_FAULTY (B) ;                                       \
-    GB_RETURN_IF_FAULTY (M_in) ;                                            \
     /* get the descriptor */                                                \
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,       \
         A_tran, B_tran, xx, xx7) ;                                          \
-    /* get the mask */                                                      \
-    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;           \
-    /* C<M> = accum (C,T) where T = A.*B, A'.*B, A.*B', or A'.*B' */        \
-    info = GB_ewise (                                                       \
-        C,              C_replace,  /* C and its descriptor        */       \
-        M, Mask_comp, Mask_struct,  /* mask and its descriptor     */       \
-        accum,                      /* accumulate operator         */       \
-        op,                         /* operator that defines '.*'  */       \
-        A,              A_tran,     /* A matrix and its descriptor */       \
-        B,              B_tran,     /* B matrix and its descriptor */       \
-        false,                      /* eWiseMult                   */       \
-        false, NULL, NULL,          /* not eWiseUnion              */       \
-        Context) ;
+    /* C<M> = accum (C,A.*B) with packed bitmaps, if possible */            \
+    info = GB_bitmap_packed_ewise (C, C_replace, M_in,                      \
+        Mask_comp, Mask_struct, accum, op, A, A_tran, B, B_tran,            \
+        false, Context) ;                                                   \
+    if (info == GrB_NO_VALUE)                                               \
+    {                                                                       \
+        /* check inputs */                                                  \
+        GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                   \
+        GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                   \
+        GB_RETURN_IF_NULL_OR_FAULTY (B) ;                                   \
+        GB_RETURN_IF_FAULTY (M_in) ;                                        \
+        /* get the mask */                                                  \
+        GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;       \
+        /* C<M> = accum (C,T) where T = A.*B, A'.*B, A.*B', or A'.*B' */    \
+        /* unpack C, and get unpacked copies of any packed inputs */        \
+        info = GB_packed_unpack (C, Context) ;                              \
+        GB_PACKED_VIEW (M_view, M) ;                                        \
+        GB_PACKED_VIEW (A_view, A) ;                                        \
+        GB_PACKED_VIEW (B_view, B) ;                                        \
+        if (info == GrB_SUCCESS)                                            \
+        {                                                                   \
+            info = GB_ewise (                                               \
+                C,              C_replace,  /* C and its descriptor */      \
+                M_view, Mask_comp, Mask_struct, /* mask and descriptor */   \
+                accum,                      /* accumulate operator */       \
+                op,                         /* operator: '.*' */            \
+                A_view,         A_tran,     /* A and its descriptor */      \
+                B_view,         B_tran,     /* B and its descriptor */      \
+                false,                      /* eWiseMult */                 \
+                false, NULL, NULL,          /* not eWiseUnion */            \
+                Context) ;                                                  \
+        }                                                                   \
+        GB_PACKED_VIEW_FREE (M_view, M) ;                                   \
+        GB_PACKED_VIEW_FREE (A_view, A) ;                                   \
+        GB_PACKED_VIEW_FREE (B_view, B) ;                                   \
+    }
 
 //------------------------------------------------------------------------------
 // GrB_Matrix_eWiseMult_BinaryOp: matrix element-wise multiplication
@@ -23,9 +23,10 @@
 // application can ensure that its Ax array has the correct size for any
 // given GrB_Matrix it wishes to export, regardless of its type.
 
-#define GB_FREE_ALL                 \
-{                                   \
-    GB_Matrix_free (&T) ;           \
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_Matrix_free (&T) ;                   \
+    GB_PACKED_VIEW_FREE (A, A_input) ;      \
 }
 
 #include "GB_transpose.h"
@@ -69,6 +70,9 @@ static GrB_Info GB_export_worker  // export a matrix
             GB_RETURN_IF_NULL (Ax) ; GB_RETURN_IF_NULL (Ax_len) ;
     }
 
+    // get an unpacked copy of A, if it is packed
+    GB_OK (GB_packed_view (&A, A_input, Context)) ;
+
     // finish any pending work
     GB_MATRIX_WAIT (A) ;
 
@@ -121,6 +125,7 @@ static GrB_Info GB_export_worker  // export a matrix
 
         default : 
             // unknown format
+            GB_FREE_ALL ;
             return (GrB_INVALID_VALUE) ;
     }
 
@@ -157,13 +157,19 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // C is modified, so unpack it if it is packed
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_packed_unpack (C, Context)) ;
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
     if (C->jumbled || GB_IS_FULL (C))
     {
-        GrB_Info info ;
         if (GB_IS_FULL (C))
         { 
             // convert C from full to sparse
@@ -240,7 +246,6 @@ GrB_Info GB_Matrix_removeElement
     // assemble any pending tuples; zombies are OK
     if (C_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait (C, "C (removeElement:pending tuples)", Context)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_JUMBLED (C)) ;
@@ -263,8 +268,9 @@ GrB_Info GrB_Matrix_removeElement
     GrB_Index col               // column index
 )
 { 
-    GB_WHERE (C, "GrB_Matrix_removeElement (C, row, col)") ;
+    GB_WHERE_ELEMENT (C, "GrB_Matrix_removeElement (C, row, col)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
-    return (GB_Matrix_removeElement (C, row, col, Context)) ;
+    return (GB_dual_setElement (C, true, NULL, row, col, GB_ignore_code,
+        Context)) ;
 }
 
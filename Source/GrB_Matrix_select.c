@@ -46,19 +46,32 @@ static inline GrB_Info GB_sel   // C<M> = accum (C, select(A,k)) or select(A',k)
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // select the entries and optionally transpose; assemble pending tuples
     //--------------------------------------------------------------------------
 
-    info = GB_select (
-        C, C_replace,               // C and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(C,T)
-        (GB_Operator) op,           // operator to select the entries
-        A,                          // first input: A
-        Thunk,                      // optional input for select operator
-        A_transpose,                // descriptor for A
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_select (
+            C, C_replace,               // C and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(C,T)
+            (GB_Operator) op,           // operator to select the entries
+            A_view,                     // first input: A
+            Thunk,                      // optional input for select operator
+            A_transpose,                // descriptor for A
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -22,10 +22,10 @@ GrB_Info GB_EVAL3 (prefix, _Matrix_setElement_, T) /* C (row,col) = x */    \
     GrB_Index col                       /* column index                   */\
 )                                                                           \
 {                                                                           \
-    GB_WHERE (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)             \
+    GB_WHERE_ELEMENT (C, GB_STR(prefix) "_Matrix_setElement_" GB_STR(T)     \
         " (C, row, col, x)") ;                                              \
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
-    return (GB_setElement (C, NULL, ampersand x, row, col,                  \
+    return (GB_dual_setElement (C, false, ampersand x, row, col,            \
         GB_ ## T ## _code, Context)) ;                                      \
 }
 
@@ -65,7 +65,7 @@ GrB_Info GrB_Matrix_setElement_Scalar
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (C, "GrB_Matrix_setElement_Scalar (C, x, row, col)") ;
+    GB_WHERE_ELEMENT (C, "GrB_Matrix_setElement_Scalar (C, x, row, col)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_NULL_OR_FAULTY (scalar) ;
 
@@ -78,13 +78,14 @@ GrB_Info GrB_Matrix_setElement_Scalar
     if (GB_nnz ((GrB_Matrix) scalar) > 0)
     { 
         // set the element: C(row,col) = scalar
-        return (GB_setElement (C, NULL, scalar->x, row, col,
+        return (GB_dual_setElement (C, false, scalar->x, row, col,
             scalar->type->code, Context)) ;
     }
     else
     { 
         // delete the C(row,col) element
-        return (GB_Matrix_removeElement (C, row, col, Context)) ;
+        return (GB_dual_setElement (C, true, NULL, row, col, GB_ignore_code,
+            Context)) ;
     }
 }
 
@@ -7,9 +7,19 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a matrix, followed by an OpenMP flush.
+// Finishes all work on a matrix, followed by an OpenMP flush.  If the
+// transpose cache of A is enabled, GrB_MATERIALIZE also constructs A->T, or
+// finishes its pending work if A is held in both formats.
 
-#include "GB.h"
+// If A->bitmap_packed is true and A is bitmap, GrB_COMPLETE packs A->b into
+// bits (see GB_bitmap_pack).  Likewise, if A->index32 is true and A is sparse
+// or hypersparse, GrB_COMPLETE finishes any pending work and then narrows
+// A->p, A->h, and A->i to int32_t (see GB_index32_pack), if A is small enough.
+// A packed matrix has no pending work, so both modes return it as-is, still
+// packed.  It is not modified when used as an input, so it can be shared by
+// multiple user threads (see GB_packed_view).
+
+#include "GB_transpose.h"
 
 #define GB_FREE_ALL ;
 
@@ -24,8 +34,14 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (A, "GrB_Matrix_wait (A, waitmode)") ;
+    GB_WHERE_KEEP (A, "GrB_Matrix_wait (A, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    if (A->magic == GB_MAGIC_PACKED)
+    { 
+        // a packed matrix has no pending work, and is left packed
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // finish all pending work on the matrix, including creating A->Y
@@ -41,6 +57,54 @@ GrB_Info GrB_Matrix_wait    // finish all work on a matrix
         GB_BURBLE_END ;
     }
 
+    //--------------------------------------------------------------------------
+    // construct the cached transpose A->T, if enabled
+    //--------------------------------------------------------------------------
+
+    if (waitmode != GrB_COMPLETE && A->transpose_cache && (A->T == NULL
+        || GB_ANY_PENDING_WORK (A->T) || GB_NEED_HYPER_HASH (A->T)))
+    {
+        // construct A->T, or finish the pending work in the second format
+        // of a dual-format matrix
+        GrB_Info info ;
+        GrB_Matrix AT = NULL ;
+        GB_BURBLE_START ("GrB_Matrix_wait") ;
+        GB_OK (GB_transpose_cache_get (&AT, A, Context)) ;
+        GB_BURBLE_END ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap, if enabled
+    //--------------------------------------------------------------------------
+
+    if (waitmode == GrB_COMPLETE && A->bitmap_packed && GB_IS_BITMAP (A))
+    {
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Matrix_wait") ;
+        GB_OK (GB_bitmap_pack (A, Context)) ;
+        GB_BURBLE_END ;
+    }
+
+    //--------------------------------------------------------------------------
+    // narrow the indices to 32 bits, if enabled
+    //--------------------------------------------------------------------------
+
+    if (waitmode == GrB_COMPLETE && A->index32 && !GB_IS_BITMAP (A)
+        && !GB_IS_FULL (A))
+    {
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Matrix_wait") ;
+        GB_OK (GB_wait (A, "matrix", Context)) ;
+        if (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        { 
+            if (GB_INDEX32_OK (A))
+            { 
+                GB_OK (GB_index32_pack (A, Context)) ;
+            }
+        }
+        GB_BURBLE_END ;
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
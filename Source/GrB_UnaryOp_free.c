@@ -14,6 +14,8 @@ GrB_Info GrB_UnaryOp_free           // free a user-created unary operator
     GrB_UnaryOp *op                 // handle of unary operator to free
 )
 { 
+    // finish any deferred work that uses the operator
+    GB_deferred_flush ( ) ;
     return (GB_Op_free ((GB_Operator *) op)) ;
 }
 
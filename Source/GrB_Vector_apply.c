@@ -30,7 +30,7 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
     // check inputs
     //--------------------------------------------------------------------------
 
-    GB_WHERE (w, "GrB_Vector_apply (w, M, accum, op, u, desc)") ;
+    GB_WHERE_NO_FLUSH (w, "GrB_Vector_apply (w, M, accum, op, u, desc)") ;
     GB_BURBLE_START ("GrB_apply") ;
     GB_RETURN_IF_NULL_OR_FAULTY (w) ;
     GB_RETURN_IF_FAULTY (M_in) ;
@@ -47,17 +47,30 @@ GrB_Info GrB_Vector_apply           // w<M> = accum (w, op(u))
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        (GrB_Matrix) w, C_replace,  // w and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(w,T)
-        (GB_Operator) op, NULL, false, // operator op(.) to apply to the entries
-        (GrB_Matrix) u, false,      // u, not transposed
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            (GrB_Matrix) w, C_replace,  // w and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(w,T)
+            (GB_Operator) op, NULL, false, // operator op(.)
+            u_view, false,              // u, not transposed
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (u_view, u) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -101,17 +114,30 @@ static inline GrB_Info GB_1st       // w<mask> = accum (w, op(x,u))
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        (GrB_Matrix) w, C_replace,  // w and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(w,T)
-        (GB_Operator) op, x, true,  // operator op(x,.) to apply to the entries
-        (GrB_Matrix) u,  false,     // u, not transposed
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            (GrB_Matrix) w, C_replace,  // w and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(w,T)
+            (GB_Operator) op, x, true,  // operator op(x,.)
+            u_view,  false,             // u, not transposed
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (u_view, u) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -155,17 +181,30 @@ static inline GrB_Info GB_2nd       // w<mask> = accum (w, op(u,y))
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // apply the operator; do not transpose
     //--------------------------------------------------------------------------
 
-    info = GB_apply (
-        (GrB_Matrix) w, C_replace,  // w and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(w,T)
-        op, y, false,               // operator op(.,y) to apply to the entries
-        (GrB_Matrix) u, false,      // u, not transposed
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_apply (
+            (GrB_Matrix) w, C_replace,  // w and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(w,T)
+            op, y, false,               // operator op(.,y)
+            u_view, false,              // u, not transposed
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (u_view, u) ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -33,6 +33,12 @@ GrB_Info GrB_Vector_dup     // make an exact copy of a vector
     //--------------------------------------------------------------------------
 
     GrB_Info info = GB_dup ((GrB_Matrix *) w, (GrB_Matrix) u, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        // w inherits the packed bitmap setting of u
+        (*w)->bitmap_packed = u->bitmap_packed ;
+        (*w)->index32 = u->index32 ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
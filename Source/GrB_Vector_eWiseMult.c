@@ -13,31 +13,50 @@
 #include "GB_get_mask.h"
 
 #define GB_EWISE(op)                                                        \
-    /* check inputs */                                                      \
-    GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                       \
-    GB_RETURN_IF_NULL_OR_FAULTY (u) ;                                       \
-    GB_RETURN_IF_NULL_OR_FAULTY (v) ;                                       \
-    GB_RETURN_IF_FAULTY (M_in) ;                                            \
-    ASSERT (GB_VECTOR_OK (w)) ;                                             \
-    ASSERT (GB_VECTOR_OK (u)) ;                                             \
-    ASSERT (GB_VECTOR_OK (v)) ;                                             \
-    ASSERT (M_in == NULL || GB_VECTOR_OK (M_in)) ;                          \
     /* get the descriptor */                                                \
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,       \
         xx1, xx2, xx3, xx7) ;                                               \
-    /* get the mask */                                                      \
-    GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;\
-    /* w<M> = accum (w,t) where t = u.*v, u'.*v, u.*v', or u'.*v' */        \
-    info = GB_ewise (                                                       \
-        (GrB_Matrix) w, C_replace,  /* w and its descriptor        */       \
-        M, Mask_comp, Mask_struct,  /* mask and descriptor */               \
-        accum,                      /* accumulate operator         */       \
-        op,                         /* operator that defines '.*'  */       \
-        (GrB_Matrix) u, false,      /* u, never transposed         */       \
-        (GrB_Matrix) v, false,      /* v, never transposed         */       \
-        false,                      /* eWiseMult                   */       \
-        false, NULL, NULL,          /* not eWiseUnion              */       \
-        Context) ;
+    /* w<M> = accum (w,u.*v) with packed bitmaps, if possible */            \
+    info = GB_bitmap_packed_ewise ((GrB_Matrix) w, C_replace,               \
+        (GrB_Matrix) M_in, Mask_comp, Mask_struct, accum, op,               \
+        (GrB_Matrix) u, false, (GrB_Matrix) v, false, false, Context) ;     \
+    if (info == GrB_NO_VALUE)                                               \
+    {                                                                       \
+        /* check inputs */                                                  \
+        GB_RETURN_IF_NULL_OR_FAULTY (w) ;                                   \
+        GB_RETURN_IF_NULL_OR_FAULTY (u) ;                                   \
+        GB_RETURN_IF_NULL_OR_FAULTY (v) ;                                   \
+        GB_RETURN_IF_FAULTY (M_in) ;                                        \
+        ASSERT (GB_VECTOR_OK (w)) ;                                         \
+        ASSERT (GB_VECTOR_OK (u)) ;                                         \
+        ASSERT (GB_VECTOR_OK (v)) ;                                         \
+        ASSERT (M_in == NULL || GB_VECTOR_OK (M_in)) ;                      \
+        /* get the mask */                                                  \
+        GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp,          \
+            &Mask_struct) ;                                                 \
+        /* w<M> = accum (w,t) where t = u.*v, u'.*v, u.*v', or u'.*v' */    \
+        /* unpack w, and get unpacked copies of any packed inputs */        \
+        info = GB_packed_unpack ((GrB_Matrix) w, Context) ;                 \
+        GB_PACKED_VIEW (M_view, M) ;                                        \
+        GB_PACKED_VIEW (u_view, u) ;                                        \
+        GB_PACKED_VIEW (v_view, v) ;                                        \
+        if (info == GrB_SUCCESS)                                            \
+        {                                                                   \
+            info = GB_ewise (                                               \
+                (GrB_Matrix) w, C_replace,  /* w and its descriptor */      \
+                M_view, Mask_comp, Mask_struct, /* mask and descriptor */   \
+                accum,                      /* accumulate operator */       \
+                op,                         /* operator: '.*' */            \
+                u_view,         false,      /* u, never transposed */       \
+                v_view,         false,      /* v, never transposed */       \
+                false,                      /* eWiseMult */                 \
+                false, NULL, NULL,          /* not eWiseUnion */            \
+                Context) ;                                                  \
+        }                                                                   \
+        GB_PACKED_VIEW_FREE (M_view, M) ;                                   \
+        GB_PACKED_VIEW_FREE (u_view, u) ;                                   \
+        GB_PACKED_VIEW_FREE (v_view, v) ;                                   \
+    }
 
 //------------------------------------------------------------------------------
 // GrB_Vector_eWiseMult_BinaryOp: vector element-wise multiplication
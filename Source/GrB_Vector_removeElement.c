@@ -110,13 +110,19 @@ GrB_Info GB_Vector_removeElement
 )
 {
 
+    //--------------------------------------------------------------------------
+    // V is modified, so unpack it if it is packed
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_OK (GB_packed_unpack ((GrB_Matrix) V, Context)) ;
+
     //--------------------------------------------------------------------------
     // if V is jumbled, wait on the vector first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
 
     if (V->jumbled || GB_IS_FULL (V))
     {
-        GrB_Info info ;
         if (GB_IS_FULL (V))
         { 
             // convert V from full to sparse
@@ -170,7 +176,6 @@ GrB_Info GB_Vector_removeElement
     // assemble any pending tuples; zombies are OK
     if (V_is_pending)
     { 
-        GrB_Info info ;
         GB_OK (GB_wait ((GrB_Matrix) V, "v (removeElement:pending tuples)",
             Context)) ;
         ASSERT (!GB_ZOMBIES (V)) ;
@@ -44,19 +44,32 @@ static inline GrB_Info GB_sel   // w<M> = accum (w, select(w,k))
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // select the entries and optionally transpose; assemble pending tuples
     //--------------------------------------------------------------------------
 
-    info = GB_select (
-        (GrB_Matrix) w, C_replace,  // w and its descriptor
-        M, Mask_comp, Mask_struct,  // mask and its descriptor
-        accum,                      // optional accum for Z=accum(w,T)
-        (GB_Operator) op,           // operator to select the entries
-        (GrB_Matrix) u,             // first input: u
-        Thunk,                      // optional input for select operator
-        false,                      // vector u is never transposed
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_select (
+            (GrB_Matrix) w, C_replace,  // w and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask and its descriptor
+            accum,                      // optional accum for Z=accum(w,T)
+            (GB_Operator) op,           // operator to select the entries
+            u_view,                     // first input: u
+            Thunk,                      // optional input for select operator
+            false,                      // vector u is never transposed
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (u_view, u) ;
 
     GB_BURBLE_END ;
     return (info) ;
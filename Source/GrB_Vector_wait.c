@@ -7,7 +7,11 @@
 
 //------------------------------------------------------------------------------
 
-// Finishes all work on a vector, followed by an OpenMP flush.
+// Finishes all work on a vector, followed by an OpenMP flush.  If the vector
+// is bitmap and its GxB_BITMAP_PACKED option is true, GrB_COMPLETE packs its
+// bitmap into bits (see GrB_Matrix_wait).  If the vector is sparse and its
+// GxB_INDEX_32 option is true, GrB_COMPLETE finishes any pending work and
+// narrows its indices to int32_t.
 
 #include "GB.h"
 
@@ -26,6 +30,12 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
 
     GB_WHERE (v, "GrB_Vector_wait (v, waitmode)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    if (v->magic == GB_MAGIC_PACKED)
+    { 
+        // a packed vector has no pending work, and is left packed
+        #pragma omp flush
+        return (GrB_SUCCESS) ;
+    }
 
     //--------------------------------------------------------------------------
     // finish all pending work on the vector
@@ -39,6 +49,34 @@ GrB_Info GrB_Vector_wait    // finish all work on a vector
         GB_BURBLE_END ;
     }
 
+    //--------------------------------------------------------------------------
+    // pack the bitmap, if enabled
+    //--------------------------------------------------------------------------
+
+    if (waitmode == GrB_COMPLETE && v->bitmap_packed && GB_IS_BITMAP (v))
+    {
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Vector_wait") ;
+        GB_OK (GB_bitmap_pack ((GrB_Matrix) v, Context)) ;
+        GB_BURBLE_END ;
+    }
+
+    //--------------------------------------------------------------------------
+    // narrow the indices to 32 bits, if enabled
+    //--------------------------------------------------------------------------
+
+    if (waitmode == GrB_COMPLETE && v->index32 && GB_IS_SPARSE (v))
+    {
+        GrB_Info info ;
+        GB_BURBLE_START ("GrB_Vector_wait") ;
+        GB_OK (GB_wait ((GrB_Matrix) v, "vector", Context)) ;
+        if (GB_IS_SPARSE (v) && GB_INDEX32_OK (v))
+        { 
+            GB_OK (GB_index32_pack ((GrB_Matrix) v, Context)) ;
+        }
+        GB_BURBLE_END ;
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
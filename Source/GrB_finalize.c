@@ -13,9 +13,14 @@
 // same time.
 
 #include "GB.h"
+#include "GB_jitifyer.h"
 
 GrB_Info GrB_finalize ( )
 { 
+    // finish any work deferred by this thread
+    GB_deferred_flush ( ) ;
+    // unload all CPU JIT kernels
+    GB_jitifyer_finalize ( ) ;
     // free all memory pools
     GB_free_pool_finalize ( ) ;
     return (GrB_SUCCESS) ;
@@ -46,22 +46,37 @@ GrB_Info GrB_mxm                    // C<M> = accum (C, A*B)
     // get the mask
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+    GB_PACKED_VIEW (B_view, B) ;
+
     //--------------------------------------------------------------------------
     // C<M> = accum (C,A*B) and variations, using the mxm kernel
     //--------------------------------------------------------------------------
 
-    // C<M> = accum (C,T) where T = A*B, A'*B, A*B', or A'*B'
-    info = GB_mxm (
-        C,          C_replace,      // C matrix and its descriptor
-        M, Mask_comp, Mask_struct,  // mask matrix and its descriptor
-        accum,                      // for accum (C,T)
-        semiring,                   // semiring that defines T=A*B
-        A,          A_transpose,    // A matrix and its descriptor
-        B,          B_transpose,    // B matrix and its descriptor
-        false,                      // use fmult(x,y), flipxy = false
-        AxB_method, do_sort,        // algorithm selector
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        // C<M> = accum (C,T) where T = A*B, A'*B, A*B', or A'*B'
+        info = GB_mxm (
+            C,          C_replace,      // C matrix and its descriptor
+            M_view, Mask_comp, Mask_struct, // mask matrix and its descriptor
+            accum,                      // for accum (C,T)
+            semiring,                   // semiring that defines T=A*B
+            A_view,     A_transpose,    // A matrix and its descriptor
+            B_view,     B_transpose,    // B matrix and its descriptor
+            false,                      // use fmult(x,y), flipxy = false
+            AxB_method, do_sort,        // algorithm selector
+            Context) ;
+    }
 
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
+    GB_PACKED_VIEW_FREE (B_view, B) ;
     GB_BURBLE_END ;
     return (info) ;
 }
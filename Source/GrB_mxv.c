@@ -49,22 +49,37 @@ GrB_Info GrB_mxv                    // w<M> = accum (w, A*u)
     // get the mask
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // w<M> = accum (w,A*u) and variations, using the mxm kernel
     //--------------------------------------------------------------------------
 
-    // w, M, and u are passed as matrices to GB_mxm.
-    info = GB_mxm (
-        (GrB_Matrix) w,     C_replace,      // w and its descriptor
-        M, Mask_comp, Mask_struct,          // mask and its descriptor
-        accum,                              // for accum (w,t)
-        semiring,                           // definition of matrix multiply
-        A,                  A_transpose,    // allow A to be transposed
-        (GrB_Matrix) u,     false,          // u is never transposed
-        false,                              // fmult(x,y), flipxy = false
-        AxB_method, do_sort,                // algorithm selector
-        Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        // w, M, and u are passed as matrices to GB_mxm.
+        info = GB_mxm (
+            (GrB_Matrix) w,     C_replace,      // w and its descriptor
+            M_view, Mask_comp, Mask_struct,     // mask and its descriptor
+            accum,                              // for accum (w,t)
+            semiring,                           // semiring for w=A*u
+            A_view,             A_transpose,    // allow A to be transposed
+            u_view,             false,          // u is never transposed
+            false,                              // fmult(x,y), flipxy = false
+            AxB_method, do_sort,                // algorithm selector
+            Context) ;
+    }
 
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
+    GB_PACKED_VIEW_FREE (u_view, u) ;
     GB_BURBLE_END ;
     return (info) ;
 }
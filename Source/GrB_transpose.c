@@ -9,7 +9,12 @@
 
 // C<M> = accum (C,A') or accum (C,A)
 
-#define GB_FREE_ALL GB_Matrix_free (&T) ;
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_Matrix_free (&T) ;               \
+    GB_PACKED_VIEW_FREE (M, M_in) ;     \
+    GB_PACKED_VIEW_FREE (A, A_in) ;     \
+}
 
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
@@ -20,7 +25,7 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     GrB_Matrix C,                   // input/output matrix for results
     const GrB_Matrix M_in,          // optional mask for C, unused if NULL
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 {
@@ -30,7 +35,7 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     //--------------------------------------------------------------------------
 
     struct GB_Matrix_opaque T_header ;
-    GrB_Matrix T = NULL ;
+    GrB_Matrix T = NULL, M = NULL, A = A_in ;
 
     // C may be aliased with M and/or A
 
@@ -41,17 +46,18 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
 
-    ASSERT_MATRIX_OK (C, "C input for GrB_transpose", GB0) ;
-    ASSERT_MATRIX_OK_OR_NULL (M_in, "M for GrB_transpose", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GrB_transpose", GB0) ;
-    ASSERT_MATRIX_OK (A, "A input for GrB_transpose", GB0) ;
 
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
         A_transpose, xx1, xx2, xx7) ;
 
     // get the mask
-    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+    M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    // C is about to be modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack (C, Context)) ;
+    ASSERT_MATRIX_OK (C, "C input for GrB_transpose", GB0) ;
 
     // check domains and dimensions for C<M> = accum (C,T)
     GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, A->type, Context));
@@ -72,6 +78,12 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    // get unpacked copies of any packed inputs
+    GB_OK (GB_packed_view (&M, M, Context)) ;
+    GB_OK (GB_packed_view (&A, A_in, Context)) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GrB_transpose", GB0) ;
+    ASSERT_MATRIX_OK (A, "A input for GrB_transpose", GB0) ;
+
     //--------------------------------------------------------------------------
     // T = A or A', where T can have the type of C or the type of A
     //--------------------------------------------------------------------------
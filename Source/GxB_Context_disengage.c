@@ -0,0 +1,43 @@
+//------------------------------------------------------------------------------
+// GxB_Context_disengage: disengage a Context for the calling user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Subsequent GraphBLAS methods called by this user thread use the global
+// settings.  If Context is NULL, any Context engaged by this thread is
+// disengaged.  Otherwise, it must be the Context engaged by this thread.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_disengage      // disengage a Context for this thread
+(
+    GxB_Context Context_disengage   // Context to disengage, or NULL for any
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_disengage (Context)") ;
+    if (Context_disengage != NULL)
+    {
+        GB_RETURN_IF_FAULTY (Context_disengage) ;
+        if (Context_disengage != GB_Context_engaged ( ))
+        { 
+            // this thread has not engaged this Context
+            return (GrB_INVALID_VALUE) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // disengage the Context
+    //--------------------------------------------------------------------------
+
+    GB_Context_engaged_set (NULL) ;
+    return (GrB_SUCCESS) ;
+}
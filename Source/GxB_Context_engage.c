@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GxB_Context_engage: engage a Context for the calling user thread
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// All subsequent GraphBLAS methods called by this user thread use the settings
+// in the Context, until it is disengaged.  Any Context already engaged by this
+// thread is replaced.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_engage         // engage a Context for this thread
+(
+    GxB_Context Context_engage      // Context to engage
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_engage (Context)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context_engage) ;
+
+    //--------------------------------------------------------------------------
+    // engage the Context
+    //--------------------------------------------------------------------------
+
+    return (GB_Context_engaged_set (Context_engage) ?
+        GrB_SUCCESS : GrB_NOT_IMPLEMENTED) ;
+}
@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// GxB_Context_fprint: print and check a GxB_Context object
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Context_fprint         // print and check a GxB_Context
+(
+    GxB_Context Context_print,      // object to print and check
+    const char *name,               // name of the object
+    GxB_Print_Level pr,             // print level
+    FILE *f                         // file for output
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_fprint (Context, name, pr, f)") ;
+
+    //--------------------------------------------------------------------------
+    // print and check the object
+    //--------------------------------------------------------------------------
+
+    return (GB_Context_check (Context_print, name, pr, f)) ;
+}
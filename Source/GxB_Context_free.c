@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GxB_Context_free: free a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If the Context is engaged by the calling thread, it is first disengaged.  A
+// Context must not be freed while it is engaged by any other user thread.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_free           // free a Context
+(
+    GxB_Context *Context_handle     // handle of Context to free
+)
+{
+
+    if (Context_handle != NULL)
+    {
+        GxB_Context Context_free = *Context_handle ;
+        if (Context_free != NULL)
+        {
+            if (GB_Context_engaged ( ) == Context_free)
+            { 
+                GB_Context_engaged_set (NULL) ;
+            }
+            size_t header_size = Context_free->header_size ;
+            if (header_size > 0)
+            { 
+                Context_free->magic = GB_FREED ;  // to detect dangling pointers
+                Context_free->header_size = 0 ;
+                GB_FREE (Context_handle, header_size) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
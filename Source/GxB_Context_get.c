@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+// GxB_Context_get: get a field in a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+
+GrB_Info GxB_Context_get            // get a parameter from a Context
+(
+    GxB_Context Context_get,        // Context to query
+    GxB_Context_Field field,        // parameter to query
+    ...                             // return value of the parameter
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_get (Context, field, &value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context_get) ;
+
+    //--------------------------------------------------------------------------
+    // get the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_NTHREADS :     // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                int *nthreads_max = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (nthreads_max) ;
+                (*nthreads_max) = Context_get->nthreads_max ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CHUNK :        // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                double *chunk = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (chunk) ;
+                (*chunk) = Context_get->chunk ;
+            }
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GxB_Context_new: create a new Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Default values are set to GxB_DEFAULT, so that the global settings are used.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_new            // create a new Context
+(
+    GxB_Context *Context_handle     // handle of Context to create
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_new (&Context)") ;
+    GB_RETURN_IF_NULL (Context_handle) ;
+    (*Context_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the Context
+    //--------------------------------------------------------------------------
+
+    // allocate the Context
+    size_t header_size ;
+    (*Context_handle) = GB_MALLOC (1, struct GB_Context_opaque, &header_size) ;
+    if (*Context_handle == NULL)
+    { 
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    // initialize the Context
+    GxB_Context Context_new = *Context_handle ;
+    Context_new->magic = GB_MAGIC ;
+    Context_new->header_size = header_size ;
+    Context_new->nthreads_max = GxB_DEFAULT ;   // max # of threads to use
+    Context_new->chunk = GxB_DEFAULT ;          // chunk for # of threads
+    return (GrB_SUCCESS) ;
+}
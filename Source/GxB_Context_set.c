@@ -0,0 +1,63 @@
+//------------------------------------------------------------------------------
+// GxB_Context_set: set a field in a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The new settings take effect for the next GraphBLAS method called by any user
+// thread that has engaged this Context.
+
+#include "GB.h"
+
+GrB_Info GxB_Context_set            // set a parameter in a Context
+(
+    GxB_Context Context_set,        // Context to modify
+    GxB_Context_Field field,        // parameter to change
+    ...                             // value to change it to
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_set (Context, field, value)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context_set) ;
+
+    //--------------------------------------------------------------------------
+    // set the parameter
+    //--------------------------------------------------------------------------
+
+    va_list ap ;
+
+    switch (field)
+    {
+
+        case GxB_CONTEXT_NTHREADS :     // same as GxB_NTHREADS
+
+            {
+                va_start (ap, field) ;
+                Context_set->nthreads_max = va_arg (ap, int) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        case GxB_CONTEXT_CHUNK :        // same as GxB_CHUNK
+
+            {
+                va_start (ap, field) ;
+                Context_set->chunk = va_arg (ap, double) ;
+                va_end (ap) ;
+            }
+            break ;
+
+        default : 
+
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
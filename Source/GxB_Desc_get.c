@@ -99,6 +99,18 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_DESCRIPTOR_MEMORY_BUDGET : // same as GxB_MEMORY_BUDGET
+
+            {
+                va_start (ap, field) ;
+                double *memory_budget = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_budget) ;
+                (*memory_budget) = (desc == NULL) ? GxB_DEFAULT :
+                    desc->memory_budget ;
+            }
+            break ;
+
         case GxB_AxB_METHOD : 
 
             {
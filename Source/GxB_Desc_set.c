@@ -32,7 +32,7 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
         return (GrB_INVALID_VALUE) ;
     }
 
-    GB_WHERE (desc, "GxB_Desc_set (desc, field, value)") ;
+    GB_WHERE_KEEP (desc, "GxB_Desc_set (desc, field, value)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (desc) ;
     ASSERT_DESCRIPTOR_OK (desc, "desc to set", GB0) ;
 
@@ -144,6 +144,15 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_DESCRIPTOR_MEMORY_BUDGET : // same as GxB_MEMORY_BUDGET
+
+            {
+                va_start (ap, field) ;
+                desc->memory_budget = va_arg (ap, double) ;
+                va_end (ap) ;
+            }
+            break ;
+
         case GxB_AxB_METHOD : 
 
             {
@@ -204,10 +213,12 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]\n"
                 "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d]\n"
-                "GxB_SORT [%d], or GxB_COMPRESSION [%d]\n",
+                "GxB_SORT [%d], GxB_COMPRESSION [%d], or"
+                " GxB_MEMORY_BUDGET [%d]\n",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK,
-                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION) ;
+                (int) GxB_AxB_METHOD, (int) GxB_SORT, (int) GxB_COMPRESSION,
+                (int) GxB_MEMORY_BUDGET) ;
     }
 
     return (GrB_SUCCESS) ;
@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB.h"
+#include "GB_jitifyer.h"
 
 GrB_Info GxB_Global_Option_get      // gets the current global option
 (
@@ -73,6 +74,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                bool *index32 = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (index32) ;
+                (*index32) = GB_Global_index32_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // mode from GrB_init (blocking or non-blocking)
         //----------------------------------------------------------------------
@@ -118,6 +130,21 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // memory budget for C=A*B
+        //----------------------------------------------------------------------
+
+        case GxB_GLOBAL_MEMORY_BUDGET : // same as GxB_MEMORY_BUDGET
+
+            {
+                va_start (ap, field) ;
+                double *memory_budget = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_budget) ;
+                (*memory_budget) = GB_Global_memory_budget_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // memory pool control
         //----------------------------------------------------------------------
@@ -136,6 +163,61 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_MEMORY_POOL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *stats = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                GB_Global_free_pool_stats (&(stats [0]), &(stats [1]),
+                    &(stats [2]), &(stats [3])) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // placement of large blocks of memory
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                GxB_Memory_Policy_Value *memory_policy =
+                    va_arg (ap, GxB_Memory_Policy_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (memory_policy) ;
+                (*memory_policy) =
+                    (GxB_Memory_Policy_Value) GB_Global_memory_policy_get ( ) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGE_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *huge_page_threshold = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (huge_page_threshold) ;
+                (*huge_page_threshold) = GB_Global_huge_page_threshold_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // push/pull statistics for GrB_mxv and GrB_vxm
+        //----------------------------------------------------------------------
+
+        case GxB_PUSHPULL_STATS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *stats = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (stats) ;
+                GB_Global_pushpull_stats_get (&(stats [0]), &(stats [1])) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, date, license, etc
         //----------------------------------------------------------------------
@@ -356,6 +438,98 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // CPU JIT
+        //----------------------------------------------------------------------
+
+        case GxB_JIT_C_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                bool *jit_control = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (jit_control) ;
+                (*jit_control) = GB_jitifyer_control_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_C_COMPILER_NAME : 
+
+            {
+                va_start (ap, field) ;
+                char **compiler = va_arg (ap, char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (compiler) ;
+                (*compiler) = (char *) GB_jitifyer_compiler_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_C_COMPILER_FLAGS : 
+
+            {
+                va_start (ap, field) ;
+                char **flags = va_arg (ap, char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (flags) ;
+                (*flags) = (char *) GB_jitifyer_flags_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_PATH : 
+
+            {
+                va_start (ap, field) ;
+                char **cache_path = va_arg (ap, char **) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (cache_path) ;
+                (*cache_path) = (char *) GB_jitifyer_cache_path_get ( ) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_HITS : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *hits = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (hits) ;
+                GB_jitifyer_stats_get (hits, NULL, NULL) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_MISSES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *misses = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (misses) ;
+                GB_jitifyer_stats_get (NULL, misses, NULL) ;
+            }
+            break ;
+
+        case GxB_JIT_COMPILE_TIME : 
+
+            {
+                va_start (ap, field) ;
+                double *compile_time = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (compile_time) ;
+                GB_jitifyer_stats_get (NULL, NULL, compile_time) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_BYTES : 
+
+            {
+                va_start (ap, field) ;
+                int64_t *bytes = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bytes) ;
+                (*bytes) = GB_jitifyer_cache_bytes ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
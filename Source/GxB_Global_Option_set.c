@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB.h"
+#include "GB_jitifyer.h"
 
 GrB_Info GxB_Global_Option_set      // set a global default option
 (
@@ -81,6 +82,16 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                int index32 = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_Global_index32_set ((bool) index32) ; 
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // OpenMP control
         //----------------------------------------------------------------------
@@ -107,6 +118,20 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // memory budget for C=A*B
+        //----------------------------------------------------------------------
+
+        case GxB_GLOBAL_MEMORY_BUDGET : // same as GxB_MEMORY_BUDGET
+
+            {
+                va_start (ap, field) ;
+                double memory_budget = va_arg (ap, double) ;
+                va_end (ap) ;
+                GB_Global_memory_budget_set (memory_budget) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // memory pool control
         //----------------------------------------------------------------------
@@ -132,6 +157,46 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // placement of large blocks of memory
+        //----------------------------------------------------------------------
+
+        case GxB_MEMORY_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int memory_policy = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (memory_policy == GxB_MEMORY_POLICY_DEFAULT ||
+                       memory_policy == GxB_MEMORY_POLICY_INTERLEAVE ||
+                       memory_policy == GxB_MEMORY_POLICY_FIRST_TOUCH))
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                GB_Global_memory_policy_set (memory_policy) ;
+            }
+            break ;
+
+        case GxB_HUGE_PAGE_THRESHOLD : 
+
+            {
+                va_start (ap, field) ;
+                int64_t huge_page_threshold = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                GB_Global_huge_page_threshold_set (huge_page_threshold) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // push/pull statistics for GrB_mxv and GrB_vxm
+        //----------------------------------------------------------------------
+
+        case GxB_PUSHPULL_STATS : 
+
+            // the value is ignored; the statistics are set to zero
+            GB_Global_pushpull_stats_clear ( ) ;
+            break ;
+
         //----------------------------------------------------------------------
         // diagnostics
         //----------------------------------------------------------------------
@@ -176,6 +241,50 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // CPU JIT
+        //----------------------------------------------------------------------
+
+        case GxB_JIT_C_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int jit_control = va_arg (ap, int) ;
+                va_end (ap) ;
+                GB_jitifyer_control_set ((bool) jit_control) ;
+            }
+            break ;
+
+        case GxB_JIT_C_COMPILER_NAME : 
+
+            {
+                va_start (ap, field) ;
+                char *compiler = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_compiler_set (compiler)) ;
+            }
+            break ;
+
+        case GxB_JIT_C_COMPILER_FLAGS : 
+
+            {
+                va_start (ap, field) ;
+                char *flags = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_flags_set (flags)) ;
+            }
+            break ;
+
+        case GxB_JIT_CACHE_PATH : 
+
+            {
+                va_start (ap, field) ;
+                char *cache_path = va_arg (ap, char *) ;
+                va_end (ap) ;
+                return (GB_jitifyer_cache_path_set (cache_path)) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // CUDA (DRAFT: in progress, do not use)
         //----------------------------------------------------------------------
@@ -23,7 +23,8 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
 
     GB_WHERE1 ("GxB_Matrix_Option_get (A, field, &value)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
-    ASSERT_MATRIX_OK (A, "A to get option", GB0) ;
+    ASSERT (A->magic == GB_MAGIC_PACKED ||
+        GB_Matrix_check (A, "A to get option", GB0, NULL) == GrB_SUCCESS) ;
 
     //--------------------------------------------------------------------------
     // get the option
@@ -100,6 +101,61 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_TRANSPOSE_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                bool *transpose_cache = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (transpose_cache) ;
+                (*transpose_cache) = A->transpose_cache ;
+            }
+            break ;
+
+        case GxB_DUAL_FORMAT : 
+
+            {
+                va_start (ap, field) ;
+                bool *dual_format = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (dual_format) ;
+                (*dual_format) = A->dual_format ;
+            }
+            break ;
+
+        case GxB_BITMAP_PACKED : 
+
+            {
+                va_start (ap, field) ;
+                bool *bitmap_packed = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_packed) ;
+                (*bitmap_packed) = A->bitmap_packed ;
+            }
+            break ;
+
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                bool *index32 = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (index32) ;
+                (*index32) = A->index32 ;
+            }
+            break ;
+
+        case GxB_AxB_PLAN : 
+
+            {
+                va_start (ap, field) ;
+                bool *keep_plan = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (keep_plan) ;
+                (*keep_plan) = A->keep_plan ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
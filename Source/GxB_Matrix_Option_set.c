@@ -27,6 +27,10 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
     GB_WHERE (A, "GxB_Matrix_Option_set (A, field, value)") ;
     GB_BURBLE_START ("GxB_set") ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // A is modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack (A, Context)) ;
+
     ASSERT_MATRIX_OK (A, "A to set option", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -94,6 +98,77 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
             }
             break ;
 
+        case GxB_TRANSPOSE_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                int transpose_cache = va_arg (ap, int) ;
+                va_end (ap) ;
+                // any prior A->T has already been freed by GB_WHERE
+                A->transpose_cache = (bool) transpose_cache ;
+                if (!transpose_cache)
+                { 
+                    // the dual format requires the transpose cache
+                    A->dual_format = false ;
+                }
+            }
+            break ;
+
+        case GxB_DUAL_FORMAT : 
+
+            {
+                va_start (ap, field) ;
+                int dual_format = va_arg (ap, int) ;
+                va_end (ap) ;
+                // the second format of A is held in A->T, which is
+                // constructed when first needed
+                A->dual_format = (bool) dual_format ;
+                if (dual_format)
+                { 
+                    A->transpose_cache = true ;
+                }
+            }
+            break ;
+
+        case GxB_BITMAP_PACKED : 
+
+            {
+                va_start (ap, field) ;
+                int bitmap_packed = va_arg (ap, int) ;
+                va_end (ap) ;
+                // A->b has already been unpacked above, and it is packed
+                // below if A is still bitmap
+                A->bitmap_packed = (bool) bitmap_packed ;
+            }
+            break ;
+
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                int index32 = va_arg (ap, int) ;
+                va_end (ap) ;
+                // A->[phi] have already been widened above, and they are
+                // narrowed below if A is sparse or hypersparse
+                A->index32 = (bool) index32 ;
+            }
+            break ;
+
+        case GxB_AxB_PLAN : 
+
+            {
+                va_start (ap, field) ;
+                int keep_plan = va_arg (ap, int) ;
+                va_end (ap) ;
+                // the plan is constructed by the next A=X*Y
+                A->keep_plan = (bool) keep_plan ;
+                if (!keep_plan)
+                { 
+                    GB_AxB_saxpy3_plan_free (A) ;
+                }
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -105,8 +180,28 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
 
     ASSERT_MATRIX_OK (A, "A set before conform", GB0) ;
     GB_OK (GB_conform (A, Context)) ;
-    GB_BURBLE_END ;
     ASSERT_MATRIX_OK (A, "A set after conform", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap, if enabled
+    //--------------------------------------------------------------------------
+
+    if (A->bitmap_packed && GB_IS_BITMAP (A))
+    { 
+        GB_OK (GB_bitmap_pack (A, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // narrow the indices to 32 bits, if enabled
+    //--------------------------------------------------------------------------
+
+    if (A->index32 && (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A))
+        && !GB_ANY_PENDING_WORK (A) && GB_INDEX32_OK (A))
+    { 
+        GB_OK (GB_index32_pack (A, Context)) ;
+    }
+
+    GB_BURBLE_END ;
     return (GrB_SUCCESS) ;
 }
 
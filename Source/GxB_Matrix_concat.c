@@ -7,6 +7,18 @@
 
 //------------------------------------------------------------------------------
 
+#define GB_FREE_ALL                                         \
+{                                                           \
+    if (Views != NULL)                                      \
+    {                                                       \
+        for (int64_t k = 0 ; k < (int64_t) (m*n) ; k++)     \
+        {                                                   \
+            GB_PACKED_VIEW_FREE (Views [k], Tiles [k]) ;    \
+        }                                                   \
+    }                                                       \
+    GB_FREE_WORK (&Views, Views_size) ;                     \
+}
+
 #include "GB_concat.h"
 
 GrB_Info GxB_Matrix_concat          // concatenate a 2D array of matrices
@@ -36,11 +48,38 @@ GrB_Info GxB_Matrix_concat          // concatenate a 2D array of matrices
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get unpacked copies of any packed tiles
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix *Views = NULL ; size_t Views_size = 0 ;
+    GB_OK (GB_packed_unpack (C, Context)) ;
+    bool any_packed = false ;
+    for (int64_t k = 0 ; k < (int64_t) (m*n) ; k++)
+    { 
+        GrB_Matrix A = Tiles [k] ;
+        any_packed = any_packed || (A != NULL && A->magic == GB_MAGIC_PACKED);
+    }
+    if (any_packed)
+    {
+        Views = GB_CALLOC_WORK (m*n, GrB_Matrix, &Views_size) ;
+        if (Views == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        for (int64_t k = 0 ; k < (int64_t) (m*n) ; k++)
+        { 
+            GB_OK (GB_packed_view (&(Views [k]), Tiles [k], Context)) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // C = concatenate (Tiles)
     //--------------------------------------------------------------------------
 
-    info = GB_concat (C, Tiles, m, n, Context) ;
+    info = GB_concat (C, any_packed ? Views : Tiles, m, n, Context) ;
+    GB_FREE_ALL ;
     GB_BURBLE_END ;
     return (info) ;
 }
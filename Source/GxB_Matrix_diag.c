@@ -50,11 +50,22 @@ GrB_Info GxB_Matrix_diag        // build a diagonal matrix from a vector
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    //--------------------------------------------------------------------------
+    // unpack C, and get an unpacked copy of v if it is packed
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (v_view, v) ;
+
     //--------------------------------------------------------------------------
     // C = diag (v,k)
     //--------------------------------------------------------------------------
 
-    info = GB_Matrix_diag (C, (GrB_Matrix) v, k, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_Matrix_diag (C, v_view, k, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (v_view, v) ;
     GB_BURBLE_END ;
     return (info) ;
 }
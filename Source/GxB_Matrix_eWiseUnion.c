@@ -40,16 +40,27 @@
     /* get the mask */                                                      \
     GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;           \
     /* C<M> = accum (C,T) where T = A+B, A'+B, A+B', or A'+B' */            \
-    info = GB_ewise (                                                       \
-        C,              C_replace,  /* C and its descriptor        */       \
-        M, Mask_comp, Mask_struct,  /* mask and its descriptor     */       \
-        accum,                      /* accumulate operator         */       \
-        op,                         /* operator that defines '+'   */       \
-        A,              A_tran,     /* A matrix and its descriptor */       \
-        B,              B_tran,     /* B matrix and its descriptor */       \
-        true,                       /* eWiseAdd                    */       \
-        true, alpha, beta,          /* eWiseUnion                  */       \
-        Context) ;
+    /* unpack C, and get unpacked copies of any packed inputs */            \
+    info = GB_packed_unpack (C, Context) ;                                  \
+    GB_PACKED_VIEW (M_view, M) ;                                            \
+    GB_PACKED_VIEW (A_view, A) ;                                            \
+    GB_PACKED_VIEW (B_view, B) ;                                            \
+    if (info == GrB_SUCCESS)                                                \
+    {                                                                       \
+        info = GB_ewise (                                                   \
+            C,              C_replace,  /* C and its descriptor */          \
+            M_view, Mask_comp, Mask_struct, /* mask and descriptor */       \
+            accum,                      /* accumulate operator */           \
+            op,                         /* operator: '+' */                 \
+            A_view,         A_tran,     /* A and its descriptor */          \
+            B_view,         B_tran,     /* B and its descriptor */          \
+            true,                       /* eWiseAdd */                      \
+            true, alpha, beta,          /* eWiseUnion */                    \
+            Context) ;                                                      \
+    }                                                                       \
+    GB_PACKED_VIEW_FREE (M_view, M) ;                                       \
+    GB_PACKED_VIEW_FREE (A_view, A) ;                                       \
+    GB_PACKED_VIEW_FREE (B_view, B) ;
 
 //------------------------------------------------------------------------------
 // GxB_Matrix_eWiseUnion: matrix addition
@@ -40,6 +40,9 @@ GrB_Info GxB_Matrix_export_BitmapR  // export and free a bitmap matrix, by row
     GB_RETURN_IF_NULL_OR_FAULTY (*A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    // A is unpacked if packed, since its content is given to the user
+    GB_OK (GB_packed_unpack (*A, Context)) ;
+
     //--------------------------------------------------------------------------
     // ensure the matrix is bitmap by-row
     //--------------------------------------------------------------------------
@@ -24,11 +24,21 @@ GrB_Info GxB_Matrix_fprint          // print and check a GrB_Matrix
 
     GB_WHERE1 ("GxB_Matrix_fprint (A, name, pr, f)") ;
 
+    // a packed matrix is checked and printed via an unpacked copy
+    GrB_Matrix A_view = A ;
+    GrB_Info info = GB_packed_view (&A_view, A, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // print and check the object
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_Matrix_check (A, name, pr, f) ;
+    info = GB_Matrix_check (A_view, name, pr, f) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
 
     //--------------------------------------------------------------------------
     // return result
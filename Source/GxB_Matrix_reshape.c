@@ -54,11 +54,19 @@ GrB_Info GxB_Matrix_reshape     // reshape a GrB_Matrix in place
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    // C is modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+    Context->output = C ;
+
     //--------------------------------------------------------------------------
     // reshape the matrix
     //--------------------------------------------------------------------------
 
-    info = GB_reshape (NULL, C, by_col, nrows_new, ncols_new, Context) ;
+    info = GB_packed_unpack (C, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_reshape (NULL, C, by_col, nrows_new, ncols_new, Context) ;
+    }
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -41,11 +41,21 @@ GrB_Info GxB_Matrix_reshapeDup // reshape a GrB_Matrix into another GrB_Matrix
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    //--------------------------------------------------------------------------
+    // get an unpacked copy of A, if it is packed
+    //--------------------------------------------------------------------------
+
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // reshape the matrix
     //--------------------------------------------------------------------------
 
-    info = GB_reshape (C, A, by_col, nrows_new, ncols_new, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_reshape (C, A_view, by_col, nrows_new, ncols_new, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (A_view, A) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -34,11 +34,28 @@ GrB_Info GxB_Matrix_sort
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2, A_transpose, xx3, xx4, xx5) ;
 
+    // C and P are modified, so their cached transposes are no longer valid
+    GB_transpose_cache_free (C) ;
+    GB_transpose_cache_free (P) ;
+    Context->output = C ;
+
+    //--------------------------------------------------------------------------
+    // unpack C, and get an unpacked copy of A if it is packed
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with A.  The prior content of P is discarded.
+    info = GB_packed_unpack (C, Context) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // sort the matrix
     //--------------------------------------------------------------------------
 
-    info = GB_sort (C, P, op, A, A_transpose, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_sort (C, P, op, A_view, A_transpose, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (A_view, A) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -43,11 +43,21 @@ GrB_Info GxB_Matrix_split           // split a matrix into 2D array of matrices
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    //--------------------------------------------------------------------------
+    // get an unpacked copy of A, if it is packed
+    //--------------------------------------------------------------------------
+
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // Tiles = split (A)
     //--------------------------------------------------------------------------
 
-    info = GB_split (Tiles, m, n, Tile_nrows, Tile_ncols, A, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_split (Tiles, m, n, Tile_nrows, Tile_ncols, A_view, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (A_view, A) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -37,6 +37,9 @@ GrB_Info GxB_Matrix_unpack_CSR  // unpack a CSR matrix
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    // A is unpacked if packed, since its content is given to the user
+    GB_OK (GB_packed_unpack (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // ensure the matrix is sparse by-row
     //--------------------------------------------------------------------------
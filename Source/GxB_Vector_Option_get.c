@@ -23,7 +23,8 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
 
     GB_WHERE1 ("GxB_Vector_Option_get (v, field, &value)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
-    ASSERT_VECTOR_OK (v, "v to get option", GB0) ;
+    ASSERT (v->magic == GB_MAGIC_PACKED ||
+        GB_Vector_check (v, "v to get option", GB0, NULL) == GrB_SUCCESS) ;
 
     //--------------------------------------------------------------------------
     // get the option
@@ -91,6 +92,28 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
             }
             break ;
 
+        case GxB_BITMAP_PACKED : 
+
+            {
+                va_start (ap, field) ;
+                bool *bitmap_packed = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_packed) ;
+                (*bitmap_packed) = v->bitmap_packed ;
+            }
+            break ;
+
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                bool *index32 = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (index32) ;
+                (*index32) = v->index32 ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -27,6 +27,10 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     GB_WHERE (v, "GxB_Vector_Option_set (v, field, value)") ;
     GB_BURBLE_START ("GxB_set (vector option)") ;
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+
+    // v is modified, so unpack it if it is packed
+    GB_OK (GB_packed_unpack ((GrB_Matrix) v, Context)) ;
+
     ASSERT_VECTOR_OK (v, "v to set option", GB0) ;
 
     //--------------------------------------------------------------------------
@@ -59,6 +63,30 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
             }
             break ;
 
+        case GxB_BITMAP_PACKED : 
+
+            {
+                va_start (ap, field) ;
+                int bitmap_packed = va_arg (ap, int) ;
+                va_end (ap) ;
+                // v->b has already been unpacked above, and it is packed
+                // below if v is still bitmap
+                v->bitmap_packed = (bool) bitmap_packed ;
+            }
+            break ;
+
+        case GxB_INDEX_32 : 
+
+            {
+                va_start (ap, field) ;
+                int index32 = va_arg (ap, int) ;
+                va_end (ap) ;
+                // v->[phi] have already been widened above, and they are
+                // narrowed below if v is sparse or hypersparse
+                v->index32 = (bool) index32 ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -69,8 +97,28 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
     //--------------------------------------------------------------------------
 
     GB_OK (GB_conform ((GrB_Matrix) v, Context)) ;
-    GB_BURBLE_END ;
     ASSERT_VECTOR_OK (v, "v set", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // pack the bitmap, if enabled
+    //--------------------------------------------------------------------------
+
+    if (v->bitmap_packed && GB_IS_BITMAP (v))
+    { 
+        GB_OK (GB_bitmap_pack ((GrB_Matrix) v, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // narrow the indices to 32 bits, if enabled
+    //--------------------------------------------------------------------------
+
+    if (v->index32 && GB_IS_SPARSE (v) && !GB_ANY_PENDING_WORK (v)
+        && GB_INDEX32_OK (v))
+    { 
+        GB_OK (GB_index32_pack ((GrB_Matrix) v, Context)) ;
+    }
+
+    GB_BURBLE_END ;
     return (info) ;
 }
 
@@ -30,11 +30,22 @@ GrB_Info GxB_Vector_diag    // extract a diagonal from a matrix, as a vector
     // get the descriptor
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    //--------------------------------------------------------------------------
+    // unpack v, and get an unpacked copy of A if it is packed
+    //--------------------------------------------------------------------------
+
+    info = GB_packed_unpack ((GrB_Matrix) v, Context) ;
+    GB_PACKED_VIEW (A_view, A) ;
+
     //--------------------------------------------------------------------------
     // v = diag (A,k)
     //--------------------------------------------------------------------------
 
-    info = GB_Vector_diag ((GrB_Matrix) v, A, k, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_Vector_diag ((GrB_Matrix) v, A_view, k, Context) ;
+    }
+    GB_PACKED_VIEW_FREE (A_view, A) ;
     GB_BURBLE_END ;
     return (info) ;
 }
@@ -35,16 +35,27 @@
     /* get the mask */                                                      \
     GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ; \
     /* w<M> = accum (w,t) where t = u+v, u'+v, u+v', or u'+v' */            \
-    info = GB_ewise (                                                       \
-        (GrB_Matrix) w, C_replace,  /* w and its descriptor        */       \
-        M, Mask_comp, Mask_struct,  /* mask and its descriptor */           \
-        accum,                      /* accumulate operator         */       \
-        op,                         /* operator that defines '+'   */       \
-        (GrB_Matrix) u, false,      /* u, never transposed         */       \
-        (GrB_Matrix) v, false,      /* v, never transposed         */       \
-        true,                       /* eWiseAdd                    */       \
-        true, alpha, beta,          /* eWiseUnion                  */       \
-        Context)
+    /* unpack w, and get unpacked copies of any packed inputs */            \
+    info = GB_packed_unpack ((GrB_Matrix) w, Context) ;                     \
+    GB_PACKED_VIEW (M_view, M) ;                                            \
+    GB_PACKED_VIEW (u_view, u) ;                                            \
+    GB_PACKED_VIEW (v_view, v) ;                                            \
+    if (info == GrB_SUCCESS)                                                \
+    {                                                                       \
+        info = GB_ewise (                                                   \
+            (GrB_Matrix) w, C_replace,  /* w and its descriptor */          \
+            M_view, Mask_comp, Mask_struct, /* mask and descriptor */       \
+            accum,                      /* accumulate operator */           \
+            op,                         /* operator: '+' */                 \
+            u_view,         false,      /* u, never transposed */           \
+            v_view,         false,      /* v, never transposed */           \
+            true,                       /* eWiseAdd */                      \
+            true, alpha, beta,          /* eWiseUnion */                    \
+            Context) ;                                                      \
+    }                                                                       \
+    GB_PACKED_VIEW_FREE (M_view, M) ;                                       \
+    GB_PACKED_VIEW_FREE (u_view, u) ;                                       \
+    GB_PACKED_VIEW_FREE (v_view, v)
 
 //------------------------------------------------------------------------------
 // GxB_Vector_eWiseUnion: vector addition
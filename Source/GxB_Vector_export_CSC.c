@@ -39,6 +39,10 @@ GrB_Info GxB_Vector_export_CSC  // export and free a CSC vector
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
     GB_RETURN_IF_NULL (v) ;
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
+
+    // v is unpacked if packed, since its content is given to the user
+    GB_OK (GB_packed_unpack ((GrB_Matrix) *v, Context)) ;
+
     GB_RETURN_IF_NULL (nvals) ;
     ASSERT_VECTOR_OK (*v, "v to export", GB0) ;
 
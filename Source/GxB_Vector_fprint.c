@@ -24,11 +24,21 @@ GrB_Info GxB_Vector_fprint          // print and check a GrB_Vector
 
     GB_WHERE1 ("GxB_Vector_fprint (v, name, pr, f)") ;
 
+    // a packed matrix is checked and printed via an unpacked copy
+    GrB_Matrix v_view = (GrB_Matrix) v ;
+    GrB_Info info = GB_packed_view (&v_view, (GrB_Matrix) v, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // print and check the object
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_Vector_check (v, name, pr, f) ;
+    info = GB_Vector_check ((GrB_Vector) v_view, name, pr, f) ;
+    GB_PACKED_VIEW_FREE (v_view, (GrB_Matrix) v) ;
 
     //--------------------------------------------------------------------------
     // return result
@@ -32,12 +32,24 @@ GrB_Info GxB_Vector_sort
     GB_RETURN_IF_NULL_OR_FAULTY (u) ;
     ASSERT (GB_VECTOR_OK (u)) ;
 
+    //--------------------------------------------------------------------------
+    // unpack w, and get an unpacked copy of u if it is packed
+    //--------------------------------------------------------------------------
+
+    // w may be aliased with u.  The prior content of p is discarded.
+    GrB_Info info = GB_packed_unpack ((GrB_Matrix) w, Context) ;
+    GB_PACKED_VIEW (u_view, u) ;
+
     //--------------------------------------------------------------------------
     // sort the vector
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_sort ((GrB_Matrix) w, (GrB_Matrix) p, op,
-        (GrB_Matrix) u, true, Context) ;
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_sort ((GrB_Matrix) w, (GrB_Matrix) p, op, u_view, true,
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (u_view, u) ;
     GB_BURBLE_END ;
     return (info) ;
 }
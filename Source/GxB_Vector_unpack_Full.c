@@ -31,6 +31,9 @@ GrB_Info GxB_Vector_unpack_Full   // unpack a full vector
     GB_RETURN_IF_NULL_OR_FAULTY (v) ;
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
 
+    // v is unpacked if packed, since its content is given to the user
+    GB_OK (GB_packed_unpack ((GrB_Matrix) v, Context)) ;
+
     //--------------------------------------------------------------------------
     // finish any pending work
     //--------------------------------------------------------------------------
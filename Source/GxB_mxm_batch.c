@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_batch: matrix-matrix multiply, one block of the result at a time
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B, where each block of C is passed to the user function f as soon as it
+// has been computed, so that C is never held in memory all at once.
+
+// The input matrices A and B are optionally transposed, as determined by the
+// Descriptor desc.  No mask or accum operator can be used.
+
+#include "GB_mxm.h"
+
+GrB_Info GxB_mxm_batch              // C=A*B, passed to f one block at a time
+(
+    GxB_batch_function f,           // function to receive each block of C
+    void *user_data,                // passed to f, may be NULL
+    double batch_size,              // max bytes for each block of C
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for A and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_mxm_batch (f, user_data, batch_size, semiring, A, B, "
+        "desc)") ;
+    GB_BURBLE_START ("GxB_mxm_batch") ;
+    GB_RETURN_IF_NULL (f) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    //--------------------------------------------------------------------------
+    // get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    GB_PACKED_VIEW (A_view, A) ;
+    GB_PACKED_VIEW (B_view, B) ;
+
+    //--------------------------------------------------------------------------
+    // C=A*B, one block at a time
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_mxm_batch (
+            f,          user_data,      // user function and its data
+            batch_size,                 // max bytes for each block of C
+            semiring,                   // semiring that defines C=A*B
+            A_view,     A_transpose,    // A matrix and its descriptor
+            B_view,     B_transpose,    // B matrix and its descriptor
+            AxB_method, do_sort,        // algorithm selector
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (A_view, A) ;
+    GB_PACKED_VIEW_FREE (B_view, B) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
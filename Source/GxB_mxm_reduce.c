@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+// GxB_mxm_reduce: reduce the result of a masked matrix-matrix multiply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// s = accum (s, reduce (C)) where C<M>=A*B, without constructing C.
+
+// The input matrices A and B are optionally transposed, as determined by the
+// Descriptor desc.  The mask M is required.
+
+#include "GB_mxm.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_mxm_reduce             // s = accum (s, reduce (C<M>=A*B))
+(
+    GrB_Scalar s,                   // input/output scalar for result
+    const GrB_BinaryOp accum,       // optional accum for s=accum(s,t)
+    const GrB_Monoid monoid,        // monoid to reduce the entries of C
+    const GrB_Matrix M_in,          // mask for C (required)
+    const GrB_Semiring semiring,    // defines '+' and '*' for C=A*B
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for M, A, and B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (s, "GxB_mxm_reduce (s, accum, monoid, M, semiring, A, B, desc)") ;
+    GB_BURBLE_START ("GxB_mxm_reduce") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (s) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (M_in) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, B_transpose, AxB_method, do_sort) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // get unpacked copies of any packed inputs
+    //--------------------------------------------------------------------------
+
+    GB_PACKED_VIEW (M_view, M) ;
+    GB_PACKED_VIEW (A_view, A) ;
+    GB_PACKED_VIEW (B_view, B) ;
+
+    //--------------------------------------------------------------------------
+    // s = accum (s, reduce (C<M>=A*B)) and variations
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_SUCCESS)
+    { 
+        info = GB_mxm_reduce (
+            s,          accum,          // output scalar and accum
+            monoid,                     // monoid to reduce C
+            M_view,     Mask_comp,      // mask matrix and its descriptor
+            Mask_struct,                // if true, use only the mask pattern
+            semiring,                   // semiring that defines C=A*B
+            A_view,     A_transpose,    // A matrix and its descriptor
+            B_view,     B_transpose,    // B matrix and its descriptor
+            AxB_method,                 // algorithm selector
+            Context) ;
+    }
+    GB_PACKED_VIEW_FREE (M_view, M) ;
+    GB_PACKED_VIEW_FREE (A_view, A) ;
+    GB_PACKED_VIEW_FREE (B_view, B) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -30,6 +30,10 @@
 // found, so these optimizations can be used only if A(:,i) and/or B(:,j) are
 // entirely populated.
 
+// If both A(:,i) and B(:,j) are sparse with about the same number of entries,
+// their intersection is found with AVX2 or AVX512F on the x86_64, if the CPU
+// supports it (see GB_AxB_dot_intersect.h).
+
 #undef GB_A_INDEX
 #ifdef GB_A_NOT_TRANSPOSED
 #define GB_A_INDEX(k) (pA+(k)*vlen)
@@ -561,6 +565,50 @@
             // A(:,i) and B(:,j) have about the same sparsity
             //------------------------------------------------------------------
 
+            #if GB_COMPILER_SUPPORTS_AVX2 || GB_COMPILER_SUPPORTS_AVX512F
+            if (ainz >= GB_INTERSECT_SIMD_MIN && bjnz >= GB_INTERSECT_SIMD_MIN)
+            {
+                // find the matches in blocks of 4 or 8 entries with AVX2 or
+                // AVX512F, if available, until fewer than that remain
+                const int method = GB_intersect_method ( ) ;
+                const int64_t w = GB_intersect_width (method) ;
+                int mask ;
+                while ((mask = GB_intersect_block (method,
+                    Ai, &pA, pA_end, Bi, &pB, pB_end)) != 0)
+                {
+                    // merge the entries A(k,i) and B(k,j) in the two blocks,
+                    // where bit t of the mask is set if Ai [pA+t] is a match
+                    int64_t pb = pB ;
+                    for (int64_t pa = pA ; mask != 0 ; pa++, mask >>= 1)
+                    {
+                        if (!(mask & 1)) continue ;
+                        int64_t k = Ai [pa] ;
+                        while (Bi [pb] != k)
+                        { 
+                            pb++ ;
+                        }
+                        GB_DOT (k, pa, pb) ;
+                        #if GB_IS_MIN_FIRSTJ_SEMIRING
+                        break ;
+                        #endif
+                    }
+                    // the mask is nonzero if the dot product is done
+                    if (mask != 0) break ;
+                    // discard the block(s) with the smaller last index
+                    int64_t alast = Ai [pA+w-1] ;
+                    int64_t blast = Bi [pB+w-1] ;
+                    pA += (alast <= blast) ? w : 0 ;
+                    pB += (blast <= alast) ? w : 0 ;
+                }
+                if (mask != 0)
+                { 
+                    // skip the scalar merge of the remaining entries
+                    pA = pA_end ;
+                }
+            }
+            #endif
+
+            // merge the remaining entries of A(:,i) and B(:,j)
             while (pA < pA_end && pB < pB_end)
             {
                 int64_t ia = Ai [pA] ;
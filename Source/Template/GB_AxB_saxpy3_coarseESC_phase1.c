@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_coarseESC_phase1: symbolic coarse ESC task, no mask
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+
+    //--------------------------------------------------------------------------
+    // phase1: coarse ESC task, C=A*B
+    //--------------------------------------------------------------------------
+
+    // The row indices of A(:,k) for each k in B(:,j) are expanded into Hi,
+    // sorted, and the unique indices are counted.  Each vector needs at most
+    // GB_SAXPY3_ESC_FLMAX flops, which is no larger than the size of Hi.
+    // Hf is not used.  A is sparse or hypersparse.
+
+    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+    {
+        GB_GET_B_j ;            // get B(:,j)
+        Cp [kk] = 0 ;
+
+        //----------------------------------------------------------------------
+        // special case when B(:,j) is empty or has one entry
+        //----------------------------------------------------------------------
+
+        #if ( GB_B_IS_SPARSE || GB_B_IS_HYPER )
+        if (bjnz == 0) continue ;
+        #endif
+
+        if (bjnz == 1)
+        {
+            GB_GET_B_kj_INDEX ;     // get index k of B(k,j)
+            GB_GET_A_k ;            // get A(:,k)
+            Cp [kk] = aknz ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // expand: gather all row indices of A*B(:,j) into Hi
+        //----------------------------------------------------------------------
+
+        int64_t nexp = 0 ;
+        for ( ; pB < pB_end ; pB++)     // scan B(:,j)
+        {
+            GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
+            GB_GET_A_k ;                // get A(:,k)
+            // scan A(:,k)
+            for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+            {
+                GB_GET_A_ik_INDEX ;     // get index i of A(i,k)
+                Hi [nexp++] = i ;
+            }
+        }
+        ASSERT (nexp <= GB_SAXPY3_ESC_FLMAX) ;
+
+        //----------------------------------------------------------------------
+        // sort and count the unique indices in C(:,j)
+        //----------------------------------------------------------------------
+
+        GB_qsort_1 (Hi, nexp) ;
+        int64_t cjnz = 0 ;
+        for (int64_t p = 0 ; p < nexp ; p++)
+        {
+            cjnz += (p == 0 || Hi [p] != Hi [p-1]) ;
+        }
+        Cp [kk] = cjnz ;                // count the entries in C(:,j)
+    }
+}
+
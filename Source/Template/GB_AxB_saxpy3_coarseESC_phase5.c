@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_coarseESC_phase5: C=A*B for coarse ESC method, phase 5
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+
+    //--------------------------------------------------------------------------
+    // phase 5: coarse ESC task, C=A*B
+    //--------------------------------------------------------------------------
+
+    // The row indices of A*B(:,j) are expanded into Hi, sorted, and compressed
+    // directly into Ci [pC ... pC+cjnz-1], which is left sorted.  A second
+    // scan of B(:,j) computes the values, where Hx [p] holds the value of the
+    // entry Ci [pC+p].  The bits of Hx_set record which entries of Hx have
+    // been assigned, since cjnz <= GB_SAXPY3_ESC_FLMAX <= 64.
+
+    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+    {
+        int64_t pC = Cp [kk] ;
+        int64_t cjnz = Cp [kk+1] - pC ;
+        if (cjnz == 0) continue ;   // nothing to do
+        GB_GET_B_j ;                // get B(:,j)
+
+        if (bjnz == 1)
+        {
+            // C(:,j) = A(:,k)*B(k,j), no mask
+            GB_COMPUTE_C_j_WHEN_NNZ_B_j_IS_ONE ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // expand, sort, and compress the pattern of C(:,j)
+        //----------------------------------------------------------------------
+
+        const int64_t pB_start = pB ;
+        int64_t nexp = 0 ;
+        for ( ; pB < pB_end ; pB++)     // scan B(:,j)
+        {
+            GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
+            GB_GET_A_k ;                // get A(:,k)
+            // scan A(:,k)
+            for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+            {
+                GB_GET_A_ik_INDEX ;     // get index i of A(i,k)
+                Hi [nexp++] = i ;
+            }
+        }
+
+        GB_qsort_1 (Hi, nexp) ;
+        int64_t *restrict Cj = Ci + pC ;
+        int64_t cnt = 0 ;
+        for (int64_t p = 0 ; p < nexp ; p++)
+        {
+            if (p == 0 || Hi [p] != Hi [p-1])
+            {
+                Cj [cnt++] = Hi [p] ;
+            }
+        }
+        ASSERT (cnt == cjnz) ;
+
+        //----------------------------------------------------------------------
+        // compute the values of C(:,j)
+        //----------------------------------------------------------------------
+
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        {
+            uint64_t Hx_set = 0 ;
+            for (pB = pB_start ; pB < pB_end ; pB++)     // scan B(:,j)
+            {
+                GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
+                GB_GET_A_k ;                // get A(:,k)
+                if (aknz == 0) continue ;
+                GB_GET_B_kj ;               // bkj = B(k,j)
+                // scan A(:,k)
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    GB_GET_A_ik_INDEX ;     // get index i of A(i,k)
+                    GB_MULT_A_ik_B_kj ;     // t = A(i,k)*B(k,j)
+                    // find i in Cj [0:cjnz-1]
+                    int64_t pleft = 0, pright = cjnz-1 ;
+                    GB_TRIM_BINARY_SEARCH (i, Cj, pleft, pright) ;
+                    ASSERT (Cj [pleft] == i) ;
+                    const uint64_t bit = ((uint64_t) 1) << pleft ;
+                    if (Hx_set & bit)
+                    {
+                        // Hx [pleft] += t ;
+                        GB_HX_UPDATE (pleft, t) ;
+                    }
+                    else
+                    {
+                        // Hx [pleft] = t ;
+                        Hx_set |= bit ;
+                        GB_HX_WRITE (pleft, t) ;
+                    }
+                }
+            }
+            for (int64_t p = 0 ; p < cjnz ; p++)
+            {
+                // Cx [pC+p] = Hx [p] ;
+                GB_CIJ_GATHER (pC + p, p) ;
+            }
+        }
+        #endif
+    }
+}
+
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_coarseMSA_phase5: C<M>=A*B, masked sparse accumulator, phase5
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+
+    //--------------------------------------------------------------------------
+    // phase5: coarse MSA task, C<M>=A*B
+    //--------------------------------------------------------------------------
+
+    // The pattern of C(:,j) is a subset of the pattern of M(:,j), so no
+    // symbolic phase is done.  On input, Cp [kfirst:klast] holds the
+    // cumulative sum of nnz (M (:,kfirst:klast)), so C(:,kfirst:klast) has
+    // room for all entries in M(:,kfirst:klast).  This task compacts its
+    // entries to the start of that space, and sets Cp [kfirst+1:klast] to
+    // the new positions.  Cp [kfirst] is not modified, and Cp [klast+1] is
+    // owned by the next task.  The number of entries found is returned in
+    // my_cjnz.  The entries of C(:,j) are gathered in the order of M(:,j).
+
+    // Initially, Hf [...] < mark for all of Hf.
+
+    // Hf [i] < mark    : M(i,j)=0, C(i,j) is ignored.
+    // Hf [i] == mark   : M(i,j)=1, and C(i,j) not yet seen.
+    // Hf [i] == mark+1 : M(i,j)=1, and C(i,j) has been seen.
+
+    const int64_t pC_first = Cp [kfirst] ;
+    int64_t pC = pC_first ;
+
+    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+    {
+        Cp [kk] = pC ;
+        GB_GET_M_j ;                // get M(:,j)
+        if (mjnz == 0) continue ;   // nothing to do
+        GB_GET_B_j ;                // get B(:,j)
+        if (bjnz == 0) continue ;   // nothing to do
+        GB_GET_M_j_RANGE (64) ;     // get first and last in M(:,j)
+        mark += 2 ;
+        int64_t mark1 = mark+1 ;
+
+        // scatter M(:,j) into the Gustavson workspace
+        GB_SCATTER_M_j (pM_start, pM_end, mark) ;
+
+        for ( ; pB < pB_end ; pB++)     // scan B(:,j)
+        {
+            GB_GET_B_kj_INDEX ;         // get k of B(k,j)
+            GB_GET_A_k ;                // get A(:,k)
+            if (aknz == 0) continue ;
+            GB_GET_B_kj ;               // bkj = B(k,j)
+            #define GB_IKJ                                      \
+            {                                                   \
+                int64_t hf = Hf [i] ;                           \
+                if (hf == mark)                                 \
+                {                                               \
+                    /* C(i,j) = A(i,k) * B(k,j) */              \
+                    Hf [i] = mark1 ;        /* mark as seen */  \
+                    GB_MULT_A_ik_B_kj ;     /* t = aik*bkj */   \
+                    GB_HX_WRITE (i, t) ;    /* Hx [i] = t */    \
+                }                                               \
+                else if (hf == mark1)                           \
+                {                                               \
+                    /* C(i,j) += A(i,k) * B(k,j) */             \
+                    GB_MULT_A_ik_B_kj ;     /* t = aik*bkj */   \
+                    GB_HX_UPDATE (i, t) ;   /* Hx [i] += t */   \
+                }                                               \
+            }
+            GB_SCAN_M_j_OR_A_k (A_ok_for_binary_search) ;
+            #undef GB_IKJ
+        }
+
+        // gather C(:,j) in the order of M(:,j)
+        for (int64_t pM = pM_start ; pM < pM_end ; pM++)
+        {
+            const int64_t i = Mi [pM] ;
+            if (Hf [i] == mark1)
+            {
+                #if !GB_IS_ANY_PAIR_SEMIRING
+                GB_CIJ_GATHER (pC, i) ;     // Cx [pC] = Hx [i]
+                #endif
+                Ci [pC++] = i ;
+            }
+        }
+    }
+
+    SaxpyTasks [taskid].my_cjnz = pC - pC_first ;
+    task_C_jumbled = M_jumbled ;
+}
+
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_fineGus_private_merge: merge private fine Gustavson workspaces
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+
+    //--------------------------------------------------------------------------
+    // merge the private workspaces of each team into the leader's workspace
+    //--------------------------------------------------------------------------
+
+    // Each task in a team with private workspaces merges the rows istart:iend-1
+    // of the workspaces of the other tasks in its team into the workspace of
+    // the leader.  The rows of each task are disjoint, so no atomics are
+    // needed.  The leader's Hx is used as Cx, and the Hx of another task in
+    // the team is used as Hx, so that GB_CIJ_GATHER and GB_CIJ_GATHER_UPDATE
+    // can do the merge.
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = 0 ; taskid < nfine ; taskid++)
+    {
+        if (!SaxpyTasks [taskid].use_private) continue ;
+        int team_size = SaxpyTasks [taskid].team_size ;
+        int leader    = SaxpyTasks [taskid].leader ;
+        int my_teamid = taskid - leader ;
+        int64_t istart, iend ;
+        GB_PARTITION (istart, iend, cvlen, my_teamid, team_size) ;
+        int8_t *restrict Hf_leader = (int8_t *restrict) SaxpyTasks [leader].Hf ;
+        #if !GB_IS_ANY_PAIR_SEMIRING
+        GB_CTYPE *restrict Cx = (GB_CTYPE *) SaxpyTasks [leader].Hx ;
+        #endif
+        for (int member = leader + 1 ; member < leader + team_size ; member++)
+        {
+            int8_t *restrict Hf = (int8_t *) SaxpyTasks [member].Hf ;
+            #if !GB_IS_ANY_PAIR_SEMIRING
+            GB_CTYPE *restrict Hx = (GB_CTYPE *) SaxpyTasks [member].Hx ;
+            #endif
+            for (int64_t i = istart ; i < iend ; i++)
+            {
+                if (Hf [i] != 2) continue ;
+                if (Hf_leader [i] == 2)
+                {
+                    // Hx_leader [i] += Hx [i]
+                    GB_CIJ_GATHER_UPDATE (i, i) ;
+                }
+                else
+                {
+                    // Hx_leader [i] = Hx [i]
+                    GB_CIJ_GATHER (i, i) ;
+                    Hf_leader [i] = 2 ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // all tasks in each team now use the leader's workspace
+    //--------------------------------------------------------------------------
+
+    for (taskid = 0 ; taskid < nfine ; taskid++)
+    {
+        if (!SaxpyTasks [taskid].use_private) continue ;
+        int leader = SaxpyTasks [taskid].leader ;
+        SaxpyTasks [taskid].Hf = SaxpyTasks [leader].Hf ;
+        SaxpyTasks [taskid].Hx = SaxpyTasks [leader].Hx ;
+    }
+}
+
@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GB_AxB_saxpy3_fineGus_private_phase2: fine Gustavson, private workspace
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+{
+
+    //--------------------------------------------------------------------------
+    // phase2: fine Gustavson task, C(:,j)=A*B(:,j), private workspace
+    //--------------------------------------------------------------------------
+
+    // Hf and Hx are private to this task, so no atomics are needed.
+    // Hf [i] is initially 0, and becomes 2 when i is seen for the first time.
+    // The private workspaces of the team are merged after phase2.
+
+    for ( ; pB < pB_end ; pB++)     // scan B(:,j)
+    {
+        GB_GET_B_kj_INDEX ;         // get index k of B(k,j)
+        GB_GET_A_k ;                // get A(:,k)
+        if (aknz == 0) continue ;
+        GB_GET_B_kj ;               // bkj = B(k,j)
+        // scan A(:,k)
+        for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+        {
+            GB_GET_A_ik_INDEX ;     // get index i of A(i,k)
+            #if GB_IS_ANY_MONOID
+            if (Hf [i] == 2) continue ;     // C(i,j) already found
+            #endif
+            GB_MULT_A_ik_B_kj ;     // t = A(i,k) * B(k,j)
+            if (Hf [i] == 2)
+            {
+                // C(i,j) already appears in C(:,j)
+                GB_HX_UPDATE (i, t) ;       // Hx [i] += t
+            }
+            else
+            {
+                // C(i,j) is a new entry
+                Hf [i] = 2 ;
+                GB_HX_WRITE (i, t) ;        // Hx [i] = t
+            }
+        }
+    }
+}
+
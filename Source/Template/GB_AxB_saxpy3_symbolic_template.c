@@ -22,6 +22,7 @@
 #include "GB_AxB_saxpy3.h"
 #include "GB_AxB_saxpy3_template.h"
 #include "GB_atomics.h"
+#include "GB_sort.h"
 #include "GB_unused.h"
 
 #define GB_META16
@@ -274,7 +275,7 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
             {
 
                 //--------------------------------------------------------------
-                // phase1: coarse hash task
+                // phase1: coarse hash or ESC task
                 //--------------------------------------------------------------
 
                 int64_t *restrict Hi = SaxpyTasks [taskid].Hi ;
@@ -283,12 +284,26 @@ void GB_EVAL2 (GB (AxB_saxpy3_sym), GB_MASK_A_B_SUFFIX)
                 #if ( GB_NO_MASK )
                 { 
 
-                    //----------------------------------------------------------
-                    // phase1: coarse hash task, C=A*B
-                    //----------------------------------------------------------
+                    if (SaxpyTasks [taskid].use_esc)
+                    { 
+
+                        //------------------------------------------------------
+                        // phase1: coarse ESC task, C=A*B
+                        //------------------------------------------------------
 
-                    #undef GB_CHECK_MASK_ij
-                    #include "GB_AxB_saxpy3_coarseHash_phase1.c"
+                        #include "GB_AxB_saxpy3_coarseESC_phase1.c"
+
+                    }
+                    else
+                    { 
+
+                        //------------------------------------------------------
+                        // phase1: coarse hash task, C=A*B
+                        //------------------------------------------------------
+
+                        #undef GB_CHECK_MASK_ij
+                        #include "GB_AxB_saxpy3_coarseHash_phase1.c"
+                    }
 
                 }
                 #elif ( !GB_MASK_COMP )
@@ -177,6 +177,13 @@
                 Hf = (int8_t *restrict) SaxpyTasks [taskid].Hf ;
 
             #if ( GB_NO_MASK )
+            if (SaxpyTasks [taskid].use_private)
+            {
+                // phase2: fine Gustavson task, C(:,j)=A*B(:,j), with a
+                // private workspace
+                #include "GB_AxB_saxpy3_fineGus_private_phase2.c"
+            }
+            else
             {
                 // phase2: fine Gustavson task, C(:,j)=A*B(:,j)
                 #include "GB_AxB_saxpy3_fineGus_phase2.c"
@@ -325,6 +332,16 @@
     ttt = omp_get_wtime ( ) ;
     #endif
 
+    //==========================================================================
+    // phase2: merge the private workspaces of fine Gustavson tasks
+    //==========================================================================
+
+    #if ( GB_NO_MASK )
+    {
+        #include "GB_AxB_saxpy3_fineGus_private_merge.c"
+    }
+    #endif
+
     //==========================================================================
     // phase3/phase4: count nnz(C(:,j)) for fine tasks, cumsum of Cp
     //==========================================================================
@@ -492,6 +509,12 @@
                     #include "GB_AxB_saxpy3_coarseGus_noM_phase5.c"
                 }
                 #elif ( !GB_MASK_COMP )
+                if (SaxpyTasks [taskid].use_msa)
+                {
+                    // phase5: coarse MSA task, C<M>=A*B
+                    #include "GB_AxB_saxpy3_coarseMSA_phase5.c"
+                }
+                else
                 {
                     // phase5: coarse Gustavson task, C<M>=A*B
                     #include "GB_AxB_saxpy3_coarseGus_M_phase5.c"
@@ -508,7 +531,7 @@
             {
 
                 //--------------------------------------------------------------
-                // phase5: coarse hash task
+                // phase5: coarse hash or ESC task
                 //--------------------------------------------------------------
 
                 int64_t *restrict Hi = SaxpyTasks [taskid].Hi ;
@@ -517,13 +540,28 @@
                 #if ( GB_NO_MASK )
                 { 
 
-                    //----------------------------------------------------------
-                    // phase5: coarse hash task, C=A*B
-                    //----------------------------------------------------------
+                    if (SaxpyTasks [taskid].use_esc)
+                    { 
+
+                        //------------------------------------------------------
+                        // phase5: coarse ESC task, C=A*B
+                        //------------------------------------------------------
+
+                        // C(:,j) is computed in sorted order
+                        #include "GB_AxB_saxpy3_coarseESC_phase5.c"
 
-                    // no mask present, or mask ignored (see below)
-                    #undef GB_CHECK_MASK_ij
-                    #include "GB_AxB_saxpy3_coarseHash_phase5.c"
+                    }
+                    else
+                    { 
+
+                        //------------------------------------------------------
+                        // phase5: coarse hash task, C=A*B
+                        //------------------------------------------------------
+
+                        // no mask present, or mask ignored (see below)
+                        #undef GB_CHECK_MASK_ij
+                        #include "GB_AxB_saxpy3_coarseHash_phase5.c"
+                    }
 
                 }
                 #elif ( !GB_MASK_COMP )
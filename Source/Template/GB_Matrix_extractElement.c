@@ -43,6 +43,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     // If found (live or zombie), no need to wait.  If not found and pending
     // tuples exist, wait and then extractElement again.
 
+    // finish any work deferred by this thread (see GB_deferred.c)
+    GB_DEFERRED_FLUSH ;
+
     // delete any lingering zombies, assemble any pending tuples, and unjumble
     if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
     { 
@@ -85,7 +88,17 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     bool found ;
     const int64_t *restrict Ap = A->p ;
 
-    if (Ap != NULL)
+    if (A->magic == GB_MAGIC_PACKED)
+    { 
+
+        //----------------------------------------------------------------------
+        // A is packed: find A(i,j) without unpacking A
+        //----------------------------------------------------------------------
+
+        found = GB_packed_find (&pleft, A, i, j) ;
+
+    }
+    else if (Ap != NULL)
     {
 
         //----------------------------------------------------------------------
@@ -38,6 +38,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
+    // finish any work deferred by this thread (see GB_deferred.c)
+    GB_DEFERRED_FLUSH ;
+
     // delete any lingering zombies, assemble any pending tuples, and unjumble
     if (GB_ANY_PENDING_WORK (V))
     { 
@@ -64,7 +67,12 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     bool found ;
     const int64_t *restrict Vp = V->p ;
 
-    if (Vp != NULL)
+    if (V->magic == GB_MAGIC_PACKED)
+    { 
+        // V is packed: find V(i) without unpacking V
+        found = GB_packed_find (&pleft, (GrB_Matrix) V, i, 0) ;
+    }
+    else if (Vp != NULL)
     { 
         // V is sparse
         pleft = 0 ;
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel.h: definitions for all CPU JIT kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Each CPU JIT kernel is a single file written by GB_jitifyer.  It #include's
+// this file, then the macros constructed by GB_macrofy_*, and finally one of
+// the GB_jit_kernel_*.c files, which defines the kernel function
+// GB_jit_kernel.  The kernel is compiled into a shared library that resolves
+// its references to internal GraphBLAS methods (GB_werk_push, GB_ek_slice,
+// and so on) from the GraphBLAS library that loads it.
+
+#ifndef GB_JIT_KERNEL_H
+#define GB_JIT_KERNEL_H
+
+// JIT kernels do not use run-time CPU feature tests, and the cpu_features
+// headers are not on the JIT include path
+#undef  GBNCPUFEAT
+#define GBNCPUFEAT 1
+
+#include "GB.h"
+#include "GB_sort.h"
+#include "GB_atomics.h"
+#include "GB_AxB_saxpy.h"
+#include "GB_emult.h"
+#include "GB_ek_slice.h"
+#include "GB_unused.h"
+#include "GB_bitmap_assign_methods.h"
+#include "GB_ek_slice_search.c"
+
+// user-defined operators are copied verbatim into the kernel, and need not
+// have prototypes
+#if GB_COMPILER_GCC && !defined ( __cplusplus )
+#pragma GCC diagnostic ignored "-Wmissing-prototypes"
+#endif
+
+#endif
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_dot2.c: JIT kernel for C=A'*B, C<M>=A'*B, C<!M>=A'*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C is bitmap.  If A_not_transposed is true, then C=A*B is computed where A
+// is bitmap or full.  Same as GB_Adot2B in Generated2/GB_AxB__*.c.
+
+#include "GB_jit_kernel_mxm.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool A_not_transposed,
+    const GrB_Matrix A, int64_t *restrict A_slice,
+    const GrB_Matrix B, int64_t *restrict B_slice,
+    int nthreads, int naslice, int nbslice
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool A_not_transposed,
+    const GrB_Matrix A, int64_t *restrict A_slice,
+    const GrB_Matrix B, int64_t *restrict B_slice,
+    int nthreads, int naslice, int nbslice
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    #include "GB_AxB_dot2_meta.c"
+    return (GrB_SUCCESS) ;
+}
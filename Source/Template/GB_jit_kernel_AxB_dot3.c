@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_dot3.c: JIT kernel for C<M>=A'*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C and M are sparse or hypersparse.  Same as GB_Adot3B in
+// Generated2/GB_AxB__*.c.
+
+#include "GB_jit_kernel_mxm.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    #include "GB_AxB_dot3_meta.c"
+    return (GrB_SUCCESS) ;
+}
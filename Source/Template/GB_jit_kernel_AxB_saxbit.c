@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_saxbit.c: JIT kernel for C<#M>=A*B, C bitmap or full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Saxpy method where C is bitmap or full.  Same as GB_AsaxbitB in
+// Generated2/GB_AxB__*.c.
+
+#include "GB_jit_kernel_mxm.h"
+#include "GB_AxB_saxpy3_template.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,   // bitmap or full
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,   // bitmap or full
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_Context Context
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    #include "GB_bitmap_AxB_saxpy_template.c"
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,203 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_AxB_saxpy3.c: JIT kernel for C<#M>=A*B, C sparse or hyper
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Saxpy3 method (Gustavson + Hash).  Same as GB_Asaxpy3B in
+// Generated2/GB_AxB__*.c.
+
+#include "GB_jit_kernel_mxm.h"
+#include "GB_AxB_saxpy3_template.h"
+
+//------------------------------------------------------------------------------
+// GB_jit_saxpy3_M: C<M>=A*B
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_jit_saxpy3_M
+(
+    GrB_Matrix C,   // C<M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Context Context
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 0
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 0
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jit_saxpy3_noM: C=A*B
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_jit_saxpy3_noM
+(
+    GrB_Matrix C,   // C=A*B, C sparse or hypersparse
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Context Context
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 1
+        #define GB_MASK_COMP 0
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 1
+        #define GB_MASK_COMP 0
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jit_saxpy3_notM: C<!M>=A*B
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_jit_saxpy3_notM
+(
+    GrB_Matrix C,   // C<!M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads,
+    const int do_sort,
+    GB_Context Context
+)
+{
+    GB_JIT_DECLARE_MONOID ;
+    if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
+    {
+        // both A and B are sparse
+        #define GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 1
+        #define GB_A_IS_SPARSE 1
+        #define GB_A_IS_HYPER  0
+        #define GB_A_IS_BITMAP 0
+        #define GB_A_IS_FULL   0
+        #define GB_B_IS_SPARSE 1
+        #define GB_B_IS_HYPER  0
+        #define GB_B_IS_BITMAP 0
+        #define GB_B_IS_FULL   0
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    else
+    {
+        // general case
+        #undef GB_META16
+        #define GB_NO_MASK 0
+        #define GB_MASK_COMP 1
+        #include "GB_meta16_definitions.h"
+        #include "GB_AxB_saxpy3_template.c"
+    }
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_jit_kernel: C<#M>=A*B via saxpy3
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,   // C<any M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads, const int do_sort,
+    GB_Context Context
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,   // C<any M>=A*B, C sparse or hypersparse
+    const GrB_Matrix M, const bool Mask_comp, const bool Mask_struct,
+    const bool M_in_place,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    GB_saxpy3task_struct *restrict SaxpyTasks,
+    const int ntasks, const int nfine, const int nthreads, const int do_sort,
+    GB_Context Context
+)
+{
+    if (M == NULL)
+    { 
+        // C = A*B, no mask
+        return (GB_jit_saxpy3_noM (C, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Context)) ;
+    }
+    else if (!Mask_comp)
+    { 
+        // C<M> = A*B
+        return (GB_jit_saxpy3_M (C,
+            M, Mask_struct, M_in_place, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Context)) ;
+    }
+    else
+    { 
+        // C<!M> = A*B
+        return (GB_jit_saxpy3_notM (C,
+            M, Mask_struct, M_in_place, A, B,
+            SaxpyTasks, ntasks, nfine, nthreads, do_sort, Context)) ;
+    }
+}
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_add.c: JIT kernel for C=A+B, C<#M>=A+B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_AaddB in Generated2/GB_binop__*.c.
+
+#include "GB_jit_kernel_ewise.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool is_eWiseUnion,
+    const GB_void *alpha_scalar_in,
+    const GB_void *beta_scalar_in,
+    const bool Ch_is_Mh,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+)
+{
+    GB_WERK_DECLARE (M_ek_slicing, int64_t) ;
+    GB_WERK_DECLARE (A_ek_slicing, int64_t) ;
+    GB_WERK_DECLARE (B_ek_slicing, int64_t) ;
+    GB_X_TYPENAME alpha_scalar ;
+    GB_Y_TYPENAME beta_scalar ;
+    if (is_eWiseUnion)
+    {
+        alpha_scalar = (*((GB_X_TYPENAME *) alpha_scalar_in)) ;
+        beta_scalar  = (*((GB_Y_TYPENAME *) beta_scalar_in )) ;
+    }
+    #include "GB_add_template.c"
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
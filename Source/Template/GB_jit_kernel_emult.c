@@ -0,0 +1,54 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_emult.c: JIT kernel for C=A.*B, C<#M>=A.*B, C sparse/hyper
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_AemultB in Generated2/GB_binop__*.c.
+
+#include "GB_jit_kernel_ewise.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int C_sparsity,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict C_to_M,
+    const int64_t *restrict C_to_A,
+    const int64_t *restrict C_to_B,
+    const GB_task_struct *restrict TaskList,
+    const int C_ntasks,
+    const int C_nthreads,
+    GB_Context Context
+)
+{
+    #include "GB_emult_meta.c"
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,41 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_emult_02.c: JIT kernel for C<#M>=A.*B, A sparse/hyper, B full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_AemultB_02 in Generated2/GB_binop__*.c.  If flipxy is true,
+// A and B have been swapped by the caller, and GB_EWISEOP is flipped.
+
+#include "GB_jit_kernel_ewise.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+)
+{
+    #include "GB_emult_02_template.c"
+    return (GrB_SUCCESS) ;
+}
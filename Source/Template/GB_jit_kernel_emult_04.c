@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_emult_04.c: JIT kernel for C<M>=A.*B, A and B bitmap/full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_AemultB_04 in Generated2/GB_binop__*.c.
+
+#include "GB_jit_kernel_ewise.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *restrict Cp_kfirst,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads
+)
+{
+    #include "GB_emult_04_template.c"
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,44 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_emult_bitmap.c: JIT kernel for C=A.*B, C<#M>=A.*B, C bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_AemultB_bitmap in Generated2/GB_binop__*.c.
+
+#include "GB_jit_kernel_ewise.h"
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GrB_Matrix C,
+    const int ewise_method,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const bool Mask_comp,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *M_ek_slicing, const int M_ntasks, const int M_nthreads,
+    const int C_nthreads,
+    GB_Context Context
+)
+{
+    #include "GB_bitmap_emult_template.c"
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_ewise.h: factory-kernel macros for a JIT ewise kernel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_macrofy_ewise defines the binary operator (GB_EWISEOP) and the types of
+// C, A, and B.  This file defines the macros used by the templates for the
+// pre-compiled kernels in Generated2/GB_binop__*.c, in terms of the macrofied
+// operator, so that the same templates can be used for the JIT kernels.
+
+// As for the mxm kernels, the sparsity structures of C, M, A, and B, the mask,
+// and the iso properties of A and B are handled at run time.  No typecasting
+// is done: the types of A and B match the inputs of the operator (unless their
+// values are not accessed), and the type of C matches its output.  For
+// eWiseAdd, the types of A, B, and C are the same.  If flipxy is true (for
+// emult_02 only), GB_EWISEOP is already flipped.
+
+#ifndef GB_JIT_KERNEL_EWISE_H
+#define GB_JIT_KERNEL_EWISE_H
+
+//------------------------------------------------------------------------------
+// remove macrofied definitions that conflict with the templates
+//------------------------------------------------------------------------------
+
+#undef GB_PUTC
+#undef GB_C_ISO
+#undef GB_A_ISO
+#undef GB_B_ISO
+#undef GB_C_IS_HYPER
+#undef GB_C_IS_SPARSE
+#undef GB_C_IS_BITMAP
+#undef GB_C_IS_FULL
+#undef GB_M_IS_HYPER
+#undef GB_M_IS_SPARSE
+#undef GB_M_IS_BITMAP
+#undef GB_M_IS_FULL
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+#undef GB_B_IS_HYPER
+#undef GB_B_IS_SPARSE
+#undef GB_B_IS_BITMAP
+#undef GB_B_IS_FULL
+#undef GB_MTYPE
+#undef MX
+#undef GB_MASK_STRUCT
+#undef GB_MASK_COMP
+#undef GB_NO_MASK
+
+//------------------------------------------------------------------------------
+// types of C, A, and B
+//------------------------------------------------------------------------------
+
+// Ax and Bx are always typed, since eWiseAdd copies them into C even if the
+// operator does not access them
+#define GB_ATYPE GB_A_TYPENAME
+#define GB_BTYPE GB_B_TYPENAME
+#define GB_CTYPE GB_C_TYPENAME
+
+//------------------------------------------------------------------------------
+// access A, B, and C
+//------------------------------------------------------------------------------
+
+#if GB_A_IS_PATTERN
+    // aij = Ax [pA] is not needed
+    #define GB_GETA(aij,Ax,pA,A_iso)
+#else
+    // aij = Ax [pA]
+    #define GB_GETA(aij,Ax,pA,A_iso) GB_ATYPE aij = GBX (Ax, pA, A_iso)
+#endif
+
+#if GB_B_IS_PATTERN
+    // bij = Bx [pB] is not needed
+    #define GB_GETB(bij,Bx,pB,B_iso)
+#else
+    // bij = Bx [pB]
+    #define GB_GETB(bij,Bx,pB,B_iso) GB_BTYPE bij = GBX (Bx, pB, B_iso)
+#endif
+
+// cij = Ax [pA]
+#define GB_COPY_A_TO_C(cij,Ax,pA,A_iso) cij = GBX (Ax, pA, A_iso)
+
+// cij = Bx [pB]
+#define GB_COPY_B_TO_C(cij,Bx,pB,B_iso) cij = GBX (Bx, pB, B_iso)
+
+#define GB_CX(p) Cx [p]
+
+//------------------------------------------------------------------------------
+// the binary operator
+//------------------------------------------------------------------------------
+
+// z = op (x,y), where z is C(i,j)
+#define GB_BINOP(z,x,y,i,j) GB_EWISEOP (z, x, y, i, 0, j)
+
+// flipxy is handled by GB_EWISEOP, not by the templates
+#define GB_FLIPPED 0
+#define GB_BINOP_FLIP 0
+
+// for C=A+B when A, B, and M are the same matrix: load B if A is not accessed
+#define GB_OP_IS_SECOND GB_A_IS_PATTERN
+
+// do the numerical phases of GB_add and GB_emult
+#define GB_PHASE_2_OF_2
+
+#define GB_PRAGMA_SIMD_VECTORIZE GB_PRAGMA_SIMD
+
+#define GB_DISABLE 0
+
+#endif
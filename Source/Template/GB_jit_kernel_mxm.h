@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_mxm.h: factory-kernel macros for a JIT mxm kernel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_macrofy_mxm defines the semiring (GB_ADD, GB_MULT, and the monoid
+// identity and terminal values) and the types of C, A, and B.  This file
+// defines the macros used by the templates for the pre-compiled kernels in
+// Generated2/GB_AxB__*.c, in terms of the macrofied semiring, so that the same
+// templates can be used for the JIT kernels.
+
+// The JIT kernels do not depend on the sparsity structure of the matrices,
+// the mask, or the iso properties of A and B; those are handled at run time
+// by the templates, just as they are for the pre-compiled kernels.  No
+// typecasting is done: the type of A matches the x or y input of the
+// multiplicative operator (unless A is not accessed), and likewise for B.
+
+#ifndef GB_JIT_KERNEL_MXM_H
+#define GB_JIT_KERNEL_MXM_H
+
+//------------------------------------------------------------------------------
+// remove macrofied definitions that conflict with the templates
+//------------------------------------------------------------------------------
+
+#undef GB_PUTC
+#undef GB_C_ISO
+#undef GB_A_ISO
+#undef GB_B_ISO
+#undef GB_C_IS_HYPER
+#undef GB_C_IS_SPARSE
+#undef GB_C_IS_BITMAP
+#undef GB_C_IS_FULL
+#undef GB_M_IS_HYPER
+#undef GB_M_IS_SPARSE
+#undef GB_M_IS_BITMAP
+#undef GB_M_IS_FULL
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+#undef GB_B_IS_HYPER
+#undef GB_B_IS_SPARSE
+#undef GB_B_IS_BITMAP
+#undef GB_B_IS_FULL
+#undef GB_MTYPE
+#undef MX
+#undef GB_MASK_STRUCT
+#undef GB_MASK_COMP
+#undef GB_NO_MASK
+
+//------------------------------------------------------------------------------
+// types of C, A, and B
+//------------------------------------------------------------------------------
+
+#define GB_CTYPE GB_C_TYPENAME
+#define GB_CSIZE sizeof (GB_CTYPE)
+
+#if GB_A_IS_PATTERN
+#define GB_ATYPE GB_void
+#else
+#define GB_ATYPE GB_A_TYPENAME
+#endif
+#define GB_ASIZE sizeof (GB_ATYPE)
+
+#if GB_B_IS_PATTERN
+#define GB_BTYPE GB_void
+#else
+#define GB_BTYPE GB_B_TYPENAME
+#endif
+#define GB_BSIZE sizeof (GB_BTYPE)
+
+// true for int64, uint64, float, double, float complex, and double complex
+#define GB_CTYPE_IGNORE_OVERFLOW GB_ZTYPE_IGNORE_OVERFLOW
+
+// cast from a real scalar to the type of C (for PLUS_PAIR only)
+#define GB_CTYPE_CAST(x,y) ((GB_CTYPE) (x))
+
+//------------------------------------------------------------------------------
+// access A and B
+//------------------------------------------------------------------------------
+
+#if GB_A_IS_PATTERN
+    // aik = Ax [pA] is not needed
+    #define GB_GETA(aik,Ax,pA,A_iso)
+    #define GB_LOADA(Gx,pG,Ax,pA,A_iso)
+#else
+    // aik = Ax [pA]
+    #define GB_GETA(aik,Ax,pA,A_iso) GB_ATYPE aik = GBX (Ax, pA, A_iso)
+    // Gx [pG] = Ax [pA]
+    #define GB_LOADA(Gx,pG,Ax,pA,A_iso) Gx [pG] = GBX (Ax, pA, A_iso)
+#endif
+
+#if GB_B_IS_PATTERN
+    // bkj = Bx [pB] is not needed
+    #define GB_GETB(bkj,Bx,pB,B_iso)
+    #define GB_LOADB(Gx,pG,Bx,pB,B_iso)
+#else
+    // bkj = Bx [pB]
+    #define GB_GETB(bkj,Bx,pB,B_iso) GB_BTYPE bkj = GBX (Bx, pB, B_iso)
+    // Gx [pG] = Bx [pB]
+    #define GB_LOADB(Gx,pG,Bx,pB,B_iso) Gx [pG] = GBX (Bx, pB, B_iso)
+#endif
+
+//------------------------------------------------------------------------------
+// the semiring
+//------------------------------------------------------------------------------
+
+// multiply-add: z += x*y
+#define GB_MULTADD(z,x,y,i,k,j)                 \
+{                                               \
+    GB_CTYPE x_op_y ;                           \
+    GB_MULT (x_op_y, x, y, i, k, j) ;           \
+    GB_ADD (z, z, x_op_y) ;                     \
+}
+
+// the monoid identity value is held in a local variable, declared by each
+// kernel with GB_DECLARE_MONOID_IDENTITY (zidentity)
+#define GB_IDENTITY zidentity
+#define GB_HAS_IDENTITY_BYTE 0
+#define GB_IDENTITY_BYTE (none)
+
+// break if cij reaches the terminal value (dot product only); the terminal
+// value is declared by each kernel with GB_DECLARE_MONOID_TERMINAL (zterminal)
+#define GB_DOT_TERMINAL(cij) GB_IF_TERMINAL_BREAK (cij, zterminal)
+
+// no vectorization
+#define GB_PRAGMA_SIMD_DOT(cij) ;
+#define GB_PRAGMA_SIMD_VECTORIZE ;
+#define GB_SEMIRING_HAS_AVX_IMPLEMENTATION 0
+
+//------------------------------------------------------------------------------
+// C and the Hx workspace
+//------------------------------------------------------------------------------
+
+#define GB_CX(p) Cx [p]
+
+// declare the cij scalar (initialize cij to zero for PLUS_PAIR, since the
+// dot product templates then compute cij with cij++)
+#if GB_IS_PLUS_PAIR_REAL_SEMIRING
+#define GB_CIJ_DECLARE(cij) GB_CTYPE cij = 0
+#else
+#define GB_CIJ_DECLARE(cij) GB_CTYPE cij
+#endif
+
+// Cx [p] = cij
+#define GB_PUTC(cij,p) Cx [p] = cij
+
+// Cx [p] = t
+#define GB_CIJ_WRITE(p,t) Cx [p] = t
+
+// Cx [p] += t
+#define GB_CIJ_UPDATE(p,t) GB_ADD (Cx [p], Cx [p], t)
+
+// Hx [i] = t
+#define GB_HX_WRITE(i,t) Hx [i] = t
+
+// Cx [p] = Hx [i]
+#define GB_CIJ_GATHER(p,i) Cx [p] = Hx [i]
+
+// Cx [p] += Hx [i]
+#define GB_CIJ_GATHER_UPDATE(p,i) GB_ADD (Cx [p], Cx [p], Hx [i])
+
+// Hx [i] += t
+#define GB_HX_UPDATE(i,t) GB_ADD (Hx [i], Hx [i], t)
+
+// memcpy (&(Cx [p]), &(Hx [i]), len)
+#define GB_CIJ_MEMCPY(p,i,len) \
+    memcpy (Cx +(p), Hx +(i), (len) * sizeof (GB_CTYPE))
+
+//------------------------------------------------------------------------------
+// special cases (none are used by the JIT)
+//------------------------------------------------------------------------------
+
+// the monoid update is done in a critical section, as for the generic case
+#define GB_HAS_ATOMIC 0
+#define GB_HAS_OMP_ATOMIC 0
+
+#define GB_CTYPE_BITS 0
+#define GB_IS_ANY_MONOID 0
+#define GB_IS_EQ_MONOID 0
+#define GB_IS_ANY_PAIR_SEMIRING 0
+#define GB_IS_PAIR_MULTIPLIER 0
+#define GB_IS_PLUS_FC32_MONOID 0
+#define GB_IS_PLUS_FC64_MONOID 0
+#define GB_IS_ANY_FC32_MONOID 0
+#define GB_IS_ANY_FC64_MONOID 0
+#define GB_IS_IMIN_MONOID 0
+#define GB_IS_IMAX_MONOID 0
+#define GB_IS_FMIN_MONOID 0
+#define GB_IS_FMAX_MONOID 0
+#define GB_IS_FIRSTI_MULTIPLIER 0
+#define GB_IS_FIRSTJ_MULTIPLIER 0
+#define GB_IS_SECONDJ_MULTIPLIER 0
+#define GB_OFFSET 0
+
+#define GB_DISABLE 0
+
+//------------------------------------------------------------------------------
+// monoid identity and terminal values for each kernel
+//------------------------------------------------------------------------------
+
+#define GB_JIT_DECLARE_MONOID                   \
+    GB_DECLARE_MONOID_IDENTITY (zidentity) ;    \
+    GB_DECLARE_MONOID_TERMINAL (zterminal) ;
+
+#endif
@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_reduce.c: JIT kernel for s = reduce_to_scalar (A)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_red_scalar in Generated2/GB_red__*.c, except that the monoid is
+// defined by GB_macrofy_reduce.  A is not iso, and its type is the same as
+// the monoid type, so no typecasting is done.  The kernel handles any
+// sparsity structure of A at run time.  The panel method is used if A has no
+// zombies and is not bitmap, and if the monoid type is built-in.
+
+//------------------------------------------------------------------------------
+// remove macrofied definitions not used by the templates
+//------------------------------------------------------------------------------
+
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+
+//------------------------------------------------------------------------------
+// macros for the reduction templates
+//------------------------------------------------------------------------------
+
+// type of A and the monoid (they are the same)
+#define GB_ATYPE GB_A_TYPENAME
+
+// ztype t = identity
+#define GB_SCALAR_IDENTITY(t) GB_DECLARE_MONOID_IDENTITY (t)
+
+// t += Ax [p], no typecast
+#define GB_ADD_CAST_ARRAY_TO_SCALAR(t,Ax,p) GB_ADD (t, t, Ax [p])
+
+// s += W [k], no typecast
+#define GB_ADD_ARRAY_TO_SCALAR(s,W,k) GB_ADD (s, s, W [k])
+
+// W [k] += Ax [p], no typecast
+#define GB_ADD_ARRAY_TO_ARRAY(W,k,Ax,p) GB_ADD (W [k], W [k], Ax [p])
+
+// W [k] = s, no typecast
+#define GB_COPY_SCALAR_TO_ARRAY(W,k,s) W [k] = s
+
+// break the loop if the terminal value is reached; zterminal is declared by
+// the kernel with GB_DECLARE_MONOID_TERMINAL
+#define GB_HAS_TERMINAL GB_MONOID_IS_TERMINAL
+#define GB_IS_TERMINAL(s) GB_TERMINAL_CONDITION (s, zterminal)
+#define GB_TERMINAL_VALUE zterminal
+
+//------------------------------------------------------------------------------
+// reduce a non-iso matrix to a scalar
+//------------------------------------------------------------------------------
+
+GrB_Info GB_jit_kernel
+(
+    GB_void *result,
+    const GrB_Matrix A,
+    GB_void *restrict W_space,
+    bool *restrict F,
+    int ntasks,
+    int nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    GB_void *result,
+    const GrB_Matrix A,
+    GB_void *restrict W_space,
+    bool *restrict F,
+    int ntasks,
+    int nthreads
+)
+{
+    GB_DECLARE_MONOID_TERMINAL (zterminal) ;
+    GB_Z_TYPENAME s ;
+    memcpy (&s, result, sizeof (GB_Z_TYPENAME)) ;
+    GB_Z_TYPENAME *restrict W = (GB_Z_TYPENAME *) W_space ;
+    #if GB_PANEL > 1
+    if (A->nzombies == 0 && !GB_IS_BITMAP (A))
+    { 
+        #include "GB_reduce_panel.c"
+    }
+    else
+    #endif
+    { 
+        #include "GB_reduce_to_scalar_template.c"
+    }
+    memcpy (result, &s, sizeof (GB_Z_TYPENAME)) ;
+    return (GrB_SUCCESS) ;
+}
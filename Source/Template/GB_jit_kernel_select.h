@@ -0,0 +1,55 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_select.h: factory-kernel macros for a JIT select kernel
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_macrofy_select defines the user-defined index unary operator (GB_IDXUNOP)
+// and the types of A and the thunk y.  This file defines the macros used by
+// the select templates, in the same way as the GB_sel__idxunop_any workers in
+// Generated1/, except that the operator is inlined rather than called through
+// a function pointer.  A is not iso, and the type of A matches the x input of
+// the operator, so no typecasting is done.
+
+#ifndef GB_JIT_KERNEL_SELECT_H
+#define GB_JIT_KERNEL_SELECT_H
+
+//------------------------------------------------------------------------------
+// remove macrofied definitions not used by the templates
+//------------------------------------------------------------------------------
+
+#undef GB_A_IS_HYPER
+#undef GB_A_IS_SPARSE
+#undef GB_A_IS_BITMAP
+#undef GB_A_IS_FULL
+
+//------------------------------------------------------------------------------
+// the select operator
+//------------------------------------------------------------------------------
+
+// A is not iso
+#define GB_ISO_SELECT 0
+
+// kind
+#define GB_ENTRY_SELECTOR
+
+#define GB_ATYPE GB_A_TYPENAME
+
+// test value of Ax [p]; the thunk y is declared by each kernel with
+// GB_DECLARE_THUNK (y)
+#define GB_TEST_VALUE_OF_ENTRY(keep,p)                  \
+    bool keep ; GB_IDXUNOP (keep, Ax [p], i, j, y)
+
+// Cx [pC] = Ax [pA], no typecast
+#define GB_SELECT_ENTRY(Cx,pC,Ax,pA)                    \
+    ((GB_ATYPE *) (Cx)) [pC] = Ax [pA]
+
+// y = (op->ytype) thunk, already typecasted by GB_selector
+#define GB_DECLARE_THUNK(y)                             \
+    GB_Y_TYPENAME y ;                                   \
+    memcpy (&y, ythunk, sizeof (GB_Y_TYPENAME))
+
+#endif
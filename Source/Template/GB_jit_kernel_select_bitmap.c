@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_select_bitmap.c: JIT kernel for C=select(A,y), C bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_sel_bitmap__idxunop_any in Generated1/GB_sel__idxunop_any.c.
+
+#include "GB_jit_kernel_select.h"
+
+GrB_Info GB_jit_kernel
+(
+    int8_t *Cb,
+    GB_void *restrict Cx,
+    int64_t *cnvals_handle,
+    GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    int8_t *Cb,
+    GB_void *restrict Cx,
+    int64_t *cnvals_handle,
+    GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int nthreads
+)
+{
+    GB_DECLARE_THUNK (y) ;
+    #include "GB_bitmap_select_template.c"
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,37 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_select_phase1.c: JIT kernel to count entries for C=select(A,y)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_sel_phase1__idxunop_any in Generated1/GB_sel__idxunop_any.c.
+
+#include "GB_jit_kernel_select.h"
+
+GrB_Info GB_jit_kernel
+(
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    int64_t *restrict Cp,
+    int64_t *restrict Wfirst,
+    int64_t *restrict Wlast,
+    const GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+)
+{
+    GB_DECLARE_THUNK (y) ;
+    #include "GB_select_phase1.c"
+    return (GrB_SUCCESS) ;
+}
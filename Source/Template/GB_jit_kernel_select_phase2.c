@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_select_phase2.c: JIT kernel to select entries for C=select(A,y)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Same as GB_sel_phase2__idxunop_any in Generated1/GB_sel__idxunop_any.c.
+
+#include "GB_jit_kernel_select.h"
+
+GrB_Info GB_jit_kernel
+(
+    int64_t *restrict Ci,
+    GB_void *restrict Cx,
+    const int64_t *restrict Cp,
+    const int64_t *restrict Cp_kfirst,
+    const GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+) ;
+
+GrB_Info GB_jit_kernel
+(
+    int64_t *restrict Ci,
+    GB_void *restrict Cx,
+    const int64_t *restrict Cp,
+    const int64_t *restrict Cp_kfirst,
+    const GrB_Matrix A,
+    const GB_void *restrict ythunk,
+    const int64_t *A_ek_slicing, const int A_ntasks, const int A_nthreads
+)
+{
+    GB_DECLARE_THUNK (y) ;
+    #include "GB_select_phase2.c"
+    return (GrB_SUCCESS) ;
+}
@@ -302,6 +302,68 @@ GrB_Matrix Y ;      // Y is a matrix that represents the inverse of A->h.
                     // hypersparse matrices need the A->Y matrix.  It is
                     // constructed whenever it is needed.
 
+//------------------------------------------------------------------------------
+// cached transpose
+//------------------------------------------------------------------------------
+
+// If A->transpose_cache is true (set by GxB_Matrix_Option_set with the
+// GxB_TRANSPOSE_CACHE option), then A->T is a matrix that holds the transpose
+// of A, with the same type and the same CSR/CSC format as A.  It is
+// constructed by GB_transpose_cache_get when A' is first needed, and freed
+// whenever A is modified (see GB_transpose_cache_free).  A->T is always
+// NULL for shallow matrices, and A->T itself never has a cached transpose.
+
+// If A->dual_format is also true (GxB_DUAL_FORMAT), A->T is the second format
+// of A, and it is not freed by GrB_Matrix_setElement or
+// GrB_Matrix_removeElement.  Instead, those methods apply the same update to
+// A->T, which can then have pending work of its own (see GB_dual_setElement).
+// GB_wait finishes the pending work in both A and A->T.
+
+GrB_Matrix T ;      // T = A', if cached, or NULL otherwise
+
+//------------------------------------------------------------------------------
+// packed bitmap
+//------------------------------------------------------------------------------
+
+// If A->bitmap_packed is true (set by GxB_Matrix_Option_set with the
+// GxB_BITMAP_PACKED option) and A is bitmap, GrB_Matrix_wait packs A->b into
+// an array of uint64_t words, with one bit per entry (see GB_bitmap_pack).
+// A->b_size is the size of the packed array, and A->magic is GB_MAGIC_PACKED.
+// The packed bitmap is unpacked when A is next passed to any user-callable
+// method (see GB_RETURN_IF_FAULTY and GB_bitmap_unpack), except for
+// GrB_eWiseMult and GrB_eWiseAdd of packed iso matrices, which operate on the
+// packed bitmaps directly, 64 entries at a time (see GB_bitmap_packed_ewise).
+
+//------------------------------------------------------------------------------
+// 32-bit indices
+//------------------------------------------------------------------------------
+
+// If A->index32 is true (set by GxB_Matrix_Option_set with the GxB_INDEX_32
+// option, or from the global default) and A is sparse or hypersparse, with
+// dimensions and nvals(A) all less than 2^31, GrB_Matrix_wait narrows A->p,
+// A->h, and A->i to int32_t (see GB_index32_pack).  A->p_size, A->h_size, and
+// A->i_size are the sizes of the int32_t arrays, and A->magic is
+// GB_MAGIC_PACKED, as for a packed bitmap.  Since A->b is NULL, the two cases
+// are distinguished (see GB_packed_unpack).  The arrays are widened back to
+// int64_t when A is modified or exported, and a widened copy is used when A is
+// an input (see GB_packed_view).  No kernel reads the int32_t arrays.
+
+//------------------------------------------------------------------------------
+// saxpy3 plan
+//------------------------------------------------------------------------------
+
+// If A->keep_plan is true (set by GxB_Matrix_Option_set with the GxB_AxB_PLAN
+// option), and A is the output of a GrB_mxm that computes A=X*Y with the
+// saxpy3 method and no mask, the tasks and the symbolic analysis of X*Y are
+// kept in A->saxpy3_plan, with a copy of the patterns of X and Y (see
+// GB_AxB_saxpy3_plan_save).  A later A=X*Y with the same patterns reuses
+// them, and only the numeric phases are done.  The plan is not freed when A
+// is modified, since it depends only on X and Y, and it is checked before it
+// is used (see GB_AxB_saxpy3_plan_match).  It is freed by GrB_Matrix_free,
+// or when the option is set to false (see GB_AxB_saxpy3_plan_free).
+
+struct GB_saxpy3_plan_struct *saxpy3_plan ;     // plan, or NULL
+
 //------------------------------------------------------------------------------
 // pending tuples
 //------------------------------------------------------------------------------
@@ -481,6 +543,12 @@ bool static_header ;    // true if this struct is statically allocated
 bool is_csc ;           // true if stored by column, false if by row
 bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
                         // matrices are never jumbled.
+bool transpose_cache ;  // true if A->T may be constructed and kept
+bool dual_format ;      // true if A->T is also updated by setElement
+bool bitmap_packed ;    // true if A->b is packed into bits by GrB_Matrix_wait
+bool index32 ;          // true if A->[phi] are held as int32_t by
+                        // GrB_Matrix_wait, when A is sparse or hypersparse
+bool keep_plan ;        // true if A->saxpy3_plan may be constructed and kept
 
 //------------------------------------------------------------------------------
 // iso matrices
@@ -0,0 +1,215 @@
+//------------------------------------------------------------------------------
+// GB_mex_bitwise: test the bitwise saxpy for boolean semirings
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<!M>=A*B is computed with LOR_LAND, ANY_PAIR, and LOR_SECOND, for A sparse
+// or hypersparse and B bitmap or full with 1 to 130 columns, on 1 and 4
+// threads.  GB_AxB_saxpy_sparsity selects the bitwise saxpy (see
+// GB_AxB_saxpy_bitwise) for LOR_LAND and ANY_PAIR when B has at least 64
+// columns, and each result is compared with the same product computed with
+// the dot product method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_bitwise"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&M) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Descriptor_free_(&desc_dot) ;           \
+    GrB_Descriptor_free_(&desc_saxpy) ;         \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_BOOL, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// random_bool: create a random boolean matrix, with true and false values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_bool
+(
+    GrB_Matrix *A,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz,           // # of entries, or all entries if nz == m*n
+    int sparsity
+)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_BOOL, m, n) ;
+    if (nz == m*n)
+    {
+        for (GrB_Index j = 0 ; j < n && info == GrB_SUCCESS ; j++)
+        {
+            for (GrB_Index i = 0 ; i < m && info == GrB_SUCCESS ; i++)
+            {
+                info = GrB_Matrix_setElement_BOOL (*A,
+                    (simple_rand ( ) % 4) != 0, i, j) ;
+            }
+        }
+    }
+    else
+    {
+        for (GrB_Index k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+        {
+            info = GrB_Matrix_setElement_BOOL (*A, (simple_rand ( ) % 4) != 0,
+                simple_rand ( ) % m, simple_rand ( ) % n) ;
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Matrix_Option_set (*A, GxB_SPARSITY_CONTROL, sparsity) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_bitwise mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GrB_Descriptor desc_dot = NULL, desc_saxpy = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GB_CONTEXT (USAGE) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+
+    // desc_dot: C<!M>=A*B with the dot product method
+    OK (GrB_Descriptor_new (&desc_dot)) ;
+    OK (GxB_Desc_set (desc_dot, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+    OK (GxB_Desc_set (desc_dot, GrB_MASK, GrB_COMP)) ;
+    // desc_saxpy: C<!M>=A*B with the default method
+    OK (GrB_Descriptor_new (&desc_saxpy)) ;
+    OK (GxB_Desc_set (desc_saxpy, GrB_MASK, GrB_COMP)) ;
+
+    GrB_Semiring semirings [3] = { GrB_LOR_LAND_SEMIRING_BOOL,
+        GxB_ANY_PAIR_BOOL, GxB_LOR_SECOND_BOOL } ;
+    GrB_Index ncols [4] = { 1, 64, 100, 130 } ;
+    GrB_Index n = 500 ;
+    simple_rand_seed (1) ;
+    int nbitwise = 0 ;
+
+    //--------------------------------------------------------------------------
+    // C<!M>=A*B
+    //--------------------------------------------------------------------------
+
+    for (int ka = 0 ; ka <= 1 ; ka++)
+    {
+        OK (random_bool (&A, n, n, 3000,
+            (ka == 0) ? GxB_SPARSE : GxB_HYPERSPARSE)) ;
+        for (int kb = 0 ; kb <= 1 ; kb++)
+        {
+            for (int kc = 0 ; kc < 4 ; kc++)
+            {
+                GrB_Index ns = ncols [kc] ;
+                if (kb == 0)
+                {
+                    OK (random_bool (&B, n, ns, n*ns/2, GxB_BITMAP)) ;
+                }
+                else
+                {
+                    OK (random_bool (&B, n, ns, n*ns, GxB_FULL)) ;
+                }
+                OK (random_bool (&M, n, ns, n*ns/8, GxB_SPARSE)) ;
+                OK (GrB_Matrix_new (&D, GrB_BOOL, n, ns)) ;
+
+                for (int ks = 0 ; ks < 3 ; ks++)
+                {
+                    GrB_Semiring semiring = semirings [ks] ;
+
+                    // check if the bitwise saxpy is selected for C=A*B;
+                    // LOR_SECOND is not a bitwise semiring
+                    int C_sparsity, saxpy_method ;
+                    GB_AxB_saxpy_sparsity (&C_sparsity, &saxpy_method,
+                        NULL, false, A, B, semiring, Context) ;
+                    bool bitwise = (saxpy_method == GB_SAXPY_METHOD_BITWISE) ;
+                    CHECK (bitwise == (ns >= 64 && ks < 2)) ;
+                    nbitwise += bitwise ;
+
+                    for (int kmask = 0 ; kmask <= 1 ; kmask++)
+                    {
+                        GrB_Matrix Mask = (kmask == 0) ? NULL : M ;
+                        for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                        {
+                            OK (GxB_Global_Option_set (GxB_NTHREADS,
+                                nthreads)) ;
+                            OK (GrB_Matrix_new (&C1, GrB_BOOL, n, ns)) ;
+                            OK (GrB_Matrix_new (&C2, GrB_BOOL, n, ns)) ;
+                            OK (GrB_mxm (C1, Mask, NULL, semiring, A, B,
+                                desc_saxpy)) ;
+                            OK (GrB_mxm (C2, Mask, NULL, semiring, A, B,
+                                desc_dot)) ;
+                            CHECK (same_matrix (C1, C2, D)) ;
+                            OK (GrB_Matrix_free_(&C1)) ;
+                            OK (GrB_Matrix_free_(&C2)) ;
+                        }
+                    }
+                }
+
+                OK (GrB_Matrix_free_(&B)) ;
+                OK (GrB_Matrix_free_(&M)) ;
+                OK (GrB_Matrix_free_(&D)) ;
+            }
+        }
+        OK (GrB_Matrix_free_(&A)) ;
+    }
+
+    CHECK (nbitwise > 0) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_bitwise: all tests passed\n\n") ;
+}
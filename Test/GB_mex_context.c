@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+// GB_mex_context: test GxB_Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests GxB_Context_new, _set, _get, _engage, _disengage, _fprint, and _free,
+// the precedence of an engaged Context over the global settings, and that
+// each user thread sees only the Context it has engaged.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_context"
+
+#define NCONTEXT 4
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    for (int k = 0 ; k < NCONTEXT ; k++)        \
+    {                                           \
+        GxB_Context_free (&(Context [k])) ;     \
+    }                                           \
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GxB_Context Context [NCONTEXT] ;
+    for (int k = 0 ; k < NCONTEXT ; k++)
+    {
+        Context [k] = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_global_save ;
+    double chunk_global_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_global_save)) ;
+    OK (GxB_Global_Option_get (GxB_CHUNK, &chunk_global_save)) ;
+    OK (GxB_Global_Option_set (GxB_NTHREADS, 5)) ;
+    OK (GxB_Global_Option_set (GxB_CHUNK, (double) 2000)) ;
+
+    //--------------------------------------------------------------------------
+    // create the Contexts, and check their settings
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < NCONTEXT ; k++)
+    {
+        OK (GxB_Context_new (&(Context [k]))) ;
+        int nthreads = -1 ;
+        double chunk = -1 ;
+        OK (GxB_Context_get (Context [k], GxB_CONTEXT_NTHREADS, &nthreads)) ;
+        OK (GxB_Context_get (Context [k], GxB_CONTEXT_CHUNK, &chunk)) ;
+        CHECK (nthreads == GxB_DEFAULT) ;
+        CHECK (chunk == GxB_DEFAULT) ;
+        OK (GxB_Context_set (Context [k], GxB_CONTEXT_NTHREADS, k+1)) ;
+        OK (GxB_Context_set (Context [k], GxB_CONTEXT_CHUNK,
+            (double) (1000 * (k+1)))) ;
+        OK (GxB_Context_get (Context [k], GxB_CONTEXT_NTHREADS, &nthreads)) ;
+        OK (GxB_Context_get (Context [k], GxB_CONTEXT_CHUNK, &chunk)) ;
+        CHECK (nthreads == k+1) ;
+        CHECK (chunk == 1000 * (k+1)) ;
+        OK (GxB_Context_fprint (Context [k], "context", GxB_SILENT, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Context_new (NULL)) ;
+    ERR (GxB_Context_engage (NULL)) ;
+    ERR (GxB_Context_set (NULL, GxB_CONTEXT_NTHREADS, 1)) ;
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set (Context [0], (GxB_Context_Field) GxB_FORMAT, 1)) ;
+    ERR (GxB_Context_disengage (Context [0])) ;
+
+    //--------------------------------------------------------------------------
+    // engage a Context, and check its precedence over the global settings
+    //--------------------------------------------------------------------------
+
+    CHECK (GB_Context_nthreads_max ( ) == 5) ;
+    CHECK (GB_Context_chunk ( ) == 2000) ;
+
+    info = GxB_Context_engage (Context [2]) ;
+    bool has_thread_local = (info == GrB_SUCCESS) ;
+    if (has_thread_local)
+    {
+        CHECK (GB_Context_nthreads_max ( ) == 3) ;
+        CHECK (GB_Context_chunk ( ) == 3000) ;
+
+        // a setting of GxB_DEFAULT in the Context uses the global setting
+        OK (GxB_Context_set (Context [2], GxB_CONTEXT_NTHREADS, GxB_DEFAULT)) ;
+        CHECK (GB_Context_nthreads_max ( ) == 5) ;
+        CHECK (GB_Context_chunk ( ) == 3000) ;
+        OK (GxB_Context_set (Context [2], GxB_CONTEXT_NTHREADS, 3)) ;
+
+        // only the engaged Context can be disengaged
+        expected = GrB_INVALID_VALUE ;
+        ERR (GxB_Context_disengage (Context [1])) ;
+        CHECK (GB_Context_nthreads_max ( ) == 3) ;
+        OK (GxB_Context_disengage (Context [2])) ;
+        CHECK (GB_Context_nthreads_max ( ) == 5) ;
+        CHECK (GB_Context_chunk ( ) == 2000) ;
+
+        // disengage any Context
+        OK (GxB_Context_engage (Context [1])) ;
+        CHECK (GB_Context_nthreads_max ( ) == 2) ;
+        OK (GxB_Context_disengage (NULL)) ;
+        CHECK (GB_Context_nthreads_max ( ) == 5) ;
+    }
+    else
+    {
+        // this compiler does not support thread-local storage
+        CHECK (info == GrB_NOT_IMPLEMENTED) ;
+        mexPrintf ("GxB_Context_engage not available\n") ;
+    }
+    OK (GxB_Context_disengage (NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // each user thread sees only its own Context
+    //--------------------------------------------------------------------------
+
+    if (has_thread_local)
+    {
+        bool ok [NCONTEXT] ;
+        #pragma omp parallel for num_threads(NCONTEXT) schedule(static,1)
+        for (int k = 0 ; k < NCONTEXT ; k++)
+        {
+            ok [k] = (GxB_Context_engage (Context [k]) == GrB_SUCCESS) ;
+            ok [k] = ok [k] && (GB_Context_nthreads_max ( ) == k+1) ;
+            ok [k] = ok [k] && (GB_Context_chunk ( ) == 1000 * (k+1)) ;
+            ok [k] = ok [k] &&
+                (GxB_Context_disengage (Context [k]) == GrB_SUCCESS) ;
+            ok [k] = ok [k] && (GB_Context_nthreads_max ( ) == 5) ;
+        }
+        for (int k = 0 ; k < NCONTEXT ; k++)
+        {
+            CHECK (ok [k]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // results do not depend on the Context
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 4000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+    if (has_thread_local)
+    {
+        OK (GxB_Context_engage (Context [3])) ;
+    }
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+    OK (GxB_Context_disengage (NULL)) ;
+
+    GrB_Index c1nvals, c2nvals, dnvals ;
+    bool same = false ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&c1nvals, C1)) ;
+    OK (GrB_Matrix_nvals (&c2nvals, C2)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&same, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    CHECK (same && c1nvals == c2nvals && c1nvals == dnvals) ;
+
+    //--------------------------------------------------------------------------
+    // freeing an engaged Context disengages it
+    //--------------------------------------------------------------------------
+
+    if (has_thread_local)
+    {
+        OK (GxB_Context_engage (Context [0])) ;
+        CHECK (GB_Context_nthreads_max ( ) == 1) ;
+        OK (GxB_Context_free (&(Context [0]))) ;
+        CHECK (Context [0] == NULL) ;
+        CHECK (GB_Context_nthreads_max ( ) == 5) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_global_save)) ;
+    OK (GxB_Global_Option_set (GxB_CHUNK, chunk_global_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_context: all tests passed\n\n") ;
+}
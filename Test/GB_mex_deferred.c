@@ -0,0 +1,218 @@
+//------------------------------------------------------------------------------
+// GB_mex_deferred: test the deferred in-place GrB_apply in nonblocking mode
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=op(C) with a user-defined unary operator is deferred in nonblocking mode,
+// and a chain of such operations is done in a single pass when the thread next
+// calls GraphBLAS (see GB_deferred.c).  The user-defined operators count how
+// many times they are called, to check when the work is done.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_deferred"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&C) ;                      \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Matrix_free_(&M) ;                      \
+    GrB_Vector_free_(&v) ;                      \
+    GrB_UnaryOp_free_(&Incr) ;                  \
+    GrB_UnaryOp_free_(&Twice) ;                 \
+}
+
+static int64_t ncalls = 0 ;
+
+ void incr (double *z, const double *x) ;
+ void incr (double *z, const double *x) { (*z) = (*x) + 1 ; ncalls++ ; }
+ void twice (double *z, const double *x) ;
+ void twice (double *z, const double *x) { (*z) = 2 * (*x) ; ncalls++ ; }
+
+// check that X(i,0) is equal to s*(i+1)+t for all i
+static bool check_values (GrB_Matrix X, GrB_Index n, double s, double t)
+{
+    GrB_Info info ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        double y = 0 ;
+        OK (GrB_Matrix_extractElement_FP64 (&y, X, i, 0)) ;
+        if (y != s * (double) (i+1) + t) return (false) ;
+    }
+    return (true) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix C = NULL, D = NULL, M = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_UnaryOp Incr = NULL, Twice = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    // the operators count their calls, so use a single thread
+    int nthreads_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_NTHREADS, 1)) ;
+
+    GrB_Mode mode ;
+    OK (GxB_Global_Option_get (GxB_MODE, &mode)) ;
+    CHECK (mode == GrB_NONBLOCKING) ;
+
+    OK (GrB_UnaryOp_new (&Incr, (GxB_unary_function) incr,
+        GrB_FP64, GrB_FP64)) ;
+    OK (GrB_UnaryOp_new (&Twice, (GxB_unary_function) twice,
+        GrB_FP64, GrB_FP64)) ;
+
+    // C and D are n-by-1, with C(i,0) = D(i,0) = i+1.  The values differ, since
+    // an iso matrix is not deferred.
+    GrB_Index n = 10 ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, 1)) ;
+    OK (GrB_Matrix_new (&D, GrB_FP64, n, 1)) ;
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (C, (double) (i+1), i, 0)) ;
+        OK (GrB_Matrix_setElement_FP64 (D, (double) (i+1), i, 0)) ;
+    }
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (D, GrB_MATERIALIZE)) ;
+    // work is deferred only if thread-local storage is available
+    bool deferred = GB_HAS_THREAD_LOCAL ;
+
+    //--------------------------------------------------------------------------
+    // C = twice (incr (C)) is deferred, and done on the next GraphBLAS call
+    //--------------------------------------------------------------------------
+
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Incr, C, NULL)) ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Twice, C, NULL)) ;
+    if (deferred) CHECK (ncalls == 0) ;
+    GrB_Index nvals = 0 ;
+    OK (GrB_Matrix_nvals (&nvals, C)) ;
+    CHECK (nvals == n) ;
+    CHECK (ncalls == 2*n) ;
+    CHECK (check_values (C, n, 2, 2)) ;
+
+    //--------------------------------------------------------------------------
+    // GrB_Matrix_extractElement finishes the work
+    //--------------------------------------------------------------------------
+
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Twice, C, NULL)) ;
+    if (deferred) CHECK (ncalls == 0) ;
+    double x = 0 ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, 0, 0)) ;
+    CHECK (x == 8) ;
+    CHECK (ncalls == n) ;
+
+    //--------------------------------------------------------------------------
+    // a chain longer than the limit of 16 operators
+    //--------------------------------------------------------------------------
+
+    // C = 4*(i+1) + 4 + 20
+    ncalls = 0 ;
+    for (int k = 0 ; k < 20 ; k++)
+    {
+        OK (GrB_Matrix_apply (C, NULL, NULL, Incr, C, NULL)) ;
+    }
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    CHECK (ncalls == 20*n) ;
+    CHECK (check_values (C, n, 4, 24)) ;
+
+    //--------------------------------------------------------------------------
+    // an apply to another matrix finishes the work on C first
+    //--------------------------------------------------------------------------
+
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Twice, C, NULL)) ;
+    if (deferred) CHECK (ncalls == 0) ;
+    OK (GrB_Matrix_apply (D, NULL, NULL, Incr, D, NULL)) ;
+    if (deferred) CHECK (ncalls == n) ;
+    CHECK (check_values (C, n, 8, 48)) ;
+    CHECK (check_values (D, n, 1, 1)) ;
+    CHECK (ncalls == 2*n) ;
+
+    //--------------------------------------------------------------------------
+    // C=op(D) and a masked C<M>=op(C) are not deferred
+    //--------------------------------------------------------------------------
+
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Incr, D, NULL)) ;
+    CHECK (ncalls == n) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, n, 1)) ;
+    OK (GrB_Matrix_setElement_BOOL (M, true, 0, 0)) ;
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, M, NULL, Twice, C, NULL)) ;
+    CHECK (ncalls > 0) ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, 0, 0)) ;
+    CHECK (x == 6) ;
+    OK (GrB_Matrix_extractElement_FP64 (&x, C, 1, 0)) ;
+    CHECK (x == 4) ;
+
+    //--------------------------------------------------------------------------
+    // built-in operators are not deferred
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_apply (D, NULL, NULL, GrB_AINV_FP64, D, NULL)) ;
+    CHECK (check_values (D, n, -1, -1)) ;
+
+    //--------------------------------------------------------------------------
+    // freeing C discards its deferred work
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+    ncalls = 0 ;
+    OK (GrB_Matrix_apply (C, NULL, NULL, Incr, C, NULL)) ;
+    OK (GrB_Matrix_free_(&C)) ;
+    OK (GrB_Matrix_nvals (&nvals, D)) ;
+    if (deferred) CHECK (ncalls == 0) ;
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_FP64, n)) ;
+    OK (GrB_Vector_assign_FP64 (v, NULL, NULL, (double) 3, GrB_ALL, n,
+        NULL)) ;
+    OK (GrB_Vector_setElement_FP64 (v, (double) 1, 0)) ;
+    OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+    ncalls = 0 ;
+    OK (GrB_Vector_apply (v, NULL, NULL, Incr, v, NULL)) ;
+    OK (GrB_Vector_apply (v, NULL, NULL, Twice, v, NULL)) ;
+    if (deferred) CHECK (ncalls == 0) ;
+    OK (GrB_Vector_extractElement_FP64 (&x, v, 0)) ;
+    CHECK (x == 4) ;
+    OK (GrB_Vector_extractElement_FP64 (&x, v, 1)) ;
+    CHECK (x == 8) ;
+    CHECK (ncalls == 2*n) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_deferred: all tests passed\n\n") ;
+}
@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+// GB_mex_esc: test the expand-sort-compress (ESC) coarse tasks of saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed for very sparse A and B, with a few flops per column of
+// C, like a road network.  GB_AxB_saxpy3_slice_balanced selects the ESC
+// method for these coarse tasks, and the result is compared with the Hash,
+// Gustavson, and dot product methods, which do not use ESC.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_esc"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Descriptor_free_(&desc) ;               \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// count_esc: count the coarse ESC tasks that saxpy3 would use for C=A*B
+//------------------------------------------------------------------------------
+
+// B must be sparse, not hypersparse.
+
+static GrB_Info count_esc
+(
+    int *nesc,              // # of coarse ESC tasks
+    int *ncoarse,           // # of coarse tasks
+    GrB_Matrix A,
+    GrB_Matrix B,
+    GrB_Desc_Value AxB_method,
+    GB_Context Context
+)
+{
+    GrB_Info info ;
+    GrB_Matrix W = NULL ;
+    GB_saxpy3task_struct *SaxpyTasks = NULL ;
+    size_t SaxpyTasks_size = 0 ;
+    bool apply_mask, M_in_place ;
+    int ntasks, nfine, nthreads ;
+    (*nesc) = 0 ;
+    (*ncoarse) = 0 ;
+
+    // W->p is the workspace for the flop counts, of size B->vdim+1
+    OK (GrB_Matrix_dup (&W, B)) ;
+    CHECK (GB_IS_SPARSE (W)) ;
+    OK (GB_AxB_saxpy3_slice_balanced (W, NULL, false, A, B, AxB_method, 0,
+        &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place, &ntasks,
+        &nfine, &nthreads, Context)) ;
+    for (int taskid = nfine ; taskid < ntasks ; taskid++)
+    {
+        (*ncoarse)++ ;
+        if (SaxpyTasks [taskid].use_esc) (*nesc)++ ;
+    }
+    GB_FREE_WORK (&SaxpyTasks, SaxpyTasks_size) ;
+    OK (GrB_Matrix_free_(&W)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_esc mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_CHUNK, &chunk_save)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    //--------------------------------------------------------------------------
+    // A and B have at most 2 entries per column
+    //--------------------------------------------------------------------------
+
+    // Each column of C=A*B takes at most 4 flops, so every coarse task has a
+    // small hash table and uses the ESC method.
+
+    GrB_Index n = 4000 ;
+    simple_rand_seed (1) ;
+    for (int ka = 0 ; ka <= 1 ; ka++)
+    {
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        for (GrB_Index j = 0 ; j < n ; j++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A,
+                (double) (simple_rand ( ) % 9 + 1), j, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (A,
+                (double) (simple_rand ( ) % 9 + 1), simple_rand ( ) % n, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (B,
+                (double) (simple_rand ( ) % 9 + 1), (j+1) % n, j)) ;
+            OK (GrB_Matrix_setElement_FP64 (B,
+                (double) (simple_rand ( ) % 9 + 1), simple_rand ( ) % n, j)) ;
+        }
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL,
+            (ka == 0) ? GxB_SPARSE : GxB_HYPERSPARSE)) ;
+        OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+        for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+        {
+            OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads)) ;
+            OK (GxB_Global_Option_set (GxB_CHUNK, (double) 1000)) ;
+
+            //------------------------------------------------------------------
+            // check that the ESC method is selected
+            //------------------------------------------------------------------
+
+            GB_CONTEXT (USAGE) ;
+            int nesc, ncoarse ;
+            OK (count_esc (&nesc, &ncoarse, A, B, GxB_DEFAULT, Context)) ;
+            CHECK (nesc > 0) ;
+            // ESC is not used if the Hash method is selected explicitly
+            OK (count_esc (&nesc, &ncoarse, A, B, GxB_AxB_HASH, Context)) ;
+            CHECK (nesc == 0 && ncoarse > 0) ;
+
+            //------------------------------------------------------------------
+            // compare C=A*B with the default method and without ESC
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                NULL)) ;
+            // C(:,j) computed by ESC is sorted, but other tasks may leave
+            // the matrix jumbled
+            OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+
+            GrB_Desc_Value methods [3] = { GxB_AxB_HASH, GxB_AxB_GUSTAVSON,
+                GxB_AxB_DOT } ;
+            for (int km = 0 ; km < 3 ; km++)
+            {
+                OK (GxB_Desc_set (desc, GxB_AxB_METHOD, methods [km])) ;
+                OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+                OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+                    A, B, desc)) ;
+                CHECK (same_matrix (C1, C2, D)) ;
+                OK (GrB_Matrix_free_(&C2)) ;
+            }
+
+            // C+=A*B, with an accum, into a matrix that already has entries
+            OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C2, NULL, NULL, GxB_ANY_PAIR_FP64, A, B, NULL)) ;
+            OK (GrB_mxm (C2, NULL, GrB_PLUS_FP64, GrB_PLUS_TIMES_SEMIRING_FP64,
+                A, B, NULL)) ;
+            OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (C1, NULL, NULL,
+                GrB_PLUS_FP64, C1, (double) 1, NULL)) ;
+            CHECK (same_matrix (C1, C2, D)) ;
+            OK (GrB_Matrix_free_(&C1)) ;
+            OK (GrB_Matrix_free_(&C2)) ;
+        }
+
+        OK (GrB_Matrix_free_(&A)) ;
+        OK (GrB_Matrix_free_(&B)) ;
+        OK (GrB_Matrix_free_(&D)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_CHUNK, chunk_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_esc: all tests passed\n\n") ;
+}
@@ -0,0 +1,282 @@
+//------------------------------------------------------------------------------
+// GB_mex_index32: test the 32-bit index option (GxB_INDEX_32)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A sparse, hypersparse, or vector is held with 32-bit indices, and used as
+// an input, exported and imported, and unpacked and packed.  The import,
+// export, pack, and unpack methods always take 64-bit (GrB_Index) arrays.
+// Each result is compared with an unchanged copy held with 64-bit indices.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_index32"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&Aref) ;                   \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Matrix_free_(&H) ;                      \
+    GrB_Vector_free_(&v) ;                      \
+    GrB_Vector_free_(&vref) ;                   \
+}
+
+// A is held with 32-bit indices (or as a packed bitmap)
+#define PACKED(X) (((GrB_Matrix) (X))->magic == GB_MAGIC_PACKED)
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_index32 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, Aref = NULL, C1 = NULL, C2 = NULL, D = NULL,
+        H = NULL ;
+    GrB_Vector v = NULL, vref = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    bool index32 = true ;
+    OK (GxB_Global_Option_get (GxB_INDEX_32, &index32)) ;
+    CHECK (!index32) ;
+
+    //--------------------------------------------------------------------------
+    // create A with 32-bit indices, and Aref with 64-bit indices
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1000 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&Aref, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 10000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (Aref,
+            (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GxB_Matrix_Option_set (Aref, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Matrix_wait (Aref, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_dup (&A, Aref)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+    OK (GxB_Matrix_Option_get (A, GxB_INDEX_32, &index32)) ;
+    CHECK (!index32) ;
+    OK (GxB_Matrix_Option_set (A, GxB_INDEX_32, true)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_INDEX_32, &index32)) ;
+    CHECK (index32) ;
+    CHECK (PACKED (A) && A->b == NULL) ;
+
+    // nvals and memoryUsage do not widen the indices
+    GrB_Index nvals1, nvals2 ;
+    OK (GrB_Matrix_nvals (&nvals1, A)) ;
+    OK (GrB_Matrix_nvals (&nvals2, Aref)) ;
+    CHECK (nvals1 == nvals2) ;
+    size_t size1, size2 ;
+    OK (GxB_Matrix_memoryUsage (&size1, A)) ;
+    OK (GxB_Matrix_memoryUsage (&size2, Aref)) ;
+    CHECK (size1 < size2) ;
+    CHECK (PACKED (A)) ;
+
+    //--------------------------------------------------------------------------
+    // A is left narrow when used as an input
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GrB_mxm (C1, A, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+    OK (GrB_mxm (C2, Aref, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, Aref, Aref,
+        NULL)) ;
+    CHECK (PACKED (A)) ;
+    CHECK (same_matrix (C1, C2, D)) ;
+    OK (GrB_Matrix_free_(&C1)) ;
+    OK (GrB_Matrix_free_(&C2)) ;
+
+    for (GrB_Index i = 0 ; i < n ; i += 7)
+    {
+        for (GrB_Index j = 0 ; j < n ; j += 3)
+        {
+            double x1 = 0, x2 = 0 ;
+            GrB_Info info1 = GrB_Matrix_extractElement_FP64 (&x1, A, i, j) ;
+            GrB_Info info2 = GrB_Matrix_extractElement_FP64 (&x2, Aref, i, j) ;
+            CHECK (info1 == info2 && x1 == x2) ;
+        }
+    }
+    CHECK (PACKED (A)) ;
+    OK (GxB_Matrix_fprint (A, "A", GxB_SHORT, NULL)) ;
+    CHECK (PACKED (A)) ;
+
+    //--------------------------------------------------------------------------
+    // unpack and pack, with 64-bit arrays
+    //--------------------------------------------------------------------------
+
+    GrB_Index *Ap = NULL, *Ah = NULL, *Ai = NULL ;
+    void *Ax = NULL ;
+    GrB_Index Ap_size, Ah_size, Ai_size, Ax_size, nvec ;
+    bool iso, jumbled ;
+
+    OK (GxB_Matrix_unpack_CSC (A, &Ap, &Ai, &Ax, &Ap_size, &Ai_size,
+        &Ax_size, &iso, &jumbled, NULL)) ;
+    CHECK (!PACKED (A)) ;
+    CHECK (Ap [0] == 0 && Ap [n] == nvals2) ;
+    CHECK (Ap_size >= (n+1) * sizeof (GrB_Index)) ;
+    CHECK (Ai_size >= nvals2 * sizeof (GrB_Index)) ;
+    for (GrB_Index k = 0 ; k < nvals2 ; k++)
+    {
+        CHECK (Ai [k] < n) ;
+    }
+    OK (GxB_Matrix_pack_CSC (A, &Ap, &Ai, &Ax, Ap_size, Ai_size, Ax_size,
+        iso, jumbled, NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    CHECK (same_matrix (A, Aref, D)) ;
+
+    // hypersparse
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    OK (GxB_Matrix_unpack_HyperCSC (A, &Ap, &Ah, &Ai, &Ax, &Ap_size,
+        &Ah_size, &Ai_size, &Ax_size, &iso, &nvec, &jumbled, NULL)) ;
+    CHECK (Ap [0] == 0 && Ap [nvec] == nvals2) ;
+    for (GrB_Index k = 0 ; k < nvec ; k++)
+    {
+        CHECK (Ah [k] < n) ;
+    }
+    OK (GxB_Matrix_pack_HyperCSC (A, &Ap, &Ah, &Ai, &Ax, Ap_size, Ah_size,
+        Ai_size, Ax_size, iso, nvec, jumbled, NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    CHECK (same_matrix (A, Aref, D)) ;
+
+    //--------------------------------------------------------------------------
+    // export and import, with 64-bit arrays
+    //--------------------------------------------------------------------------
+
+    // the global option is the default for the imported matrix
+    OK (GxB_Global_Option_set (GxB_INDEX_32, true)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    GrB_Type type ;
+    GrB_Index nrows, ncols ;
+    OK (GxB_Matrix_export_CSC (&A, &type, &nrows, &ncols, &Ap, &Ai, &Ax,
+        &Ap_size, &Ai_size, &Ax_size, &iso, &jumbled, NULL)) ;
+    CHECK (A == NULL) ;
+    CHECK (type == GrB_FP64 && nrows == n && ncols == n) ;
+    CHECK (Ap [0] == 0 && Ap [n] == nvals2) ;
+    OK (GxB_Matrix_import_CSC (&A, type, nrows, ncols, &Ap, &Ai, &Ax,
+        Ap_size, Ai_size, Ax_size, iso, jumbled, NULL)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_INDEX_32, &index32)) ;
+    CHECK (index32) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    CHECK (same_matrix (A, Aref, D)) ;
+    OK (GxB_Global_Option_set (GxB_INDEX_32, false)) ;
+
+    //--------------------------------------------------------------------------
+    // a modified matrix is widened, and narrowed again by GrB_wait
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_setElement_FP64 (A, (double) 42, 0, 0)) ;
+    OK (GrB_Matrix_setElement_FP64 (Aref, (double) 42, 0, 0)) ;
+    CHECK (!PACKED (A)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    CHECK (same_matrix (A, Aref, D)) ;
+
+    // a matrix too large for 32-bit indices is not narrowed
+    OK (GrB_Matrix_free_(&D)) ;
+    GrB_Index nbig = ((GrB_Index) 1) << 31 ;
+    OK (GrB_Matrix_resize (A, nbig, n)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (!PACKED (A)) ;
+    OK (GrB_Matrix_new (&H, GrB_FP64, nbig, 10)) ;
+    OK (GrB_Matrix_setElement_FP64 (H, (double) 1, nbig-1, 3)) ;
+    OK (GxB_Matrix_Option_set (H, GxB_INDEX_32, true)) ;
+    CHECK (!PACKED (H)) ;
+    OK (GrB_Matrix_resize (A, n, n)) ;
+    OK (GrB_Matrix_wait (A, GrB_COMPLETE)) ;
+    CHECK (PACKED (A)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+    CHECK (same_matrix (A, Aref, D)) ;
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&vref, GrB_FP64, n)) ;
+    for (GrB_Index i = 0 ; i < n ; i += 3)
+    {
+        OK (GrB_Vector_setElement_FP64 (vref, (double) i, i)) ;
+    }
+    OK (GxB_Vector_Option_set (vref, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Vector_wait (vref, GrB_MATERIALIZE)) ;
+    OK (GrB_Vector_dup (&v, vref)) ;
+    OK (GxB_Vector_Option_set (v, GxB_INDEX_32, true)) ;
+    CHECK (PACKED (v)) ;
+    GrB_Index *vi = NULL ;
+    void *vx = NULL ;
+    GrB_Index vi_size, vx_size ;
+    OK (GxB_Vector_unpack_CSC (v, &vi, &vx, &vi_size, &vx_size, &iso,
+        &nvals1, &jumbled, NULL)) ;
+    CHECK (nvals1 == (n+2) / 3) ;
+    for (GrB_Index k = 0 ; k < nvals1 ; k++)
+    {
+        CHECK (vi [k] == 3*k) ;
+    }
+    OK (GxB_Vector_pack_CSC (v, &vi, &vx, vi_size, vx_size, iso, nvals1,
+        jumbled, NULL)) ;
+    OK (GrB_Vector_wait (v, GrB_COMPLETE)) ;
+    CHECK (PACKED (v)) ;
+    OK (GrB_Matrix_free_(&D)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, 1)) ;
+    CHECK (same_matrix ((GrB_Matrix) v, (GrB_Matrix) vref, D)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_index32: all tests passed\n\n") ;
+}
@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+// GB_mex_jit_cache: test the persistent cache of the CPU JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// stats = GB_mex_jit_cache (cache_path) sets the JIT cache path, and computes
+// C=A*B with a user-defined semiring, which is checked against the same
+// product computed with the JIT disabled.  The product is computed twice, so
+// the second one must use the kernel already loaded by the first.  On output,
+// stats = [hits misses bytes jit_control] are the JIT cache statistics for
+// this call.  If GB_mex_jit_cache is called again with the same cache_path,
+// the kernel is loaded from the cache folder, and not compiled again.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "stats = GB_mex_jit_cache (cache_path)"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Semiring_free_(&MyMaxTimes) ;           \
+    GrB_Monoid_free_(&MyMaxMonoid) ;            \
+    GrB_BinaryOp_free_(&MyMax) ;                \
+}
+
+ void mymax (double *z, const double *x, const double *y) ;
+
+#define MYMAX                                                               \
+"void mymax (double *z, const double *x, const double *y) "                 \
+"{ (*z) = ((*x) > (*y)) ? (*x) : (*y) ; }"
+ void mymax (double *z, const double *x, const double *y)
+ { (*z) = ((*x) > (*y)) ? (*x) : (*y) ; }
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GrB_BinaryOp MyMax = NULL ;
+    GrB_Monoid MyMaxMonoid = NULL ;
+    GrB_Semiring MyMaxTimes = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin != 1 || nargout > 1)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    #define LEN 2048
+    char cache_path [LEN+1] ;
+    if (GB_mx_mxArray_to_string (cache_path, LEN, pargin [0]) <= 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE ", where cache_path is a string") ;
+    }
+
+    bool jit_control = false ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, true)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_C_CONTROL, &jit_control)) ;
+    OK (GxB_Global_Option_set (GxB_JIT_CACHE_PATH, cache_path)) ;
+    char *path = NULL ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_PATH, &path)) ;
+    CHECK (path != NULL && strcmp (path, cache_path) == 0) ;
+
+    // no kernels have been loaded yet
+    int64_t hits = -1, misses = -1, bytes = -1 ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    CHECK (hits == 0 && misses == 0) ;
+
+    //--------------------------------------------------------------------------
+    // create the user-defined semiring and the test matrices
+    //--------------------------------------------------------------------------
+
+    OK (GxB_BinaryOp_new (&MyMax, (GxB_binary_function) mymax,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mymax", MYMAX)) ;
+    OK (GrB_Monoid_new_FP64 (&MyMaxMonoid, MyMax, (double) 0)) ;
+    OK (GrB_Semiring_new (&MyMaxTimes, MyMaxMonoid, GrB_TIMES_FP64)) ;
+
+    GrB_Index n = 100 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 1000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C1 = A*B with the JIT, twice, and C2 = A*B without it
+    //--------------------------------------------------------------------------
+
+    int64_t hits1, misses1 ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+    OK (GrB_mxm (C1, NULL, NULL, MyMaxTimes, A, B, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits1)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses1)) ;
+    OK (GrB_mxm (C1, NULL, NULL, MyMaxTimes, A, B, NULL)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    CHECK (hits == hits1 && misses == misses1) ;
+
+    OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, false)) ;
+    OK (GrB_mxm (C2, NULL, NULL, MyMaxTimes, A, B, NULL)) ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, jit_control)) ;
+
+    GrB_Index c1nvals, c2nvals, dnvals ;
+    bool ok = false ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, C1, C2,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&c1nvals, C1)) ;
+    OK (GrB_Matrix_nvals (&c2nvals, C2)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    CHECK (ok && c1nvals == c2nvals && c1nvals == dnvals) ;
+
+    //--------------------------------------------------------------------------
+    // return the statistics
+    //--------------------------------------------------------------------------
+
+    double compile_time = -1 ;
+    OK (GxB_Global_Option_get (GxB_JIT_COMPILE_TIME, &compile_time)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_BYTES, &bytes)) ;
+    CHECK (compile_time >= 0 && bytes >= 0) ;
+    if (jit_control)
+    {
+        // the kernel was either loaded or compiled, just once
+        CHECK (hits + misses == 1) ;
+        CHECK (bytes > 0) ;
+    }
+
+    pargout [0] = mxCreateDoubleMatrix (1, 4, mxREAL) ;
+    double *stats = mxGetDoubles (pargout [0]) ;
+    stats [0] = (double) hits ;
+    stats [1] = (double) misses ;
+    stats [2] = (double) bytes ;
+    stats [3] = (double) jit_control ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+}
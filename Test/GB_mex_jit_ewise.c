@@ -0,0 +1,270 @@
+//------------------------------------------------------------------------------
+// GB_mex_jit_ewise: test the CPU JIT for eWiseAdd, eWiseMult, and eWiseUnion
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A+B, C=A.*B, and eWiseUnion are computed for a user-defined complex type
+// and operators, all given with their definitions, for sparse and bitmap
+// matrices, with and without a mask.  Each result is compared with the same
+// computation done with the JIT disabled, which uses the generic method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_jit_ewise"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&M) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Scalar_free_(&alpha) ;                  \
+    GrB_Scalar_free_(&beta) ;                   \
+    GrB_BinaryOp_free_(&MyAdd) ;                \
+    GrB_BinaryOp_free_(&MyMult) ;               \
+    GrB_Type_free_(&MyCx) ;                     \
+    GrB_Descriptor_free_(&desc_s) ;             \
+    GrB_Descriptor_free_(&desc_sc) ;            \
+}
+
+typedef struct { double re ; double im ; } mycx ;
+#define MYCX_DEFN                                                           \
+"typedef struct { double re ; double im ; } mycx ;"
+
+ void mycx_add (mycx *z, const mycx *x, const mycx *y) ;
+ void mycx_mult (mycx *z, const mycx *x, const mycx *y) ;
+
+#define MYCX_ADD                                                            \
+"void mycx_add (mycx *z, const mycx *x, const mycx *y) "                    \
+"{ z->re = x->re + y->re ; z->im = x->im + y->im ; }"
+ void mycx_add (mycx *z, const mycx *x, const mycx *y)
+ { z->re = x->re + y->re ; z->im = x->im + y->im ; }
+
+#define MYCX_MULT                                                           \
+"void mycx_mult (mycx *z, const mycx *x, const mycx *y) "                   \
+"{ double re = x->re * y->re - x->im * y->im ; "                            \
+"  double im = x->re * y->im + x->im * y->re ; "                            \
+"  z->re = re ; z->im = im ; }"
+ void mycx_mult (mycx *z, const mycx *x, const mycx *y)
+ { double re = x->re * y->re - x->im * y->im ;
+   double im = x->re * y->im + x->im * y->re ;
+   z->re = re ; z->im = im ; }
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix of type mycx with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A,
+    GrB_Type type,
+    GrB_Index n,
+    GrB_Index nz,
+    int sparsity
+)
+{
+    GrB_Info info = GrB_Matrix_new (A, type, n, n) ;
+    for (GrB_Index k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        GrB_Index j = simple_rand ( ) % n ;
+        mycx x ;
+        x.re = (double) (simple_rand ( ) % 9 + 1) ;
+        x.im = (double) (simple_rand ( ) % 9) ;
+        info = GrB_Matrix_setElement_UDT (*A, &x, i, j) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Matrix_Option_set (*A, GxB_SPARSITY_CONTROL, sparsity) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+// X and Y have type mycx, and are held in the same format
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    if (xnvals != ynvals) return (false) ;
+    GrB_Index n = GB_IMAX (xnvals, 1) ;
+    GrB_Index *I1 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *J1 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *I2 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *J2 = mxMalloc (n * sizeof (GrB_Index)) ;
+    mycx *X1 = mxMalloc (n * sizeof (mycx)) ;
+    mycx *X2 = mxMalloc (n * sizeof (mycx)) ;
+    OK (GrB_Matrix_extractTuples_UDT (I1, J1, X1, &xnvals, X)) ;
+    OK (GrB_Matrix_extractTuples_UDT (I2, J2, X2, &ynvals, Y)) ;
+    bool ok = (memcmp (I1, I2, xnvals * sizeof (GrB_Index)) == 0)
+           && (memcmp (J1, J2, xnvals * sizeof (GrB_Index)) == 0)
+           && (memcmp (X1, X2, xnvals * sizeof (mycx)) == 0) ;
+    mxFree (I1) ; mxFree (J1) ; mxFree (X1) ;
+    mxFree (I2) ; mxFree (J2) ; mxFree (X2) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_jit_ewise mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar alpha = NULL, beta = NULL ;
+    GrB_BinaryOp MyAdd = NULL, MyMult = NULL ;
+    GrB_Type MyCx = NULL ;
+    GrB_Descriptor desc_s = NULL, desc_sc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    bool jit_control = false ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, true)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_C_CONTROL, &jit_control)) ;
+    int64_t hits = 0, misses = 0 ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    int64_t nkernels_start = hits + misses ;
+
+    //--------------------------------------------------------------------------
+    // create the user-defined type and operators
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Type_new (&MyCx, sizeof (mycx), "mycx", MYCX_DEFN)) ;
+    OK (GxB_BinaryOp_new (&MyAdd, (GxB_binary_function) mycx_add,
+        MyCx, MyCx, MyCx, "mycx_add", MYCX_ADD)) ;
+    OK (GxB_BinaryOp_new (&MyMult, (GxB_binary_function) mycx_mult,
+        MyCx, MyCx, MyCx, "mycx_mult", MYCX_MULT)) ;
+
+    mycx a = { 1, 2 }, b = { 3, -1 } ;
+    OK (GrB_Scalar_new (&alpha, MyCx)) ;
+    OK (GrB_Scalar_new (&beta, MyCx)) ;
+    OK (GrB_Scalar_setElement_UDT (alpha, &a)) ;
+    OK (GrB_Scalar_setElement_UDT (beta, &b)) ;
+
+    // the mask has a user-defined type, so it must be structural
+    OK (GrB_Descriptor_new (&desc_s)) ;
+    OK (GxB_Desc_set (desc_s, GrB_MASK, GrB_STRUCTURE)) ;
+    OK (GrB_Descriptor_new (&desc_sc)) ;
+    OK (GxB_Desc_set (desc_sc, GrB_MASK, GrB_STRUCTURE + GrB_COMP)) ;
+
+    //--------------------------------------------------------------------------
+    // test eWiseAdd, eWiseMult, and eWiseUnion
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 100 ;
+    simple_rand_seed (1) ;
+    int sparsity_list [2] = { GxB_SPARSE, GxB_BITMAP } ;
+
+    for (int ka = 0 ; ka < 2 ; ka++)
+    {
+        for (int kb = 0 ; kb < 2 ; kb++)
+        {
+            OK (random_matrix (&A, MyCx, n, 800, sparsity_list [ka])) ;
+            OK (random_matrix (&B, MyCx, n, 800, sparsity_list [kb])) ;
+            OK (random_matrix (&M, MyCx, n, 2000, GxB_SPARSE)) ;
+
+            // mask: none, M, and !M
+            for (int kmask = 0 ; kmask <= 2 ; kmask++)
+            {
+                GrB_Matrix Mask = (kmask == 0) ? NULL : M ;
+                GrB_Descriptor D = (kmask == 0) ? NULL :
+                    ((kmask == 1) ? desc_s : desc_sc) ;
+
+                for (int method = 0 ; method <= 2 ; method++)
+                {
+                    for (int k = 0 ; k <= 1 ; k++)
+                    {
+                        // C1 with the JIT (if enabled), C2 without it
+                        OK (GrB_Matrix_new (&C1, MyCx, n, n)) ;
+                        OK (GrB_Matrix_new (&C2, MyCx, n, n)) ;
+                        GrB_BinaryOp op = (k == 0) ? MyAdd : MyMult ;
+                        for (int jit = 0 ; jit <= 1 ; jit++)
+                        {
+                            GrB_Matrix C = (jit == 0) ? C1 : C2 ;
+                            OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL,
+                                (jit == 0) && jit_control)) ;
+                            if (method == 0)
+                            {
+                                OK (GrB_Matrix_eWiseAdd_BinaryOp (C, Mask,
+                                    NULL, op, A, B, D)) ;
+                            }
+                            else if (method == 1)
+                            {
+                                OK (GrB_Matrix_eWiseMult_BinaryOp (C, Mask,
+                                    NULL, op, A, B, D)) ;
+                            }
+                            else
+                            {
+                                OK (GxB_Matrix_eWiseUnion (C, Mask, NULL, op,
+                                    A, alpha, B, beta, D)) ;
+                            }
+                            OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                        }
+                        OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL,
+                            jit_control)) ;
+                        CHECK (same_matrix (C1, C2)) ;
+                        OK (GrB_Matrix_free_(&C1)) ;
+                        OK (GrB_Matrix_free_(&C2)) ;
+                    }
+                }
+            }
+
+            OK (GrB_Matrix_free_(&A)) ;
+            OK (GrB_Matrix_free_(&B)) ;
+            OK (GrB_Matrix_free_(&M)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check that the JIT compiled or loaded the kernels, if it is enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    if (jit_control)
+    {
+        CHECK (hits + misses > nkernels_start) ;
+    }
+    else
+    {
+        mexPrintf ("JIT not available; generic methods tested only\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_jit_ewise: all tests passed\n\n") ;
+}
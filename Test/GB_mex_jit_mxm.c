@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+// GB_mex_jit_mxm: test the CPU JIT for GrB_mxm
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B, C=A'*B, and C<M>=A'*B are computed with a user-defined semiring
+// whose operators are given with their definitions, so the JIT can compile a
+// kernel for each method (saxpy3, dot2, and dot3).  The results are compared
+// with the same products computed with the JIT disabled, which uses the
+// generic method.  The built-in PLUS_PAIR semiring is checked against a
+// user-defined PLUS_PAIR; if the built-in kernels are disabled (see
+// GB_control.h), it is computed by a JIT kernel as well.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_jit_mxm"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&M) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Semiring_free_(&MyPlusTimes) ;          \
+    GrB_Semiring_free_(&MyPlusPair) ;           \
+    GrB_Monoid_free_(&MyPlusMonoid) ;           \
+    GrB_BinaryOp_free_(&MyPlus) ;               \
+    GrB_BinaryOp_free_(&MyTimes) ;              \
+    GrB_BinaryOp_free_(&MyPair) ;               \
+    GrB_Descriptor_free_(&desc) ;               \
+}
+
+ void myplus (double *z, const double *x, const double *y) ;
+ void mytimes (double *z, const double *x, const double *y) ;
+ void mypair (double *z, const double *x, const double *y) ;
+
+#define MYPLUS                                                              \
+"void myplus (double *z, const double *x, const double *y) "                \
+"{ (*z) = (*x) + (*y) ; }"
+ void myplus (double *z, const double *x, const double *y)
+ { (*z) = (*x) + (*y) ; }
+
+#define MYTIMES                                                             \
+"void mytimes (double *z, const double *x, const double *y) "               \
+"{ (*z) = (*x) * (*y) ; }"
+ void mytimes (double *z, const double *x, const double *y)
+ { (*z) = (*x) * (*y) ; }
+
+#define MYPAIR                                                              \
+"void mypair (double *z, const double *x, const double *y) "                \
+"{ (*z) = 1 ; }"
+ void mypair (double *z, const double *x, const double *y)
+ { (*z) = 1 ; }
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with small integer values
+//------------------------------------------------------------------------------
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A,
+    GrB_Index m,
+    GrB_Index n,
+    GrB_Index nz
+)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_FP64, m, n) ;
+    for (GrB_Index k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % m ;
+        GrB_Index j = simple_rand ( ) % n ;
+        double x = (double) (simple_rand ( ) % 9 + 1) ;
+        info = GrB_Matrix_setElement_FP64 (*A, x, i, j) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals, nrows, ncols ;
+    GrB_Matrix D = NULL ;
+    bool ok = true ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nrows (&nrows, X)) ;
+    OK (GrB_Matrix_ncols (&ncols, X)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, nrows, ncols)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    OK (GrB_Matrix_free_(&D)) ;
+    return (ok && xnvals == ynvals && dnvals == xnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_jit_mxm mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL ;
+    GrB_BinaryOp MyPlus = NULL, MyTimes = NULL, MyPair = NULL ;
+    GrB_Monoid MyPlusMonoid = NULL ;
+    GrB_Semiring MyPlusTimes = NULL, MyPlusPair = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    bool jit_control = false ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, true)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_C_CONTROL, &jit_control)) ;
+    int64_t hits = 0, misses = 0 ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    int64_t nkernels_start = hits + misses ;
+
+    //--------------------------------------------------------------------------
+    // create the user-defined semirings
+    //--------------------------------------------------------------------------
+
+    OK (GxB_BinaryOp_new (&MyPlus, (GxB_binary_function) myplus,
+        GrB_FP64, GrB_FP64, GrB_FP64, "myplus", MYPLUS)) ;
+    OK (GxB_BinaryOp_new (&MyTimes, (GxB_binary_function) mytimes,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mytimes", MYTIMES)) ;
+    OK (GxB_BinaryOp_new (&MyPair, (GxB_binary_function) mypair,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mypair", MYPAIR)) ;
+    OK (GrB_Monoid_new_FP64 (&MyPlusMonoid, MyPlus, (double) 0)) ;
+    OK (GrB_Semiring_new (&MyPlusTimes, MyPlusMonoid, MyTimes)) ;
+    OK (GrB_Semiring_new (&MyPlusPair, MyPlusMonoid, MyPair)) ;
+
+    //--------------------------------------------------------------------------
+    // create the test matrices
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 200 ;
+    simple_rand_seed (1) ;
+    OK (random_matrix (&A, n, n, 2000)) ;
+    OK (random_matrix (&B, n, n, 2000)) ;
+    OK (random_matrix (&M, n, n, 4000)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+
+    for (int trial = 0 ; trial <= 3 ; trial++)
+    {
+
+        //----------------------------------------------------------------------
+        // select the method
+        //----------------------------------------------------------------------
+
+        // trial 0: C=A*B with saxpy3 (Gustavson)
+        // trial 1: C=A*B with saxpy3 (hash)
+        // trial 2: C=A'*B with dot2
+        // trial 3: C<M>=A'*B with dot3
+        GrB_Matrix Mask = (trial == 3) ? M : NULL ;
+        OK (GxB_Desc_set (desc, GrB_INP0,
+            (trial >= 2) ? GrB_TRAN : GxB_DEFAULT)) ;
+        OK (GxB_Desc_set (desc, GxB_AxB_METHOD,
+            (trial == 0) ? GxB_AxB_GUSTAVSON :
+            (trial == 1) ? GxB_AxB_HASH : GxB_AxB_DOT)) ;
+
+        for (int k = 0 ; k <= 1 ; k++)
+        {
+            GrB_Semiring user = (k == 0) ? MyPlusTimes : MyPlusPair ;
+            GrB_Semiring builtin = (k == 0) ? GrB_PLUS_TIMES_SEMIRING_FP64 :
+                GxB_PLUS_PAIR_FP64 ;
+
+            //------------------------------------------------------------------
+            // C1 = A*B with the JIT, C2 = A*B without it
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+            OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+            OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, jit_control)) ;
+            OK (GrB_mxm (C1, Mask, NULL, user, A, B, desc)) ;
+            OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, false)) ;
+            OK (GrB_mxm (C2, Mask, NULL, user, A, B, desc)) ;
+            CHECK (same_matrix (C1, C2)) ;
+
+            //------------------------------------------------------------------
+            // compare with the built-in semiring
+            //------------------------------------------------------------------
+
+            OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, jit_control)) ;
+            OK (GrB_mxm (C2, Mask, NULL, builtin, A, B, desc)) ;
+            CHECK (same_matrix (C1, C2)) ;
+            OK (GrB_Matrix_free_(&C1)) ;
+            OK (GrB_Matrix_free_(&C2)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check that the JIT compiled or loaded the kernels, if it is enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    if (jit_control)
+    {
+        CHECK (hits + misses > nkernels_start) ;
+    }
+    else
+    {
+        mexPrintf ("JIT not available; generic methods tested only\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_jit_mxm: all tests passed\n\n") ;
+}
@@ -0,0 +1,185 @@
+//------------------------------------------------------------------------------
+// GB_mex_jit_reduce: test the CPU JIT for GrB_reduce to scalar
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is reduced to a scalar with user-defined monoids, given with their
+// definitions, for a user-defined complex type and for double, where A is
+// sparse, hypersparse, bitmap, and full.  Each result is compared with the
+// same reduction done with the JIT disabled.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_jit_reduce"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&X) ;                      \
+    GrB_Monoid_free_(&MyCxMonoid) ;             \
+    GrB_Monoid_free_(&MyMaxMonoid) ;            \
+    GrB_BinaryOp_free_(&MyCxAdd) ;              \
+    GrB_BinaryOp_free_(&MyMax) ;                \
+    GrB_Type_free_(&MyCx) ;                     \
+}
+
+typedef struct { double re ; double im ; } mycx ;
+#define MYCX_DEFN                                                           \
+"typedef struct { double re ; double im ; } mycx ;"
+
+ void mycx_add (mycx *z, const mycx *x, const mycx *y) ;
+ void mymax (double *z, const double *x, const double *y) ;
+
+#define MYCX_ADD                                                            \
+"void mycx_add (mycx *z, const mycx *x, const mycx *y) "                    \
+"{ z->re = x->re + y->re ; z->im = x->im + y->im ; }"
+ void mycx_add (mycx *z, const mycx *x, const mycx *y)
+ { z->re = x->re + y->re ; z->im = x->im + y->im ; }
+
+#define MYMAX                                                               \
+"void mymax (double *z, const double *x, const double *y) "                 \
+"{ (*z) = ((*x) > (*y)) ? (*x) : (*y) ; }"
+ void mymax (double *z, const double *x, const double *y)
+ { (*z) = ((*x) > (*y)) ? (*x) : (*y) ; }
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, X = NULL ;
+    GrB_BinaryOp MyCxAdd = NULL, MyMax = NULL ;
+    GrB_Monoid MyCxMonoid = NULL, MyMaxMonoid = NULL ;
+    GrB_Type MyCx = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    bool jit_control = false ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, true)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_C_CONTROL, &jit_control)) ;
+    int64_t hits = 0, misses = 0 ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    int64_t nkernels_start = hits + misses ;
+
+    //--------------------------------------------------------------------------
+    // create the user-defined type, operators, and monoids
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Type_new (&MyCx, sizeof (mycx), "mycx", MYCX_DEFN)) ;
+    OK (GxB_BinaryOp_new (&MyCxAdd, (GxB_binary_function) mycx_add,
+        MyCx, MyCx, MyCx, "mycx_add", MYCX_ADD)) ;
+    OK (GxB_BinaryOp_new (&MyMax, (GxB_binary_function) mymax,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mymax", MYMAX)) ;
+    mycx zero = { 0, 0 } ;
+    OK (GrB_Monoid_new_UDT (&MyCxMonoid, MyCxAdd, &zero)) ;
+    OK (GrB_Monoid_new_FP64 (&MyMaxMonoid, MyMax, (double) -INFINITY)) ;
+
+    //--------------------------------------------------------------------------
+    // reduce A and X to scalars, with and without the JIT
+    //--------------------------------------------------------------------------
+
+    int sparsity_list [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (1) ;
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+
+        // A and X are full for the GxB_FULL case, and sparse otherwise
+        int sparsity = sparsity_list [ks] ;
+        GrB_Index n = (sparsity == GxB_FULL) ? 40 : 1000 ;
+        OK (GrB_Matrix_new (&A, MyCx, n, n)) ;
+        OK (GrB_Matrix_new (&X, GrB_FP64, n, n)) ;
+        if (sparsity == GxB_FULL)
+        {
+            for (GrB_Index i = 0 ; i < n ; i++)
+            {
+                for (GrB_Index j = 0 ; j < n ; j++)
+                {
+                    mycx a ;
+                    a.re = (double) (simple_rand ( ) % 9 + 1) ;
+                    a.im = (double) (simple_rand ( ) % 9) ;
+                    OK (GrB_Matrix_setElement_UDT (A, &a, i, j)) ;
+                    OK (GrB_Matrix_setElement_FP64 (X, a.re - a.im, i, j)) ;
+                }
+            }
+        }
+        else
+        {
+            for (int k = 0 ; k < 5000 ; k++)
+            {
+                GrB_Index i = simple_rand ( ) % n ;
+                GrB_Index j = simple_rand ( ) % (n / 10) ;
+                mycx a ;
+                a.re = (double) (simple_rand ( ) % 9 + 1) ;
+                a.im = (double) (simple_rand ( ) % 9) ;
+                OK (GrB_Matrix_setElement_UDT (A, &a, i, j)) ;
+                OK (GrB_Matrix_setElement_FP64 (X, a.re - a.im, i, j)) ;
+            }
+        }
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+        OK (GxB_Matrix_Option_set (X, GxB_SPARSITY_CONTROL, sparsity)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (X, GrB_MATERIALIZE)) ;
+
+        mycx s1, s2 ;
+        double x1, x2 ;
+        OK (GrB_Matrix_reduce_UDT (&s1, NULL, MyCxMonoid, A, NULL)) ;
+        OK (GrB_Matrix_reduce_FP64 (&x1, NULL, MyMaxMonoid, X, NULL)) ;
+        OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, false)) ;
+        OK (GrB_Matrix_reduce_UDT (&s2, NULL, MyCxMonoid, A, NULL)) ;
+        OK (GrB_Matrix_reduce_FP64 (&x2, NULL, MyMaxMonoid, X, NULL)) ;
+        OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, jit_control)) ;
+        CHECK (s1.re == s2.re && s1.im == s2.im) ;
+        CHECK (x1 == x2) ;
+
+        // compare with the built-in MAX monoid
+        OK (GrB_Matrix_reduce_FP64 (&x2, NULL, GrB_MAX_MONOID_FP64, X, NULL)) ;
+        CHECK (x1 == x2) ;
+
+        OK (GrB_Matrix_free_(&A)) ;
+        OK (GrB_Matrix_free_(&X)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check that the JIT compiled or loaded the kernels, if it is enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    if (jit_control)
+    {
+        CHECK (hits + misses > nkernels_start) ;
+    }
+    else
+    {
+        mexPrintf ("JIT not available; generic methods tested only\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_jit_reduce: all tests passed\n\n") ;
+}
@@ -0,0 +1,212 @@
+//------------------------------------------------------------------------------
+// GB_mex_jit_select: test the CPU JIT for GrB_select
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=select(A) is computed with a user-defined GrB_IndexUnaryOp, given with its
+// definition, for a user-defined complex type, where A is sparse,
+// hypersparse, bitmap, and full, with and without transposing A.  Each result
+// is compared with the same selection done with the JIT disabled, which
+// calls the operator through its function pointer.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_jit_select"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Scalar_free_(&Thunk) ;                  \
+    GrB_IndexUnaryOp_free_(&MySelect) ;         \
+    GrB_Type_free_(&MyCx) ;                     \
+    GrB_Descriptor_free_(&desc) ;               \
+}
+
+typedef struct { double re ; double im ; } mycx ;
+#define MYCX_DEFN                                                           \
+"typedef struct { double re ; double im ; } mycx ;"
+
+ void mycx_select (bool *z, const mycx *x, GrB_Index i, GrB_Index j,
+    const double *y) ;
+
+// keep the diagonal, and entries with a real part larger than the thunk y
+#define MYCX_SELECT                                                         \
+"void mycx_select (bool *z, const mycx *x, GrB_Index i, GrB_Index j, "      \
+"    const double *y) "                                                     \
+"{ (*z) = (i == j) || (x->re > (*y)) ; }"
+ void mycx_select (bool *z, const mycx *x, GrB_Index i, GrB_Index j,
+    const double *y)
+ { (*z) = (i == j) || (x->re > (*y)) ; }
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+// X and Y have type mycx, and are held in the same format
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    if (xnvals != ynvals) return (false) ;
+    GrB_Index n = GB_IMAX (xnvals, 1) ;
+    GrB_Index *I1 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *J1 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *I2 = mxMalloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *J2 = mxMalloc (n * sizeof (GrB_Index)) ;
+    mycx *X1 = mxMalloc (n * sizeof (mycx)) ;
+    mycx *X2 = mxMalloc (n * sizeof (mycx)) ;
+    OK (GrB_Matrix_extractTuples_UDT (I1, J1, X1, &xnvals, X)) ;
+    OK (GrB_Matrix_extractTuples_UDT (I2, J2, X2, &ynvals, Y)) ;
+    bool ok = (memcmp (I1, I2, xnvals * sizeof (GrB_Index)) == 0)
+           && (memcmp (J1, J2, xnvals * sizeof (GrB_Index)) == 0)
+           && (memcmp (X1, X2, xnvals * sizeof (mycx)) == 0) ;
+    mxFree (I1) ; mxFree (J1) ; mxFree (X1) ;
+    mxFree (I2) ; mxFree (J2) ; mxFree (X2) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_jit_select mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Scalar Thunk = NULL ;
+    GrB_IndexUnaryOp MySelect = NULL ;
+    GrB_Type MyCx = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    bool jit_control = false ;
+    OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, true)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_C_CONTROL, &jit_control)) ;
+    int64_t hits = 0, misses = 0 ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    int64_t nkernels_start = hits + misses ;
+
+    //--------------------------------------------------------------------------
+    // create the user-defined type and operator
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Type_new (&MyCx, sizeof (mycx), "mycx", MYCX_DEFN)) ;
+    OK (GxB_IndexUnaryOp_new (&MySelect,
+        (GxB_index_unary_function) mycx_select, GrB_BOOL, MyCx, GrB_FP64,
+        "mycx_select", MYCX_SELECT)) ;
+    OK (GrB_Scalar_new (&Thunk, GrB_FP64)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GrB_INP0, GrB_TRAN)) ;
+
+    //--------------------------------------------------------------------------
+    // C = select (A), with and without the JIT
+    //--------------------------------------------------------------------------
+
+    int sparsity_list [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+    simple_rand_seed (1) ;
+
+    for (int ks = 0 ; ks < 4 ; ks++)
+    {
+
+        // A is full for the GxB_FULL case, and sparse otherwise
+        int sparsity = sparsity_list [ks] ;
+        GrB_Index n = (sparsity == GxB_FULL) ? 40 : 500 ;
+        OK (GrB_Matrix_new (&A, MyCx, n, n)) ;
+        int64_t nz = (sparsity == GxB_FULL) ? (n*n) : 5000 ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            GrB_Index i, j ;
+            if (sparsity == GxB_FULL)
+            {
+                i = k % n ;
+                j = k / n ;
+            }
+            else
+            {
+                i = simple_rand ( ) % n ;
+                j = simple_rand ( ) % n ;
+            }
+            mycx a ;
+            a.re = (double) (simple_rand ( ) % 9 + 1) ;
+            a.im = (double) (simple_rand ( ) % 9) ;
+            OK (GrB_Matrix_setElement_UDT (A, &a, i, j)) ;
+        }
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        for (int thunk = 0 ; thunk <= 9 ; thunk += 3)
+        {
+            OK (GrB_Scalar_setElement_FP64 (Thunk, (double) thunk)) ;
+            for (int trans = 0 ; trans <= 1 ; trans++)
+            {
+                GrB_Descriptor D = (trans == 0) ? NULL : desc ;
+                OK (GrB_Matrix_new (&C1, MyCx, n, n)) ;
+                OK (GrB_Matrix_new (&C2, MyCx, n, n)) ;
+                OK (GrB_Matrix_select_Scalar (C1, NULL, NULL, MySelect, A,
+                    Thunk, D)) ;
+                OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, false)) ;
+                OK (GrB_Matrix_select_Scalar (C2, NULL, NULL, MySelect, A,
+                    Thunk, D)) ;
+                OK (GxB_Global_Option_set (GxB_JIT_C_CONTROL, jit_control)) ;
+                OK (GrB_Matrix_wait (C1, GrB_MATERIALIZE)) ;
+                OK (GrB_Matrix_wait (C2, GrB_MATERIALIZE)) ;
+                CHECK (same_matrix (C1, C2)) ;
+                OK (GrB_Matrix_free_(&C1)) ;
+                OK (GrB_Matrix_free_(&C2)) ;
+            }
+        }
+
+        OK (GrB_Matrix_free_(&A)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check that the JIT compiled or loaded the kernels, if it is enabled
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_HITS, &hits)) ;
+    OK (GxB_Global_Option_get (GxB_JIT_CACHE_MISSES, &misses)) ;
+    if (jit_control)
+    {
+        CHECK (hits + misses > nkernels_start) ;
+    }
+    else
+    {
+        mexPrintf ("JIT not available; generic methods tested only\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_jit_select: all tests passed\n\n") ;
+}
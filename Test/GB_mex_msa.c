@@ -0,0 +1,250 @@
+//------------------------------------------------------------------------------
+// GB_mex_msa: test the masked sparse accumulator (MSA) method of saxpy3
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M>=A*B is computed where M is sparse or hypersparse, and sparse enough
+// that GB_AxB_meta selects the MSA method (see GB_AxB_msa_control).  The
+// result is compared with the dot product and Hash methods, with a valued and
+// structural mask, with and without an accum and replace, on 1 and 4 threads.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_msa"
+
+#define FREE_ALL                                        \
+{                                                       \
+    GrB_Matrix_free_(&A) ;                              \
+    GrB_Matrix_free_(&B) ;                              \
+    GrB_Matrix_free_(&M) ;                              \
+    GrB_Matrix_free_(&Cin) ;                            \
+    GrB_Matrix_free_(&C1) ;                             \
+    GrB_Matrix_free_(&C2) ;                             \
+    GrB_Matrix_free_(&D) ;                              \
+    for (int kd = 0 ; kd < 3 ; kd++)                    \
+    {                                                   \
+        for (int km = 0 ; km < 3 ; km++)                \
+        {                                               \
+            GrB_Descriptor_free_(&(desc [kd][km])) ;    \
+        }                                               \
+    }                                                   \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// random_matrix: create a random matrix with about nz entries
+//------------------------------------------------------------------------------
+
+// The values are 1 to 9 for FP64, and 3/4 of the entries are true for BOOL.
+
+static GrB_Info random_matrix
+(
+    GrB_Matrix *A,
+    GrB_Type type,
+    GrB_Index n,
+    GrB_Index nz,
+    int sparsity
+)
+{
+    GrB_Info info = GrB_Matrix_new (A, type, n, n) ;
+    for (GrB_Index k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        GrB_Index i = simple_rand ( ) % n ;
+        GrB_Index j = simple_rand ( ) % n ;
+        if (type == GrB_BOOL)
+        {
+            info = GrB_Matrix_setElement_BOOL (*A, (simple_rand ( ) % 4) != 0,
+                i, j) ;
+        }
+        else
+        {
+            info = GrB_Matrix_setElement_FP64 (*A,
+                (double) (simple_rand ( ) % 9 + 1), i, j) ;
+        }
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Matrix_Option_set (*A, GxB_SPARSITY_CONTROL, sparsity) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_msa mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, Cin = NULL, C1 = NULL, C2 = NULL,
+        D = NULL ;
+    GrB_Descriptor desc [3][3] ;
+    for (int kd = 0 ; kd < 3 ; kd++)
+    {
+        for (int km = 0 ; km < 3 ; km++)
+        {
+            desc [kd][km] = NULL ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+
+    // desc [kd][km]: kd is 0 (valued mask), 1 (structural mask), or 2 (valued
+    // mask with replace); km is 0 (default: MSA), 1 (dot), or 2 (Hash)
+    GrB_Desc_Value methods [3] = { GxB_DEFAULT, GxB_AxB_DOT, GxB_AxB_HASH } ;
+    for (int kd = 0 ; kd < 3 ; kd++)
+    {
+        for (int km = 0 ; km < 3 ; km++)
+        {
+            OK (GrB_Descriptor_new (&(desc [kd][km]))) ;
+            OK (GxB_Desc_set (desc [kd][km], GxB_AxB_METHOD, methods [km])) ;
+            if (kd == 1)
+            {
+                OK (GxB_Desc_set (desc [kd][km], GrB_MASK, GrB_STRUCTURE)) ;
+            }
+            else if (kd == 2)
+            {
+                OK (GxB_Desc_set (desc [kd][km], GrB_OUTP, GrB_REPLACE)) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // create A, B, and C_in
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1000 ;
+    simple_rand_seed (1) ;
+    OK (random_matrix (&A, GrB_FP64, n, 10*n, GxB_SPARSE)) ;
+    OK (random_matrix (&B, GrB_FP64, n, 10*n, GxB_SPARSE)) ;
+    OK (random_matrix (&Cin, GrB_FP64, n, 5*n, GxB_SPARSE)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+    //--------------------------------------------------------------------------
+    // check when the MSA method is selected
+    //--------------------------------------------------------------------------
+
+    // not if M is complemented, bitmap, too sparse, or too dense
+    OK (random_matrix (&M, GrB_BOOL, n, 5*n, GxB_SPARSE)) ;
+    CHECK (GB_AxB_msa_control (M, false, A, B)) ;
+    CHECK (!GB_AxB_msa_control (M, true, A, B)) ;
+    CHECK (!GB_AxB_msa_control (NULL, false, A, B)) ;
+    OK (GxB_Matrix_Option_set (M, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    CHECK (!GB_AxB_msa_control (M, false, A, B)) ;
+    OK (GrB_Matrix_free_(&M)) ;
+    OK (random_matrix (&M, GrB_BOOL, n, n/2, GxB_SPARSE)) ;
+    CHECK (!GB_AxB_msa_control (M, false, A, B)) ;
+    OK (GrB_Matrix_free_(&M)) ;
+    OK (random_matrix (&M, GrB_BOOL, n, n*n/8, GxB_SPARSE)) ;
+    CHECK (!GB_AxB_msa_control (M, false, A, B)) ;
+    OK (GrB_Matrix_free_(&M)) ;
+
+    //--------------------------------------------------------------------------
+    // compare C<M>=A*B with the MSA, dot product, and Hash methods
+    //--------------------------------------------------------------------------
+
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GxB_ANY_PAIR_FP64 } ;
+
+    for (int kmsparsity = 0 ; kmsparsity <= 1 ; kmsparsity++)
+    {
+        // M is sparse or hypersparse
+        OK (random_matrix (&M, GrB_BOOL, n, 5*n,
+            (kmsparsity == 0) ? GxB_SPARSE : GxB_HYPERSPARSE)) ;
+        CHECK (GB_AxB_msa_control (M, false, A, B)) ;
+
+        for (int ks = 0 ; ks < 3 ; ks++)
+        {
+            GrB_Semiring semiring = semirings [ks] ;
+            for (int kd = 0 ; kd < 3 ; kd++)
+            {
+                for (int kaccum = 0 ; kaccum <= 1 ; kaccum++)
+                {
+                    GrB_BinaryOp accum = (kaccum == 0) ? NULL : GrB_PLUS_FP64 ;
+                    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                    {
+                        OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads)) ;
+
+                        // C1<M> = A*B with the dot product method
+                        OK (GrB_Matrix_dup (&C1, Cin)) ;
+                        OK (GrB_mxm (C1, M, accum, semiring, A, B,
+                            desc [kd][1])) ;
+
+                        // C2<M> = A*B with the MSA and Hash methods
+                        for (int km = 0 ; km <= 2 ; km += 2)
+                        {
+                            OK (GrB_Matrix_dup (&C2, Cin)) ;
+                            OK (GrB_mxm (C2, M, accum, semiring, A, B,
+                                desc [kd][km])) ;
+                            CHECK (same_matrix (C1, C2, D)) ;
+                            OK (GrB_Matrix_free_(&C2)) ;
+                        }
+
+                        // C2<M> = A*B with the MSA method, C2 initially empty
+                        OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+                        OK (GrB_mxm (C2, M, NULL, semiring, A, B,
+                            desc [kd][0])) ;
+                        OK (GrB_Matrix_clear (C1)) ;
+                        OK (GrB_mxm (C1, M, NULL, semiring, A, B,
+                            desc [kd][1])) ;
+                        CHECK (same_matrix (C1, C2, D)) ;
+                        OK (GrB_Matrix_free_(&C1)) ;
+                        OK (GrB_Matrix_free_(&C2)) ;
+                    }
+                }
+            }
+        }
+        OK (GrB_Matrix_free_(&M)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_msa: all tests passed\n\n") ;
+}
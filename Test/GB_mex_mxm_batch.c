@@ -0,0 +1,255 @@
+//------------------------------------------------------------------------------
+// GB_mex_mxm_batch: test GxB_mxm_batch
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B and C=A*B' are computed by GxB_mxm_batch one block at a time, with the
+// default format by column (CSC) and by row (CSR).  The blocks are assembled
+// into a single matrix by the callback, and compared with GrB_mxm.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_mxm_batch"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Matrix_free_(&(batch.C)) ;              \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// batch_assemble: the callback for GxB_mxm_batch
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    GrB_Matrix C ;          // C is assembled from the blocks
+    bool by_col ;           // true if the blocks are C(:,k:k+n-1)
+    GrB_Index next ;        // next expected k
+    int nblocks ;           // # of blocks seen so far
+    int fail_at ;           // return an error at this block, if >= 0
+    bool take ;             // if true, take ownership of each block
+    bool ok ;               // false if a block is not as expected
+}
+batch_struct ;
+
+static GrB_Info batch_assemble
+(
+    GrB_Matrix *Block,
+    GrB_Index k,
+    void *user_data
+)
+{
+    batch_struct *batch = (batch_struct *) user_data ;
+    GrB_Matrix T = (*Block) ;
+    if (batch->nblocks++ == batch->fail_at) return (GrB_INVALID_VALUE) ;
+
+    // the blocks appear in order, in the default format
+    GrB_Index cnrows, cncols, tnrows, tncols ;
+    GrB_Info info = GrB_Matrix_nrows (&cnrows, batch->C) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_ncols (&cncols, batch->C) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_nrows (&tnrows, T) ;
+    if (info == GrB_SUCCESS) info = GrB_Matrix_ncols (&tncols, T) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    GrB_Index n = batch->by_col ? tncols : tnrows ;
+    batch->ok = batch->ok && (k == batch->next) && (n > 0)
+        && (T->is_csc == batch->by_col)
+        && (batch->by_col ? (tnrows == cnrows) : (tncols == cncols)) ;
+    batch->next = k + n ;
+
+    // C(:,k:k+n-1) = T or C(k:k+n-1,:) = T
+    GrB_Index range [2] = { k, k+n-1 } ;
+    if (batch->by_col)
+    {
+        info = GrB_Matrix_assign (batch->C, NULL, NULL, T, GrB_ALL, cnrows,
+            range, GxB_RANGE, NULL) ;
+    }
+    else
+    {
+        info = GrB_Matrix_assign (batch->C, NULL, NULL, T, range, GxB_RANGE,
+            GrB_ALL, cncols, NULL) ;
+    }
+
+    // take ownership of the block, and free it
+    if (batch->take && info == GrB_SUCCESS)
+    {
+        (*Block) = NULL ;
+        info = GrB_Matrix_free (&T) ;
+    }
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_mxm_batch mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info, expected ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    batch_struct batch ;
+    batch.C = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    GxB_Format_Value format_save ;
+    OK (GxB_Global_Option_get (GxB_FORMAT, &format_save)) ;
+    GrB_Index n = 500 ;
+
+    for (int kformat = 0 ; kformat <= 1 ; kformat++)
+    {
+
+        //----------------------------------------------------------------------
+        // create A and B in the default format
+        //----------------------------------------------------------------------
+
+        bool by_col = (kformat == 0) ;
+        OK (GxB_Global_Option_set (GxB_FORMAT,
+            by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+        simple_rand_seed (1) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        for (int k = 0 ; k < 5000 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A,
+                (double) (simple_rand ( ) % 9 + 1),
+                simple_rand ( ) % n, simple_rand ( ) % n)) ;
+            OK (GrB_Matrix_setElement_FP64 (B,
+                (double) (simple_rand ( ) % 9 + 1),
+                simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+        // ktrans 0: C=A*B, ktrans 1: C=A*B'
+        for (int ktrans = 0 ; ktrans <= 1 ; ktrans++)
+        {
+            GrB_Descriptor desc = (ktrans == 0) ? NULL : GrB_DESC_T1 ;
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                desc)) ;
+            GrB_Index cnvals ;
+            OK (GrB_Matrix_nvals (&cnvals, C1)) ;
+
+            // batch_size 0: one block; otherwise about 8 or 50 blocks
+            double batch_sizes [3] = { 0, cnvals * 16 / 8, cnvals * 16 / 50 } ;
+
+            for (int kb = 0 ; kb < 3 ; kb++)
+            {
+                for (int take = 0 ; take <= 1 ; take++)
+                {
+                    OK (GrB_Matrix_new (&(batch.C), GrB_FP64, n, n)) ;
+                    batch.by_col = by_col ;
+                    batch.next = 0 ;
+                    batch.nblocks = 0 ;
+                    batch.fail_at = -1 ;
+                    batch.take = take ;
+                    batch.ok = true ;
+                    OK (GxB_mxm_batch (batch_assemble, &batch,
+                        batch_sizes [kb], GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                        desc)) ;
+                    CHECK (batch.ok) ;
+                    CHECK (batch.next == n) ;
+                    if (kb == 0)
+                    {
+                        CHECK (batch.nblocks == 1) ;
+                    }
+                    else
+                    {
+                        CHECK (batch.nblocks > 1) ;
+                    }
+                    CHECK (same_matrix (batch.C, C1, D)) ;
+                    OK (GrB_Matrix_free_(&(batch.C))) ;
+                }
+            }
+
+            //------------------------------------------------------------------
+            // an error returned by the callback stops the computation
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&(batch.C), GrB_FP64, n, n)) ;
+            batch.next = 0 ;
+            batch.nblocks = 0 ;
+            batch.fail_at = 2 ;
+            batch.take = false ;
+            batch.ok = true ;
+            expected = GrB_INVALID_VALUE ;
+            ERR (GxB_mxm_batch (batch_assemble, &batch, batch_sizes [2],
+                GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+            CHECK (batch.nblocks == 3) ;
+            OK (GrB_Matrix_free_(&(batch.C))) ;
+            OK (GrB_Matrix_free_(&C1)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // error handling
+        //----------------------------------------------------------------------
+
+        expected = GrB_NULL_POINTER ;
+        ERR (GxB_mxm_batch (NULL, NULL, 0, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        ERR (GxB_mxm_batch (batch_assemble, &batch, 0, NULL, A, B, NULL)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, n+1, n)) ;
+        expected = GrB_DIMENSION_MISMATCH ;
+        ERR (GxB_mxm_batch (batch_assemble, &batch, 0,
+            GrB_PLUS_TIMES_SEMIRING_FP64, A, C2, NULL)) ;
+
+        OK (GrB_Matrix_free_(&A)) ;
+        OK (GrB_Matrix_free_(&B)) ;
+        OK (GrB_Matrix_free_(&C2)) ;
+        OK (GrB_Matrix_free_(&D)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_FORMAT, format_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_mxm_batch: all tests passed\n\n") ;
+}
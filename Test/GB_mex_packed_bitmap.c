@@ -0,0 +1,289 @@
+//------------------------------------------------------------------------------
+// GB_mex_packed_bitmap: test the packed bitmap (GxB_BITMAP_PACKED)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// F and V are boolean iso bitmaps with one column per source, like the
+// frontier and the set of visited nodes of a multi-source BFS.  They are held
+// as packed bitmaps, with one bit per entry, and the results of eWiseMult,
+// eWiseAdd (done by GB_bitmap_packed_ewise), and other methods are compared
+// with the same computations on unpacked copies.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_packed_bitmap"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&F) ;                      \
+    GrB_Matrix_free_(&V) ;                      \
+    GrB_Matrix_free_(&Fref) ;                   \
+    GrB_Matrix_free_(&Vref) ;                   \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Vector_free_(&v) ;                      \
+}
+
+#define PACKED(X) (((GrB_Matrix) (X))->magic == GB_MAGIC_PACKED)
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// random_set: create a random boolean n-by-ns matrix, with all entries true
+//------------------------------------------------------------------------------
+
+static GrB_Info random_set
+(
+    GrB_Matrix *A,
+    GrB_Index n,
+    GrB_Index ns,
+    GrB_Index nz
+)
+{
+    GrB_Info info = GrB_Matrix_new (A, GrB_BOOL, n, ns) ;
+    for (GrB_Index k = 0 ; k < nz && info == GrB_SUCCESS ; k++)
+    {
+        info = GrB_Matrix_setElement_BOOL (*A, true,
+            simple_rand ( ) % n, simple_rand ( ) % ns) ;
+    }
+    if (info == GrB_SUCCESS)
+    {
+        info = GxB_Matrix_Option_set (*A, GxB_SPARSITY_CONTROL, GxB_BITMAP) ;
+    }
+    if (info == GrB_SUCCESS) info = GrB_Matrix_wait (*A, GrB_MATERIALIZE) ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_packed_bitmap mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix F = NULL, V = NULL, Fref = NULL, Vref = NULL, C1 = NULL,
+        C2 = NULL, A = NULL, D = NULL ;
+    GrB_Vector v = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // create the packed bitmaps F and V, and unpacked copies
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1000, ns = 64 ;
+    simple_rand_seed (1) ;
+    OK (random_set (&Fref, n, ns, 3000)) ;
+    OK (random_set (&Vref, n, ns, 20000)) ;
+    OK (GrB_Matrix_dup (&F, Fref)) ;
+    OK (GrB_Matrix_dup (&V, Vref)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, ns)) ;
+
+    bool packed = true ;
+    OK (GxB_Matrix_Option_get (F, GxB_BITMAP_PACKED, &packed)) ;
+    CHECK (!packed) ;
+    CHECK (!PACKED (F)) ;
+    OK (GxB_Matrix_Option_set (F, GxB_BITMAP_PACKED, true)) ;
+    OK (GxB_Matrix_Option_set (V, GxB_BITMAP_PACKED, true)) ;
+    OK (GxB_Matrix_Option_get (F, GxB_BITMAP_PACKED, &packed)) ;
+    CHECK (packed) ;
+    CHECK (PACKED (F) && PACKED (V)) ;
+    CHECK (F->iso && V->iso) ;
+
+    // nvals, memoryUsage, and GxB_print do not unpack the matrix
+    GrB_Index nvals1, nvals2 ;
+    OK (GrB_Matrix_nvals (&nvals1, V)) ;
+    OK (GrB_Matrix_nvals (&nvals2, Vref)) ;
+    CHECK (nvals1 == nvals2) ;
+    size_t size1, size2 ;
+    OK (GxB_Matrix_memoryUsage (&size1, V)) ;
+    OK (GxB_Matrix_memoryUsage (&size2, Vref)) ;
+    CHECK (size1 < size2) ;
+    OK (GxB_Matrix_fprint (V, "V", GxB_SHORT, NULL)) ;
+    OK (GxB_Matrix_fprint (V, "V", GxB_COMPLETE, NULL)) ;
+    CHECK (PACKED (V)) ;
+
+    //--------------------------------------------------------------------------
+    // eWiseMult and eWiseAdd on packed bitmaps
+    //--------------------------------------------------------------------------
+
+    // trial 0: C = F.*V
+    // trial 1: C = F+V
+    // trial 2: C<!V,struct,replace> = F+F
+    // trial 3: C = F.*V, and then C += F
+
+    for (int trial = 0 ; trial <= 3 ; trial++)
+    {
+        OK (GrB_Matrix_new (&C1, GrB_BOOL, n, ns)) ;
+        OK (GrB_Matrix_new (&C2, GrB_BOOL, n, ns)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+        OK (GxB_Matrix_Option_set (C1, GxB_BITMAP_PACKED, true)) ;
+        if (trial == 0 || trial == 3)
+        {
+            OK (GrB_Matrix_eWiseMult_BinaryOp (C1, NULL, NULL, GrB_LAND,
+                F, V, NULL)) ;
+            OK (GrB_Matrix_eWiseMult_BinaryOp (C2, NULL, NULL, GrB_LAND,
+                Fref, Vref, NULL)) ;
+        }
+        else if (trial == 1)
+        {
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C1, NULL, NULL, GrB_LOR,
+                F, V, NULL)) ;
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, NULL, GrB_LOR,
+                Fref, Vref, NULL)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C1, V, NULL, GrB_LOR,
+                F, F, GrB_DESC_RSC)) ;
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, Vref, NULL, GrB_LOR,
+                Fref, Fref, GrB_DESC_RSC)) ;
+        }
+        if (trial == 3)
+        {
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C1, NULL, GrB_LOR, GrB_LOR,
+                F, F, NULL)) ;
+            OK (GrB_Matrix_eWiseAdd_BinaryOp (C2, NULL, GrB_LOR, GrB_LOR,
+                Fref, Fref, NULL)) ;
+        }
+        // C1 is computed directly on the packed bitmaps, and left packed
+        CHECK (PACKED (C1)) ;
+        CHECK (PACKED (F) && PACKED (V)) ;
+        CHECK (same_matrix (C1, C2, D)) ;
+        OK (GrB_Matrix_free_(&C1)) ;
+        OK (GrB_Matrix_free_(&C2)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // other methods leave a packed input packed
+    //--------------------------------------------------------------------------
+
+    // A is a random n-by-n sparse matrix
+    OK (GrB_Matrix_new (&A, GrB_BOOL, n, n)) ;
+    for (int k = 0 ; k < 5000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (A, true, simple_rand ( ) % n,
+            simple_rand ( ) % n)) ;
+    }
+
+    // C<!V,struct,replace> = A*F, one step of a multi-source BFS
+    OK (GrB_Matrix_new (&C1, GrB_BOOL, n, ns)) ;
+    OK (GrB_Matrix_new (&C2, GrB_BOOL, n, ns)) ;
+    OK (GrB_mxm (C1, V, NULL, GrB_LOR_LAND_SEMIRING_BOOL, A, F,
+        GrB_DESC_RSC)) ;
+    OK (GrB_mxm (C2, Vref, NULL, GrB_LOR_LAND_SEMIRING_BOOL, A, Fref,
+        GrB_DESC_RSC)) ;
+    CHECK (PACKED (F) && PACKED (V)) ;
+    CHECK (same_matrix (C1, C2, D)) ;
+    OK (GrB_Matrix_free_(&C1)) ;
+    OK (GrB_Matrix_free_(&C2)) ;
+
+    // C = F'
+    OK (GrB_Matrix_new (&C1, GrB_BOOL, ns, n)) ;
+    OK (GrB_Matrix_new (&C2, GrB_BOOL, ns, n)) ;
+    OK (GrB_transpose (C1, NULL, NULL, F, NULL)) ;
+    OK (GrB_transpose (C2, NULL, NULL, Fref, NULL)) ;
+    CHECK (PACKED (F)) ;
+    OK (GrB_Matrix_free_(&D)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, ns, n)) ;
+    CHECK (same_matrix (C1, C2, D)) ;
+    OK (GrB_Matrix_free_(&C1)) ;
+    OK (GrB_Matrix_free_(&C2)) ;
+    OK (GrB_Matrix_free_(&D)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, ns)) ;
+
+    // extractElement reads the packed bitmap directly
+    for (GrB_Index i = 0 ; i < n ; i += 7)
+    {
+        for (GrB_Index j = 0 ; j < ns ; j += 3)
+        {
+            bool x1 = false, x2 = false ;
+            GrB_Info info1 = GrB_Matrix_extractElement_BOOL (&x1, V, i, j) ;
+            GrB_Info info2 = GrB_Matrix_extractElement_BOOL (&x2, Vref, i, j) ;
+            CHECK (info1 == info2 && x1 == x2) ;
+        }
+    }
+    CHECK (PACKED (V)) ;
+
+    //--------------------------------------------------------------------------
+    // a modified matrix is unpacked, and packed again by GrB_wait
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_setElement_BOOL (V, true, 0, 0)) ;
+    OK (GrB_Matrix_setElement_BOOL (Vref, true, 0, 0)) ;
+    CHECK (!PACKED (V)) ;
+    OK (GrB_Matrix_wait (V, GrB_COMPLETE)) ;
+    CHECK (PACKED (V)) ;
+    CHECK (same_matrix (V, Vref, D)) ;
+
+    // clearing the option unpacks the matrix
+    OK (GxB_Matrix_Option_set (F, GxB_BITMAP_PACKED, false)) ;
+    CHECK (!PACKED (F)) ;
+    OK (GrB_Matrix_wait (F, GrB_COMPLETE)) ;
+    CHECK (!PACKED (F)) ;
+    CHECK (same_matrix (F, Fref, D)) ;
+
+    //--------------------------------------------------------------------------
+    // vectors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&v, GrB_BOOL, n)) ;
+    for (GrB_Index i = 0 ; i < n ; i += 3)
+    {
+        OK (GrB_Vector_setElement_BOOL (v, true, i)) ;
+    }
+    OK (GxB_Vector_Option_set (v, GxB_SPARSITY_CONTROL, GxB_BITMAP)) ;
+    OK (GxB_Vector_Option_set (v, GxB_BITMAP_PACKED, true)) ;
+    CHECK (PACKED (v)) ;
+    OK (GrB_Vector_nvals (&nvals1, v)) ;
+    CHECK (nvals1 == (n+2) / 3) ;
+    OK (GxB_Vector_fprint (v, "v", GxB_SHORT, NULL)) ;
+    CHECK (PACKED (v)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_packed_bitmap: all tests passed\n\n") ;
+}
@@ -0,0 +1,250 @@
+//------------------------------------------------------------------------------
+// GB_mex_plan: test the reuse of the saxpy3 analysis (GxB_AxB_PLAN)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed many times into a matrix C with the GxB_AxB_PLAN option,
+// as the values of A and B change, and then as the pattern of A changes (which
+// must not reuse the plan).  Each result is compared with the same product
+// computed into a matrix without the option.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_plan"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&A0) ;                     \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&C) ;                      \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&Cref) ;                   \
+    GrB_Matrix_free_(&D) ;                      \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// plan_match: true if the plan of C can be used for C=A*B
+//------------------------------------------------------------------------------
+
+// The settings are taken from the plan itself, so only the patterns of A and
+// B are checked.
+
+static bool plan_match (GrB_Matrix C, GrB_Matrix A, GrB_Matrix B)
+{
+    const GB_saxpy3_plan_struct *plan = C->saxpy3_plan ;
+    return (plan != NULL && GB_AxB_saxpy3_plan_match (plan, A, B,
+        plan->C_sparsity, plan->AxB_method, plan->nthreads_max, plan->chunk)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_plan mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, A0 = NULL, B = NULL, C = NULL, C2 = NULL,
+        Cref = NULL, D = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+
+    //--------------------------------------------------------------------------
+    // create A and B, and C with the GxB_AxB_PLAN option
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 2000 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 8000 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+    OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+    bool keep_plan = true ;
+    OK (GxB_Matrix_Option_get (C, GxB_AxB_PLAN, &keep_plan)) ;
+    CHECK (!keep_plan) ;
+    OK (GxB_Matrix_Option_set (C, GxB_AxB_PLAN, true)) ;
+    OK (GxB_Matrix_Option_get (C, GxB_AxB_PLAN, &keep_plan)) ;
+    CHECK (keep_plan) ;
+    CHECK (C->saxpy3_plan == NULL) ;
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads)) ;
+
+        //----------------------------------------------------------------------
+        // the first C=A*B constructs the plan
+        //----------------------------------------------------------------------
+
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        CHECK (plan_match (C, A, B)) ;
+        const GB_saxpy3_plan_struct *plan = C->saxpy3_plan ;
+        OK (GrB_Matrix_new (&Cref, GrB_FP64, n, n)) ;
+        OK (GrB_mxm (Cref, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        CHECK (Cref->saxpy3_plan == NULL) ;
+        CHECK (same_matrix (C, Cref, D)) ;
+        OK (GrB_Matrix_free_(&Cref)) ;
+
+        //----------------------------------------------------------------------
+        // the plan is reused when only the values of A and B change
+        //----------------------------------------------------------------------
+
+        for (int trial = 0 ; trial < 3 ; trial++)
+        {
+            OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (A, NULL, NULL,
+                GrB_PLUS_FP64, A, (double) 1, NULL)) ;
+            OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (B, NULL, NULL,
+                GrB_TIMES_FP64, B, (double) 2, NULL)) ;
+            CHECK (plan_match (C, A, B)) ;
+            OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                NULL)) ;
+            // the same plan is still in C
+            CHECK (C->saxpy3_plan == plan) ;
+            OK (GrB_Matrix_new (&Cref, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (Cref, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+                NULL)) ;
+            CHECK (same_matrix (C, Cref, D)) ;
+            OK (GrB_Matrix_free_(&Cref)) ;
+        }
+
+        //----------------------------------------------------------------------
+        // a change in the pattern of A invalidates the plan
+        //----------------------------------------------------------------------
+
+        // move one entry of A, so that nnz(A) does not change
+        OK (GrB_Matrix_dup (&A0, A)) ;
+        GrB_Index anvals0, anvals1 ;
+        OK (GrB_Matrix_nvals (&anvals0, A)) ;
+        GrB_Index i = 0, j = 0 ;
+        double x = 0 ;
+        while (GrB_Matrix_extractElement_FP64 (&x, A, i, j) != GrB_SUCCESS)
+        {
+            i = simple_rand ( ) % n ;
+            j = simple_rand ( ) % n ;
+        }
+        GrB_Index i2 = i, j2 = j ;
+        while (GrB_Matrix_extractElement_FP64 (&x, A, i2, j2) == GrB_SUCCESS)
+        {
+            i2 = simple_rand ( ) % n ;
+            j2 = simple_rand ( ) % n ;
+        }
+        OK (GrB_Matrix_removeElement (A, i, j)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, (double) 3, i2, j2)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_nvals (&anvals1, A)) ;
+        CHECK (anvals0 == anvals1) ;
+        CHECK (!plan_match (C, A, B)) ;
+
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        OK (GrB_Matrix_new (&Cref, GrB_FP64, n, n)) ;
+        OK (GrB_mxm (Cref, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        CHECK (same_matrix (C, Cref, D)) ;
+        OK (GrB_Matrix_free_(&Cref)) ;
+
+        // C now has a plan for the new pattern of A, not the old one
+        CHECK (plan_match (C, A, B)) ;
+        CHECK (!plan_match (C, A0, B)) ;
+        OK (GrB_Matrix_free_(&A0)) ;
+
+        // add an entry to B
+        while (GrB_Matrix_extractElement_FP64 (&x, B, i2, j2) == GrB_SUCCESS)
+        {
+            i2 = simple_rand ( ) % n ;
+            j2 = simple_rand ( ) % n ;
+        }
+        OK (GrB_Matrix_setElement_FP64 (B, (double) 1, i2, j2)) ;
+        OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+        CHECK (!plan_match (C, A, B)) ;
+        OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        OK (GrB_Matrix_new (&Cref, GrB_FP64, n, n)) ;
+        OK (GrB_mxm (Cref, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        CHECK (same_matrix (C, Cref, D)) ;
+        OK (GrB_Matrix_free_(&Cref)) ;
+        CHECK (plan_match (C, A, B)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the plan is counted by memoryUsage, not copied by dup, and freed
+    //--------------------------------------------------------------------------
+
+    size_t size1, size2 ;
+    OK (GxB_Matrix_memoryUsage (&size1, C)) ;
+    OK (GrB_Matrix_dup (&C2, C)) ;
+    CHECK (C2->saxpy3_plan == NULL) ;
+    OK (GxB_Matrix_Option_get (C2, GxB_AxB_PLAN, &keep_plan)) ;
+    CHECK (keep_plan) ;
+    OK (GxB_Matrix_memoryUsage (&size2, C2)) ;
+    CHECK (size1 > size2) ;
+
+    OK (GxB_Matrix_Option_set (C, GxB_AxB_PLAN, false)) ;
+    CHECK (C->saxpy3_plan == NULL) ;
+    OK (GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, NULL)) ;
+    CHECK (C->saxpy3_plan == NULL) ;
+    CHECK (same_matrix (C, C2, D)) ;
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_plan: all tests passed\n\n") ;
+}
@@ -0,0 +1,246 @@
+//------------------------------------------------------------------------------
+// GB_mex_private_fine: test the fine Gustavson tasks with private workspaces
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C=A*B is computed where B has a hub column, B(:,0), that is split into a
+// team of fine Gustavson tasks.  Each row of C(:,0) is updated many times, so
+// GB_AxB_saxpy3_slice_balanced gives each task of the team its own private
+// workspace, which are merged into C(:,0) when the team is done.  The result
+// is compared with the same product computed on a single thread, and with the
+// dot product method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_private_fine"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Matrix_free_(&B) ;                      \
+    GrB_Matrix_free_(&M) ;                      \
+    GrB_Matrix_free_(&C1) ;                     \
+    GrB_Matrix_free_(&C2) ;                     \
+    GrB_Matrix_free_(&D) ;                      \
+    GrB_Descriptor_free_(&desc) ;               \
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: true if X and Y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix X, GrB_Matrix Y, GrB_Matrix D)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = true ;
+    OK (GrB_Matrix_clear (D)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (D, NULL, NULL, GrB_EQ_FP64, X, Y,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&xnvals, X)) ;
+    OK (GrB_Matrix_nvals (&ynvals, Y)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_Matrix_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+//------------------------------------------------------------------------------
+// count_private: count the fine tasks that saxpy3 would give a private
+// workspace for C=A*B
+//------------------------------------------------------------------------------
+
+// B must be sparse, not hypersparse.
+
+static GrB_Info count_private
+(
+    int *nprivate,          // # of fine tasks with a private workspace
+    int *nfine,             // # of fine tasks
+    GrB_Matrix M,           // optional mask
+    GrB_Matrix A,
+    GrB_Matrix B,
+    int nthreads_max,
+    double chunk,
+    GB_Context Context
+)
+{
+    GrB_Info info ;
+    GrB_Matrix W = NULL ;
+    GB_saxpy3task_struct *SaxpyTasks = NULL ;
+    size_t SaxpyTasks_size = 0 ;
+    bool apply_mask, M_in_place ;
+    int ntasks, nthreads ;
+    (*nprivate) = 0 ;
+    (*nfine) = 0 ;
+    Context->nthreads_max = nthreads_max ;
+    Context->chunk = chunk ;
+
+    // W->p is the workspace for the flop counts, of size B->vdim+1
+    OK (GrB_Matrix_dup (&W, B)) ;
+    CHECK (GB_IS_SPARSE (W)) ;
+    info = GB_AxB_saxpy3_slice_balanced (W, M, false, A, B, GxB_DEFAULT, 0,
+        &SaxpyTasks, &SaxpyTasks_size, &apply_mask, &M_in_place, &ntasks,
+        nfine, &nthreads, Context) ;
+    if (info == GrB_SUCCESS)
+    {
+        for (int taskid = 0 ; taskid < (*nfine) ; taskid++)
+        {
+            if (SaxpyTasks [taskid].use_private) (*nprivate)++ ;
+        }
+    }
+    GB_FREE_WORK (&SaxpyTasks, SaxpyTasks_size) ;
+    OK (GrB_Matrix_free_(&W)) ;
+    // GrB_NO_VALUE if the mask is discarded
+    return ((info == GrB_NO_VALUE) ? GrB_SUCCESS : info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_private_fine mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL, D = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    int nthreads_save ;
+    double chunk_save ;
+    OK (GxB_Global_Option_get (GxB_NTHREADS, &nthreads_save)) ;
+    OK (GxB_Global_Option_get (GxB_CHUNK, &chunk_save)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GxB_Desc_set (desc, GxB_AxB_METHOD, GxB_AxB_DOT)) ;
+
+    //--------------------------------------------------------------------------
+    // A has about 100 entries per column, and B(:,0) is a hub
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 1000 ;
+    simple_rand_seed (1) ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+    for (int k = 0 ; k < 100*n ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, simple_rand ( ) % n)) ;
+    }
+    for (GrB_Index i = 0 ; i < n ; i++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9 + 1),
+            i, 0)) ;
+    }
+    for (int k = 0 ; k < n ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (simple_rand ( ) % 9 + 1),
+            simple_rand ( ) % n, 1 + simple_rand ( ) % (n-1))) ;
+    }
+    OK (GxB_Matrix_Option_set (B, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, n, n)) ;
+
+    // M is a sparse mask
+    OK (GrB_Matrix_new (&M, GrB_BOOL, n, n)) ;
+    for (int k = 0 ; k < 10*n ; k++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (M, true, simple_rand ( ) % n,
+            simple_rand ( ) % n)) ;
+    }
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // check that the private workspaces are selected
+    //--------------------------------------------------------------------------
+
+    // B(:,0) takes half the flops of C=A*B, so with 16 threads and a small
+    // chunk it is split into a team of fine tasks, and each task still does
+    // much more work than n.
+    GB_CONTEXT (USAGE) ;
+    int nprivate, nfine ;
+    OK (count_private (&nprivate, &nfine, NULL, A, B, 16, 100, Context)) ;
+    CHECK (nfine > 1 && nprivate == nfine) ;
+
+    // not with a single thread
+    OK (count_private (&nprivate, &nfine, NULL, A, B, 1, 100, Context)) ;
+    CHECK (nprivate == 0) ;
+
+    // not when the mask is applied during saxpy3
+    OK (count_private (&nprivate, &nfine, M, A, B, 16, 100, Context)) ;
+    CHECK (nprivate == 0) ;
+
+    //--------------------------------------------------------------------------
+    // compare C=A*B and C<M>=A*B with a single thread and the dot product
+    //--------------------------------------------------------------------------
+
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, GxB_ANY_PAIR_FP64 } ;
+
+    for (int ks = 0 ; ks < 3 ; ks++)
+    {
+        GrB_Semiring semiring = semirings [ks] ;
+        for (int kmask = 0 ; kmask <= 1 ; kmask++)
+        {
+            GrB_Matrix Mask = (kmask == 0) ? NULL : M ;
+
+            // C2 = A*B on a single thread, and with the dot product
+            OK (GxB_Global_Option_set (GxB_NTHREADS, 1)) ;
+            OK (GrB_Matrix_new (&C2, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C2, Mask, NULL, semiring, A, B, NULL)) ;
+            OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+            OK (GrB_mxm (C1, Mask, NULL, semiring, A, B, desc)) ;
+            CHECK (same_matrix (C1, C2, D)) ;
+            OK (GrB_Matrix_free_(&C1)) ;
+
+            // C1 = A*B on 4 and 16 threads, with a small and large chunk
+            for (int kchunk = 0 ; kchunk <= 3 ; kchunk++)
+            {
+                OK (GxB_Global_Option_set (GxB_NTHREADS,
+                    (kchunk < 2) ? 16 : 4)) ;
+                OK (GxB_Global_Option_set (GxB_CHUNK,
+                    (double) ((kchunk % 2 == 0) ? (4*n) : 100))) ;
+                OK (GrB_Matrix_new (&C1, GrB_FP64, n, n)) ;
+                OK (GrB_mxm (C1, Mask, NULL, semiring, A, B, NULL)) ;
+                CHECK (same_matrix (C1, C2, D)) ;
+
+                // C1 += A*B
+                OK (GrB_mxm (C1, Mask, GrB_PLUS_FP64, semiring, A, B, NULL)) ;
+                OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (C1, NULL, NULL,
+                    GrB_DIV_FP64, C1, (double) 2, NULL)) ;
+                CHECK (same_matrix (C1, C2, D)) ;
+                OK (GrB_Matrix_free_(&C1)) ;
+            }
+            OK (GrB_Matrix_free_(&C2)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set (GxB_NTHREADS, nthreads_save)) ;
+    OK (GxB_Global_Option_set (GxB_CHUNK, chunk_save)) ;
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_private_fine: all tests passed\n\n") ;
+}
@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// GB_mex_pushpull: test the push/pull selection for GrB_mxv and GrB_vxm
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<m>=A*u and w'<m'>=u'*A are computed with the default method, for which
+// push (saxpy) or pull (dot) is selected by GB_AxB_meta_pushpull.  The
+// selection is checked with GxB_PUSHPULL_STATS, and the result is compared
+// with the same product computed with an explicit saxpy or dot method.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_pushpull"
+
+#define FREE_ALL                                \
+{                                               \
+    GrB_Matrix_free_(&A) ;                      \
+    GrB_Vector_free_(&u) ;                      \
+    GrB_Vector_free_(&m) ;                      \
+    GrB_Vector_free_(&w1) ;                     \
+    GrB_Vector_free_(&w2) ;                     \
+    GrB_Vector_free_(&d) ;                      \
+    GrB_Descriptor_free_(&desc) ;               \
+}
+
+//------------------------------------------------------------------------------
+// same_vector: true if x and y have the same pattern and values
+//------------------------------------------------------------------------------
+
+static bool same_vector (GrB_Vector x, GrB_Vector y, GrB_Vector d)
+{
+    GrB_Info info ;
+    GrB_Index xnvals, ynvals, dnvals ;
+    bool ok = false ;
+    OK (GrB_Vector_clear (d)) ;
+    OK (GrB_Vector_eWiseMult_BinaryOp (d, NULL, NULL, GrB_EQ_FP64, x, y,
+        NULL)) ;
+    OK (GrB_Vector_nvals (&xnvals, x)) ;
+    OK (GrB_Vector_nvals (&ynvals, y)) ;
+    OK (GrB_Vector_nvals (&dnvals, d)) ;
+    OK (GrB_Vector_reduce_BOOL (&ok, NULL, GrB_LAND_MONOID_BOOL, d, NULL)) ;
+    return (ok && xnvals == ynvals && xnvals == dnvals) ;
+}
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    GrB_Info info ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector u = NULL, m = NULL, w1 = NULL, w2 = NULL, d = NULL ;
+    GrB_Descriptor desc = NULL ;
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    bool malloc_debug = GB_mx_get_global (true) ;
+    if (nargin > 0 || nargout > 0)
+    {
+        mexErrMsgTxt ("usage: " USAGE) ;
+    }
+
+    GrB_Index n = 2000 ;
+    OK (GrB_Vector_new (&d, GrB_BOOL, n)) ;
+    OK (GrB_Descriptor_new (&desc)) ;
+    int64_t stats [GxB_NPUSHPULL_STATS] ;
+
+    // trial 0: w=A*u, u with one entry, A by column: push
+    // trial 1: w<m>=A*u, u full, m with one entry, A by row: pull
+    // trial 2: w<m>=A*u, u full, m with one entry, A by column and row: pull
+    // trial 3: w'<m'>=u'*A, u full, m with one entry, A by column: pull
+    // trial 4: w'=u'*A, u with one entry, A by row: push
+
+    for (int trial = 0 ; trial <= 4 ; trial++)
+    {
+
+        //----------------------------------------------------------------------
+        // create the problem
+        //----------------------------------------------------------------------
+
+        bool push = (trial == 0 || trial == 4) ;
+        simple_rand_seed (1) ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_FORMAT,
+            (trial == 1 || trial == 4) ? GxB_BY_ROW : GxB_BY_COL)) ;
+        for (int k = 0 ; k < 20000 ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (A,
+                (double) (simple_rand ( ) % 9 + 1),
+                simple_rand ( ) % n, simple_rand ( ) % n)) ;
+        }
+        if (trial == 2)
+        {
+            OK (GxB_Matrix_Option_set (A, GxB_DUAL_FORMAT, true)) ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        OK (GrB_Vector_new (&u, GrB_FP64, n)) ;
+        GrB_Vector mask = NULL ;
+        if (push)
+        {
+            OK (GrB_Vector_setElement_FP64 (u, (double) 2, n/2)) ;
+        }
+        else
+        {
+            for (GrB_Index i = 0 ; i < n ; i++)
+            {
+                OK (GrB_Vector_setElement_FP64 (u, (double) (i % 7), i)) ;
+            }
+            OK (GrB_Vector_new (&m, GrB_BOOL, n)) ;
+            OK (GrB_Vector_setElement_BOOL (m, true, n/3)) ;
+            mask = m ;
+        }
+        OK (GrB_Vector_wait (u, GrB_MATERIALIZE)) ;
+
+        //----------------------------------------------------------------------
+        // w1 = A*u or u'*A with the default method
+        //----------------------------------------------------------------------
+
+        OK (GxB_Global_Option_set (GxB_PUSHPULL_STATS, NULL)) ;
+        OK (GrB_Vector_new (&w1, GrB_FP64, n)) ;
+        if (trial <= 2)
+        {
+            OK (GrB_mxv (w1, mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, u,
+                NULL)) ;
+        }
+        else
+        {
+            OK (GrB_vxm (w1, mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u, A,
+                NULL)) ;
+        }
+        OK (GxB_Global_Option_get (GxB_PUSHPULL_STATS, stats)) ;
+        if (push)
+        {
+            CHECK (stats [0] > 0 && stats [1] == 0) ;
+        }
+        else
+        {
+            CHECK (stats [0] == 0 && stats [1] > 0) ;
+        }
+
+        //----------------------------------------------------------------------
+        // w2 = A*u or u'*A with saxpy and with dot
+        //----------------------------------------------------------------------
+
+        for (int method = 0 ; method <= 1 ; method++)
+        {
+            OK (GxB_Global_Option_set (GxB_PUSHPULL_STATS, NULL)) ;
+            OK (GxB_Desc_set (desc, GxB_AxB_METHOD,
+                (method == 0) ? GxB_AxB_SAXPY : GxB_AxB_DOT)) ;
+            OK (GrB_Vector_new (&w2, GrB_FP64, n)) ;
+            if (trial <= 2)
+            {
+                OK (GrB_mxv (w2, mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A,
+                    u, desc)) ;
+            }
+            else
+            {
+                OK (GrB_vxm (w2, mask, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, u,
+                    A, desc)) ;
+            }
+            CHECK (same_vector (w1, w2, d)) ;
+            // an explicit method is used as-is
+            OK (GxB_Global_Option_get (GxB_PUSHPULL_STATS, stats)) ;
+            CHECK (stats [0] == 0 && stats [1] == 0) ;
+            OK (GrB_Vector_free_(&w2)) ;
+        }
+
+        OK (GrB_Matrix_free_(&A)) ;
+        OK (GrB_Vector_free_(&u)) ;
+        OK (GrB_Vector_free_(&m)) ;
+        OK (GrB_Vector_free_(&w1)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // wrapup
+    //--------------------------------------------------------------------------
+
+    FREE_ALL ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_pushpull: all tests passed\n\n") ;
+}
@@ -0,0 +1,9 @@
+function test247
+%TEST247 test the CPU JIT for GrB_mxm
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_jit_mxm ;
+
+fprintf ('\ntest247: all tests passed\n') ;
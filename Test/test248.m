@@ -0,0 +1,29 @@
+function test248
+%TEST248 test the persistent cache of the CPU JIT
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+cache_path = tempname ;
+mkdir (cache_path) ;
+
+% the first call compiles the kernel into the empty cache folder
+stats1 = GB_mex_jit_cache (cache_path) ;
+jit_control = stats1 (4) ;
+if (jit_control)
+    assert (isequal (stats1 (1:2), [0 1])) ;
+    assert (stats1 (3) > 0) ;
+end
+
+% the second call loads the kernel from the cache, and compiles nothing
+stats2 = GB_mex_jit_cache (cache_path) ;
+if (jit_control)
+    assert (isequal (stats2 (1:2), [1 0])) ;
+    assert (stats2 (3) == stats1 (3)) ;
+else
+    fprintf ('JIT not available; generic methods tested only\n') ;
+end
+
+rmdir (cache_path, 's') ;
+
+fprintf ('\ntest248: all tests passed\n') ;
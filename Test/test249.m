@@ -0,0 +1,9 @@
+function test249
+%TEST249 test the CPU JIT for eWiseAdd, eWiseMult, and eWiseUnion
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_jit_ewise ;
+
+fprintf ('\ntest249: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test250
+%TEST250 test the CPU JIT for GrB_reduce to a scalar
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_jit_reduce ;
+
+fprintf ('\ntest250: all tests passed\n') ;
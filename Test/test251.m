@@ -0,0 +1,9 @@
+function test251
+%TEST251 test the CPU JIT for GrB_select
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_jit_select ;
+
+fprintf ('\ntest251: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test252
+%TEST252 test GxB_Context
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_context ;
+
+fprintf ('\ntest252: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test253
+%TEST253 test the deferred in-place GrB_apply
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_deferred ;
+
+fprintf ('\ntest253: all tests passed\n') ;
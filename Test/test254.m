@@ -0,0 +1,9 @@
+function test254
+%TEST254 test the push/pull selection for GrB_mxv and GrB_vxm
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_pushpull ;
+
+fprintf ('\ntest254: all tests passed\n') ;
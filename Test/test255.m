@@ -0,0 +1,9 @@
+function test255
+%TEST255 test the packed bitmap (GxB_BITMAP_PACKED)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_packed_bitmap ;
+
+fprintf ('\ntest255: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test256
+%TEST256 test the bitwise saxpy for boolean semirings
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_bitwise ;
+
+fprintf ('\ntest256: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test257
+%TEST257 test the 32-bit index option (GxB_INDEX_32)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_index32 ;
+
+fprintf ('\ntest257: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test258
+%TEST258 test the reuse of the saxpy3 analysis (GxB_AxB_PLAN)
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_plan ;
+
+fprintf ('\ntest258: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test259
+%TEST259 test GxB_mxm_batch in CSR and CSC formats
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_mxm_batch ;
+
+fprintf ('\ntest259: all tests passed\n') ;
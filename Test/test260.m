@@ -0,0 +1,9 @@
+function test260
+%TEST260 test the ESC coarse tasks of saxpy3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_esc ;
+
+fprintf ('\ntest260: all tests passed\n') ;
@@ -0,0 +1,9 @@
+function test261
+%TEST261 test the fine Gustavson tasks with private workspaces
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_private_fine ;
+
+fprintf ('\ntest261: all tests passed\n') ;
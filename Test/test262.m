@@ -0,0 +1,9 @@
+function test262
+%TEST262 test the masked sparse accumulator (MSA) method of saxpy3
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2022, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_msa ;
+
+fprintf ('\ntest262: all tests passed\n') ;
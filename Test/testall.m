@@ -76,6 +76,22 @@ GB_mex_hack (hack) ;
 %----------------------------------------
 
 logstat ('test246',t) ; % GrB_mxm parallelism (changes slice_balanced)
+logstat ('test247',t) ; % test the CPU JIT for GrB_mxm
+logstat ('test248',t) ; % test the persistent cache of the CPU JIT
+logstat ('test249',t) ; % test the CPU JIT for eWiseAdd, eWiseMult, and eWiseUnion
+logstat ('test250',t) ; % test the CPU JIT for GrB_reduce to a scalar
+logstat ('test251',t) ; % test the CPU JIT for GrB_select
+logstat ('test252',t) ; % test GxB_Context
+logstat ('test253',t) ; % test the deferred in-place GrB_apply
+logstat ('test254',t) ; % test the push/pull selection for GrB_mxv and GrB_vxm
+logstat ('test255',t) ; % test the packed bitmap (GxB_BITMAP_PACKED)
+logstat ('test256',t) ; % test the bitwise saxpy for boolean semirings
+logstat ('test257',t) ; % test the 32-bit index option (GxB_INDEX_32)
+logstat ('test258',t) ; % test the reuse of the saxpy3 analysis (GxB_AxB_PLAN)
+logstat ('test259',t) ; % test GxB_mxm_batch in CSR and CSC formats
+logstat ('test260',t) ; % test the ESC coarse tasks of saxpy3
+logstat ('test261',t) ; % test the fine Gustavson tasks with private workspaces
+logstat ('test262',t) ; % test the masked sparse accumulator (MSA) method of saxpy3
 logstat ('test01' ,t) ; % error handling
 logstat ('test245',t) ; % test complex row/col scale
 logstat ('test199',t) ; % test dot2 with hypersparse